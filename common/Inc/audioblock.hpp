@@ -0,0 +1,140 @@
+/**
+ * @file audioblock.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Non-owning view of the audio sample block.
+ * @details
+ * The processing stages receive the samples through these views instead of the raw pointers.
+ * A view carries the length and the stride of a channel. Then, the same stage can work on
+ * both the de-interleaved buffer (stride 1) and the interleaved buffer (stride = number of channels)
+ * without copying.
+ */
+
+#ifndef AUDIOBLOCK_HPP_
+#define AUDIOBLOCK_HPP_
+
+#include <stdint.h>
+
+namespace audio {
+
+/**
+ * @brief 32bit signed fixed point sample. 1 sign bit and 31 fractional bits.
+ */
+typedef int32_t q31_t;
+
+/**
+ * @brief Format of the sample in a view.
+ */
+enum SampleFormat {
+    ksfFloat,    ///< 32bit float, full scale is [-1.0, 1.0).
+    ksfQ31       ///< 32bit signed fixed point, full scale is [-2^31, 2^31).
+};
+
+/**
+ * @brief Sample format trait.
+ * @tparam T Type of the sample.
+ */
+template<typename T>
+struct SampleTraits;
+
+template<>
+struct SampleTraits<float> {
+    static const SampleFormat kFormat = ksfFloat;
+};
+
+template<>
+struct SampleTraits<q31_t> {
+    static const SampleFormat kFormat = ksfQ31;
+};
+
+/**
+ * @brief View of a channel in an audio block.
+ * @tparam T Type of the sample.
+ * @details
+ * The view doesn't own the memory. The sample i is located at data[i * stride].
+ */
+template<typename T>
+class ChannelSpan {
+ public:
+    /**
+     * @brief Empty view.
+     */
+    ChannelSpan()
+            : data_(nullptr),
+              length_(0),
+              stride_(1) {
+    }
+    /**
+     * @param data Pointer to the first sample.
+     * @param length Number of the samples in the view.
+     * @param stride Distance between the adjacent samples, in number of T.
+     */
+    ChannelSpan(T *data, unsigned int length, unsigned int stride = 1)
+            : data_(data),
+              length_(length),
+              stride_(stride) {
+    }
+    /**
+     * @brief Access to a sample.
+     * @param index Index of the sample. Must be smaller than Length().
+     */
+    T& operator[](unsigned int index) const {
+        return data_[index * stride_];
+    }
+    /**
+     * @return Pointer to the first sample.
+     */
+    T* Data() const {
+        return data_;
+    }
+    /**
+     * @return Number of the samples.
+     */
+    unsigned int Length() const {
+        return length_;
+    }
+    /**
+     * @return Distance between the adjacent samples.
+     */
+    unsigned int Stride() const {
+        return stride_;
+    }
+    /**
+     * @return true if the samples are contiguous in memory.
+     */
+    bool IsContiguous() const {
+        return stride_ == 1;
+    }
+    /**
+     * @return Format of the samples in this view.
+     */
+    static SampleFormat Format() {
+        return SampleTraits<T>::kFormat;
+    }
+ private:
+    T *data_;
+    unsigned int length_;
+    unsigned int stride_;
+};
+
+/**
+ * @brief View of a stereo audio block.
+ * @tparam T Type of the sample.
+ */
+template<typename T>
+struct StereoBlock {
+    ChannelSpan<T> left;     ///< Left channel.
+    ChannelSpan<T> right;    ///< Right channel.
+
+    /**
+     * @return Number of the samples per channel.
+     */
+    unsigned int Length() const {
+        return left.Length();
+    }
+};
+
+} /* namespace audio */
+
+#endif /* AUDIOBLOCK_HPP_ */
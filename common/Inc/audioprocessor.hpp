@@ -0,0 +1,43 @@
+/**
+ * @file audioprocessor.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Interface of the block processing stage.
+ */
+
+#ifndef AUDIOPROCESSOR_HPP_
+#define AUDIOPROCESSOR_HPP_
+
+#include "audioblock.hpp"
+
+namespace audio {
+
+/**
+ * @brief Root class of the processing stage.
+ * @tparam T Type of the sample. float or q31_t.
+ * @details
+ * A stage processes a stereo block in place. The block is given by the audio task
+ * for each exchange with the CODEC.
+ *
+ * Process() is called from the audio task at realtime priority. The implementation must not
+ * block, and must not allocate memory.
+ */
+template<typename T>
+class AudioProcessor {
+ public:
+    virtual ~AudioProcessor() {
+    }
+    /**
+     * @brief Process a block in place.
+     * @param block Stereo samples to process.
+     */
+    virtual void Process(const StereoBlock<T> &block) = 0;
+};
+
+typedef AudioProcessor<float> FloatProcessor;    ///< Stage for the float block.
+typedef AudioProcessor<q31_t> Q31Processor;      ///< Stage for the Q31 block.
+
+} /* namespace audio */
+
+#endif /* AUDIOPROCESSOR_HPP_ */
@@ -0,0 +1,181 @@
+/**
+ * @file backgroundstage.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Stage processed by a task of lower priority than the audio task.
+ */
+
+#ifndef BACKGROUNDSTAGE_HPP_
+#define BACKGROUNDSTAGE_HPP_
+
+#include <stdint.h>
+
+#include "audioprocessor.hpp"
+#include "blockfifo.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+// Define as true to run the analysis of the output in the analysis task.
+#ifndef AUDIO_CONFIG_ANALYSIS
+#define AUDIO_CONFIG_ANALYSIS false
+#endif
+
+// Define as true to run the convolution in the analysis task. The output is delayed by a block.
+#ifndef AUDIO_CONFIG_BACKGROUND_CONVOLUTION
+#define AUDIO_CONFIG_BACKGROUND_CONVOLUTION false
+#endif
+
+namespace audio {
+
+/**
+ * @brief Use of the result of the background processing.
+ */
+enum BackgroundMode {
+    kbmTap,        ///< The block passes through. The stage only observes it. For the analysis.
+    kbmReplace     ///< The block is replaced by the result of the previous block. For the processing.
+};
+
+/**
+ * @brief Adapter to run a stage in the background task, instead of the audio task.
+ * @details
+ * Process() is called by the audio task in the chain. It copies the block into the audio::BlockFifo,
+ * and returns. The background task calls Run(), and the wrapped stage processes the block there.
+ * Then, the audio task spends only the copy of the block, while the heavy processing uses the idle time
+ * of the CPU between the blocks.
+ *
+ * By kbmReplace, the audio task replaces the block by the result of the previous block. That is,
+ * the latency of the stage is one block, and the background task must finish a block within a block
+ * period. The result is matched by the sequence number. The late result is discarded, and the block is
+ * silent. Then, the latency never changes. The length of the block must be same as the previous one.
+ * Use kbmReplace without the sample rate conversion.
+ *
+ * By kbmTap, the block passes through, and the background task may be late by up to slots - 1 blocks.
+ *
+ * The background task is woken up by the caller after Process(), for example by murasaki::Synchronizer.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ */
+class BackgroundStage final : public FloatProcessor {
+ public:
+    /**
+     * @brief Number of the floats of the storage.
+     * @param slots Number of the blocks in the FIFO.
+     * @param max_length Maximum number of the samples per channel of a block.
+     */
+    static constexpr unsigned int StorageSize(unsigned int slots, unsigned int max_length) {
+        return BlockFifo::StorageSize(slots, max_length);
+    }
+
+    /**
+     * @param stage Stage run by the background task. Not owned.
+     * @param mode Use of the result.
+     * @param slots Number of the blocks in the FIFO. 2 to kMaxBlockFifoSlots.
+     * @param max_length Maximum number of the samples per channel of a block.
+     * @param storage Memory of StorageSize(slots, max_length) floats. Not owned.
+     */
+    BackgroundStage(FloatProcessor *stage, BackgroundMode mode, unsigned int slots, unsigned int max_length, float *storage)
+            : stage_(stage),
+              mode_(mode),
+              fifo_(slots, max_length, storage),
+              sequence_(0),
+              processed_(0),
+              dropped_(0),
+              late_(0) {
+        MURASAKI_ASSERT(nullptr != stage)
+    }
+
+    /**
+     * @brief Hand the block to the background task, and take the result of the previous block.
+     * @details
+     * Called by the audio task.
+     */
+    AUDIO_ITCM_KERNEL(background_process) virtual void Process(const StereoBlock<float> &block) {
+        // Discard the results not used. Keep the result of the previous block until the copy.
+        StereoBlock<float> result;
+        uint32_t sequence;
+        bool has_result = false;
+        while (fifo_.Peek(&result, &sequence)) {
+            if (kbmReplace == mode_ && sequence == sequence_ - 1) {
+                has_result = true;
+                break;
+            }
+            fifo_.Release();
+        }
+
+        if (!fifo_.Push(block, sequence_))
+            dropped_ = dropped_ + 1;
+        sequence_++;
+
+        if (kbmTap == mode_)
+            return;
+
+        const unsigned int length = block.Length();
+        if (has_result && result.Length() == length) {
+            for (unsigned int i = 0; i < length; i++) {
+                block.left[i] = result.left[i];
+                block.right[i] = result.right[i];
+            }
+        } else {
+            for (unsigned int i = 0; i < length; i++) {
+                block.left[i] = 0.0f;
+                block.right[i] = 0.0f;
+            }
+            // The first block has no previous block.
+            if (sequence_ > 1)
+                late_ = late_ + 1;
+        }
+        if (has_result)
+            fifo_.Release();
+    }
+
+    /**
+     * @brief Process a block waiting in the FIFO by the wrapped stage.
+     * @return false if no block is waiting.
+     * @details
+     * Called by the background task, until it returns false.
+     */
+    bool Run() {
+        StereoBlock<float> block;
+        if (!fifo_.BeginWork(&block))
+            return false;
+        stage_->Process(block);
+        fifo_.EndWork();
+        processed_ = processed_ + 1;
+        return true;
+    }
+
+    /**
+     * @return Number of the blocks processed by the background task.
+     */
+    uint32_t Processed() const {
+        return processed_;
+    }
+
+    /**
+     * @return Number of the blocks not handed to the background task, because the FIFO was full.
+     */
+    uint32_t Dropped() const {
+        return dropped_;
+    }
+
+    /**
+     * @return Number of the blocks silenced, because the result was not ready. kbmReplace only.
+     */
+    uint32_t Late() const {
+        return late_;
+    }
+
+ private:
+    FloatProcessor *const stage_;
+    const BackgroundMode mode_;
+    BlockFifo fifo_;
+    uint32_t sequence_;     // Sequence number of the next block. Audio task only.
+    volatile uint32_t processed_;
+    volatile uint32_t dropped_;
+    volatile uint32_t late_;
+};
+
+} /* namespace audio */
+
+#endif /* BACKGROUNDSTAGE_HPP_ */
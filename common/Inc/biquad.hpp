@@ -0,0 +1,343 @@
+/**
+ * @file biquad.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Cascaded biquad filter for the parametric equalizer.
+ */
+
+#ifndef BIQUAD_HPP_
+#define BIQUAD_HPP_
+
+#include <math.h>
+
+#include "audioprocessor.hpp"
+#include "doublebuffer.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Maximum number of the biquad stages per channel.
+ */
+const unsigned int kMaxBiquadStages = 8;
+
+/**
+ * @brief Coefficients of a biquad stage, normalized by a0.
+ * @details
+ * y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+ */
+struct BiquadCoefficients {
+    float b0;
+    float b1;
+    float b2;
+    float a1;
+    float a2;
+};
+
+/**
+ * @brief Response of a biquad stage.
+ */
+enum BiquadType {
+    kbtPeaking,      ///< Peaking equalizer. The gain is applied around the frequency.
+    kbtLowShelf,     ///< Low shelf. The gain is applied below the frequency.
+    kbtHighShelf,    ///< High shelf. The gain is applied above the frequency.
+    kbtLowPass,      ///< 2nd order low pass. The gain is ignored.
+    kbtHighPass      ///< 2nd order high pass. The gain is ignored.
+};
+
+/**
+ * @brief Design a biquad stage.
+ * @param type Response of the stage.
+ * @param fs Sampling frequency [Hz].
+ * @param frequency Center or corner frequency [Hz].
+ * @param gain Gain of the peaking and shelf [dB].
+ * @param q Quality factor. For the shelf, 0.707 gives the steepest slope without overshoot.
+ * @return Coefficients.
+ * @details
+ * The formulas of the "Audio EQ Cookbook" by R. Bristow-Johnson. This function uses the math library.
+ * Call it from a task other than the audio task.
+ */
+inline BiquadCoefficients DesignBiquad(BiquadType type, float fs, float frequency, float gain, float q) {
+    const float a = powf(10.0f, gain / 40.0f);
+    const float w0 = 2.0f * 3.14159265f * frequency / fs;
+    const float cos_w0 = cosf(w0);
+    const float alpha = sinf(w0) / (2.0f * q);
+    const float shelf = 2.0f * sqrtf(a) * alpha;
+
+    float b0, b1, b2, a0, a1, a2;
+    switch (type) {
+        case kbtLowShelf:
+            b0 = a * ((a + 1) - (a - 1) * cos_w0 + shelf);
+            b1 = 2 * a * ((a - 1) - (a + 1) * cos_w0);
+            b2 = a * ((a + 1) - (a - 1) * cos_w0 - shelf);
+            a0 = (a + 1) + (a - 1) * cos_w0 + shelf;
+            a1 = -2 * ((a - 1) + (a + 1) * cos_w0);
+            a2 = (a + 1) + (a - 1) * cos_w0 - shelf;
+            break;
+        case kbtHighShelf:
+            b0 = a * ((a + 1) + (a - 1) * cos_w0 + shelf);
+            b1 = -2 * a * ((a - 1) + (a + 1) * cos_w0);
+            b2 = a * ((a + 1) + (a - 1) * cos_w0 - shelf);
+            a0 = (a + 1) - (a - 1) * cos_w0 + shelf;
+            a1 = 2 * ((a - 1) - (a + 1) * cos_w0);
+            a2 = (a + 1) - (a - 1) * cos_w0 - shelf;
+            break;
+        case kbtLowPass:
+            b0 = (1 - cos_w0) / 2;
+            b1 = 1 - cos_w0;
+            b2 = (1 - cos_w0) / 2;
+            a0 = 1 + alpha;
+            a1 = -2 * cos_w0;
+            a2 = 1 - alpha;
+            break;
+        case kbtHighPass:
+            b0 = (1 + cos_w0) / 2;
+            b1 = -(1 + cos_w0);
+            b2 = (1 + cos_w0) / 2;
+            a0 = 1 + alpha;
+            a1 = -2 * cos_w0;
+            a2 = 1 - alpha;
+            break;
+        case kbtPeaking:
+        default:
+            b0 = 1 + alpha * a;
+            b1 = -2 * cos_w0;
+            b2 = 1 - alpha * a;
+            a0 = 1 + alpha / a;
+            a1 = -2 * cos_w0;
+            a2 = 1 - alpha / a;
+            break;
+    }
+
+    BiquadCoefficients c;
+    c.b0 = b0 / a0;
+    c.b1 = b1 / a0;
+    c.b2 = b2 / a0;
+    c.a1 = a1 / a0;
+    c.a2 = a2 / a0;
+    return c;
+}
+
+/**
+ * @brief Stereo cascade of the biquad stages in the transposed direct form II.
+ * @details
+ * Both channels have the same coefficients. Each stage processes the whole block before the next
+ * stage. Then, the coefficients and the two state variables of a stage stay in the registers
+ * during the block.
+ *
+ * The coefficients are double buffered by audio::DoubleBuffer. SetCoefficients() is called from a task
+ * other than the audio task. It writes the bank not in use, and hands it to the audio task. The audio task
+ * switches to the new bank at the beginning of the next Process(). Then, a block is never
+ * processed by the half written coefficients. The states are kept over the switch.
+ *
+ * A new bank taken while running is not applied at once. The coefficients move linearly from the
+ * current ones to the new ones sample by sample, over the ramp length. Then, the change of the
+ * equalizer doesn't click. The stages added by the new bank start from the pass through, and the
+ * removed stages move to the pass through before they are removed. The stable region of (a1, a2) is
+ * a triangle. Then, the interpolation between the stable filters is stable. The interpolation costs
+ * 5 additions per sample per stage, only while the coefficients are moving. The first bank is applied
+ * at once, because there is no output to be smoothed yet.
+ *
+ * Without SetCoefficients(), the cascade has no stage. That is, the block passes through.
+ */
+class BiquadCascade final : public FloatProcessor {
+ public:
+    /**
+     * @param ramp_length Number of the samples to move to the new coefficients. 0 to switch at once.
+     */
+    explicit BiquadCascade(unsigned int ramp_length = 0)
+            : banks_(Bank(), Bank()),
+              ramp_length_(ramp_length),
+              remaining_(0),
+              stages_(0),
+              is_running_(false) {
+        Reset();
+    }
+
+    /**
+     * @brief Hand the new coefficients to the audio task.
+     * @param coefficients Array of the coefficients of the stages. Copied.
+     * @param stages Number of the stages. 0 to kMaxBiquadStages.
+     * @return false if the previous coefficients are not taken by the audio task yet. Retry later.
+     * @details
+     * Called from a task other than the audio task. Never blocks.
+     */
+    bool SetCoefficients(const BiquadCoefficients *coefficients, unsigned int stages) {
+        if (stages > kMaxBiquadStages)
+            return false;
+        Bank *const bank = banks_.BeginWrite();
+        if (nullptr == bank)
+            return false;
+
+        for (unsigned int i = 0; i < stages; i++)
+            bank->coefficients[i] = coefficients[i];
+        bank->stages = stages;
+
+        banks_.EndWrite();
+        return true;
+    }
+
+    /**
+     * @brief Clear the states of the all stages.
+     * @details
+     * Called from the audio task, or before the audio starts.
+     */
+    void Reset() {
+        for (unsigned int ch = 0; ch < 2; ch++)
+            for (unsigned int i = 0; i < kMaxBiquadStages; i++) {
+                state_[ch][i][0] = 0.0f;
+                state_[ch][i][1] = 0.0f;
+            }
+    }
+
+    /**
+     * @return true while the coefficients are moving to the new bank.
+     */
+    bool IsRamping() const {
+        return 0 != remaining_;
+    }
+
+    AUDIO_ITCM_KERNEL(biquad_process) virtual void Process(const StereoBlock<float> &block) {
+        if (banks_.Update())
+            TakeBank();
+        is_running_ = true;
+
+        const unsigned int length = block.Length();
+        if (0 == remaining_) {
+            for (unsigned int i = 0; i < stages_; i++) {
+                Filter(block.left, 0, length, target_[i], state_[0][i]);
+                Filter(block.right, 0, length, target_[i], state_[1][i]);
+            }
+            return;
+        }
+
+        // Move the coefficients during the ramp, and then filter the rest of the block by the target.
+        const unsigned int ramp = (length < remaining_) ? length : remaining_;
+        for (unsigned int i = 0; i < stages_; i++) {
+            RampFilter(block.left, ramp, current_[i], step_[i], state_[0][i]);
+            RampFilter(block.right, ramp, current_[i], step_[i], state_[1][i]);
+            Filter(block.left, ramp, length, target_[i], state_[0][i]);
+            Filter(block.right, ramp, length, target_[i], state_[1][i]);
+            Advance(&current_[i], step_[i], ramp);
+        }
+        remaining_ -= ramp;
+        if (0 == remaining_) {
+            for (unsigned int i = 0; i < stages_; i++)
+                current_[i] = target_[i];
+            stages_ = banks_.Front().stages;
+        }
+    }
+
+ private:
+    // Value initialized Bank() has no stage.
+    struct Bank {
+        BiquadCoefficients coefficients[kMaxBiquadStages];
+        unsigned int stages;
+    };
+
+    // Start moving to the bank just taken.
+    void TakeBank() {
+        const Bank &bank = banks_.Front();
+        const BiquadCoefficients pass_through = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+        // The stages added by the new bank start from the silence and the pass through.
+        for (unsigned int i = stages_; i < bank.stages; i++) {
+            for (unsigned int ch = 0; ch < 2; ch++) {
+                state_[ch][i][0] = 0.0f;
+                state_[ch][i][1] = 0.0f;
+            }
+            current_[i] = pass_through;
+        }
+
+        const unsigned int stages = (bank.stages > stages_) ? bank.stages : stages_;
+        for (unsigned int i = 0; i < stages; i++)
+            target_[i] = (i < bank.stages) ? bank.coefficients[i] : pass_through;
+
+        if (!is_running_ || 0 == ramp_length_) {
+            for (unsigned int i = 0; i < stages; i++)
+                current_[i] = target_[i];
+            stages_ = bank.stages;
+            remaining_ = 0;
+            return;
+        }
+
+        const float scale = 1.0f / ramp_length_;
+        for (unsigned int i = 0; i < stages; i++) {
+            step_[i].b0 = (target_[i].b0 - current_[i].b0) * scale;
+            step_[i].b1 = (target_[i].b1 - current_[i].b1) * scale;
+            step_[i].b2 = (target_[i].b2 - current_[i].b2) * scale;
+            step_[i].a1 = (target_[i].a1 - current_[i].a1) * scale;
+            step_[i].a2 = (target_[i].a2 - current_[i].a2) * scale;
+        }
+        stages_ = stages;
+        remaining_ = ramp_length_;
+    }
+
+    static void Advance(BiquadCoefficients *c, const BiquadCoefficients &step, unsigned int count) {
+        c->b0 += step.b0 * count;
+        c->b1 += step.b1 * count;
+        c->b2 += step.b2 * count;
+        c->a1 += step.a1 * count;
+        c->a2 += step.a2 * count;
+    }
+
+    // Filter the samples from begin to end - 1 by the fixed coefficients.
+    static void Filter(const ChannelSpan<float> &channel, unsigned int begin, unsigned int end, const BiquadCoefficients &c, float state[2]) {
+        float *const data = channel.Data();
+        const unsigned int stride = channel.Stride();
+        float s1 = state[0];
+        float s2 = state[1];
+
+        for (unsigned int i = begin; i < end; i++) {
+            const float x = data[i * stride];
+            const float y = c.b0 * x + s1;
+            s1 = c.b1 * x - c.a1 * y + s2;
+            s2 = c.b2 * x - c.a2 * y;
+            data[i * stride] = y;
+        }
+
+        state[0] = s1;
+        state[1] = s2;
+    }
+
+    // Filter the first count samples, moving the coefficients by the step per sample.
+    static void RampFilter(const ChannelSpan<float> &channel, unsigned int count, BiquadCoefficients c, const BiquadCoefficients &step, float state[2]) {
+        float *const data = channel.Data();
+        const unsigned int stride = channel.Stride();
+        float s1 = state[0];
+        float s2 = state[1];
+
+        for (unsigned int i = 0; i < count; i++) {
+            c.b0 += step.b0;
+            c.b1 += step.b1;
+            c.b2 += step.b2;
+            c.a1 += step.a1;
+            c.a2 += step.a2;
+            const float x = data[i * stride];
+            const float y = c.b0 * x + s1;
+            s1 = c.b1 * x - c.a1 * y + s2;
+            s2 = c.b2 * x - c.a2 * y;
+            data[i * stride] = y;
+        }
+
+        state[0] = s1;
+        state[1] = s2;
+    }
+
+    DoubleBuffer<Bank> banks_;
+    float state_[2][kMaxBiquadStages][2];
+    // The coefficients used by the audio task. Written by the audio task only.
+    BiquadCoefficients current_[kMaxBiquadStages];
+    BiquadCoefficients target_[kMaxBiquadStages];
+    BiquadCoefficients step_[kMaxBiquadStages];
+    const unsigned int ramp_length_;
+    unsigned int remaining_;     // Samples to the end of the ramp.
+    unsigned int stages_;        // Stages in use. Includes the stages moving to the pass through.
+    bool is_running_;
+};
+
+} /* namespace audio */
+
+#endif /* BIQUAD_HPP_ */
@@ -0,0 +1,193 @@
+/**
+ * @file biquadq31.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Cascaded biquad filter in Q31, for the equalizer of the Q31 processing.
+ */
+
+#ifndef BIQUADQ31_HPP_
+#define BIQUADQ31_HPP_
+
+#include "audioprocessor.hpp"
+#include "biquad.hpp"
+#include "doublebuffer.hpp"
+#include "murasaki.hpp"
+#include "q31.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Coefficients of a biquad stage in Q3.29, normalized by a0.
+ * @details
+ * y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+ *
+ * The range is -4.0 to 4.0. The coefficients of the "Audio EQ Cookbook" are in -2.0 to 2.0 for the
+ * stable filters, except the shelves with the large gain.
+ */
+struct BiquadCoefficientsQ31 {
+    q31_t b0;
+    q31_t b1;
+    q31_t b2;
+    q31_t a1;
+    q31_t a2;
+};
+
+/**
+ * @brief Stereo cascade of the biquad stages in the direct form I, in Q31.
+ * @details
+ * The Q31 counterpart of audio::BiquadCascade. The samples are Q31, and the coefficients are Q3.29.
+ * The 5 products of a sample are accumulated in 64bit, by SMLAL on the Cortex-M4 / M7. Then,
+ * the sum is truncated to Q31 with saturation, once per sample per stage. The direct form I keeps
+ * the input and output samples as the state. Then, the state never overflows, and a saturated
+ * output doesn't disturb the following samples more than the saturation itself.
+ *
+ * The accumulator doesn't overflow while the sum of the absolute values of the coefficients of a
+ * stage is less than 8.0. SetCoefficients() asserts it.
+ *
+ * The coefficients are double buffered by audio::DoubleBuffer, as like audio::BiquadCascade. The audio
+ * task switches to the new bank at the beginning of the next Process(), without the ramp. The states
+ * are kept over the switch. The stages added by the new bank start from the silence.
+ *
+ * Without SetCoefficients(), the cascade has no stage. That is, the block passes through.
+ */
+class BiquadCascadeQ31 final : public Q31Processor {
+ public:
+    /**
+     * @brief Number of the fractional bits of the coefficients.
+     */
+    static const unsigned int kFractionBits = 29;
+
+    BiquadCascadeQ31()
+            : banks_(Bank(), Bank()),
+              stages_(0) {
+        Reset();
+    }
+
+    /**
+     * @brief Hand the new coefficients to the audio task.
+     * @param coefficients Array of the coefficients of the stages, in float. Converted and copied.
+     * @param stages Number of the stages. 0 to kMaxBiquadStages.
+     * @return false if the previous coefficients are not taken by the audio task yet. Retry later.
+     * @details
+     * Called from a task other than the audio task. Never blocks. The float coefficients are
+     * rounded to Q3.29.
+     */
+    bool SetCoefficients(const BiquadCoefficients *coefficients, unsigned int stages) {
+        if (stages > kMaxBiquadStages)
+            return false;
+        Bank *const bank = banks_.BeginWrite();
+        if (nullptr == bank)
+            return false;
+
+        for (unsigned int i = 0; i < stages; i++) {
+            const BiquadCoefficients &c = coefficients[i];
+            MURASAKI_ASSERT(fabsf(c.b0) + fabsf(c.b1) + fabsf(c.b2) + fabsf(c.a1) + fabsf(c.a2) < 8.0f)
+            bank->coefficients[i].b0 = ToCoefficient(c.b0);
+            bank->coefficients[i].b1 = ToCoefficient(c.b1);
+            bank->coefficients[i].b2 = ToCoefficient(c.b2);
+            bank->coefficients[i].a1 = ToCoefficient(c.a1);
+            bank->coefficients[i].a2 = ToCoefficient(c.a2);
+        }
+        bank->stages = stages;
+
+        banks_.EndWrite();
+        return true;
+    }
+
+    /**
+     * @brief Clear the states of the all stages.
+     * @details
+     * Called from the audio task, or before the audio starts.
+     */
+    void Reset() {
+        for (unsigned int ch = 0; ch < 2; ch++)
+            for (unsigned int i = 0; i < kMaxBiquadStages; i++)
+                for (unsigned int k = 0; k < 4; k++)
+                    state_[ch][i][k] = 0;
+    }
+
+    /**
+     * @brief Convert a coefficient to Q3.29, rounding to nearest.
+     * @details
+     * Saturate out of -4.0 to 4.0.
+     */
+    static q31_t ToCoefficient(float c) {
+        const float scaled = c * static_cast<float>(1u << kFractionBits);
+        return SaturateQ31(static_cast<int64_t>(scaled + (scaled < 0.0f ? -0.5f : 0.5f)));
+    }
+
+    AUDIO_ITCM_KERNEL(biquadq31_process) virtual void Process(const StereoBlock<q31_t> &block) {
+        if (banks_.Update())
+            TakeBank();
+
+        const unsigned int length = block.Length();
+        for (unsigned int i = 0; i < stages_; i++) {
+            Filter(block.left, length, coefficients_[i], state_[0][i]);
+            Filter(block.right, length, coefficients_[i], state_[1][i]);
+        }
+    }
+
+ private:
+    // Value initialized Bank() has no stage.
+    struct Bank {
+        BiquadCoefficientsQ31 coefficients[kMaxBiquadStages];
+        unsigned int stages;
+    };
+
+    // Switch to the bank just taken.
+    void TakeBank() {
+        const Bank &bank = banks_.Front();
+
+        // The stages added by the new bank start from the silence.
+        for (unsigned int i = stages_; i < bank.stages; i++)
+            for (unsigned int ch = 0; ch < 2; ch++)
+                for (unsigned int k = 0; k < 4; k++)
+                    state_[ch][i][k] = 0;
+
+        for (unsigned int i = 0; i < bank.stages; i++)
+            coefficients_[i] = bank.coefficients[i];
+        stages_ = bank.stages;
+    }
+
+    // Filter the block by a stage. The state is x[n-1], x[n-2], y[n-1], y[n-2].
+    static void Filter(const ChannelSpan<q31_t> &channel, unsigned int length, const BiquadCoefficientsQ31 &c, q31_t state[4]) {
+        q31_t *const data = channel.Data();
+        const unsigned int stride = channel.Stride();
+        q31_t x1 = state[0];
+        q31_t x2 = state[1];
+        q31_t y1 = state[2];
+        q31_t y2 = state[3];
+
+        for (unsigned int i = 0; i < length; i++) {
+            const q31_t x = data[i * stride];
+            int64_t sum = static_cast<int64_t>(c.b0) * x;
+            sum += static_cast<int64_t>(c.b1) * x1;
+            sum += static_cast<int64_t>(c.b2) * x2;
+            sum -= static_cast<int64_t>(c.a1) * y1;
+            sum -= static_cast<int64_t>(c.a2) * y2;
+            const q31_t y = SaturateQ31(sum >> kFractionBits);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            data[i * stride] = y;
+        }
+
+        state[0] = x1;
+        state[1] = x2;
+        state[2] = y1;
+        state[3] = y2;
+    }
+
+    DoubleBuffer<Bank> banks_;
+    q31_t state_[2][kMaxBiquadStages][4];
+    // The coefficients used by the audio task. Written by the audio task only.
+    BiquadCoefficientsQ31 coefficients_[kMaxBiquadStages];
+    unsigned int stages_;        // Stages in use.
+};
+
+} /* namespace audio */
+
+#endif /* BIQUADQ31_HPP_ */
@@ -0,0 +1,146 @@
+/**
+ * @file blockexchanger.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief In-place audio block exchange on top of murasaki::DuplexAudio.
+ */
+
+#ifndef BLOCKEXCHANGER_HPP_
+#define BLOCKEXCHANGER_HPP_
+
+#include "murasaki.hpp"
+#include "audioblock.hpp"
+
+namespace audio {
+
+/**
+ * @brief Ping-pong buffer to process the audio block in place.
+ * @details
+ * The talk through loop with murasaki::DuplexAudio::TransmitAndReceive() needs separated
+ * TX and RX buffers. Then, the application copies the processed RX data to the TX buffer.
+ *
+ * This class owns two sets of the stereo buffers. Exchange() transmits the set returned by the previous
+ * call, and receives the new block into the other set. The application processes the returned block
+ * in place, and the result is transmitted by the next Exchange(). No copy between RX and TX is needed.
+ *
+ * @code
+ * audio::BlockExchanger exchanger(murasaki::platform.audio, AUDIO_CHANNEL_LEN);
+ *
+ * while (true) {
+ *     audio::StereoBlock<float> block = exchanger.Exchange();
+ *     for (unsigned int i = 0; i < block.Length(); i++)
+ *         block.left[i] *= 0.5f;    // process in place.
+ * }
+ * @endcode
+ *
+ * Note that the conversion between the DMA buffer and the float buffer is still done inside the
+ * murasaki::DuplexAudio.
+ */
+class BlockExchanger {
+ public:
+    /**
+     * @brief Number of the channel buffers used by an exchanger. Two stereo sets.
+     */
+    static const unsigned int kNumBuffers = 4;
+
+    /**
+     * @param audio Audio framework to exchange the data with the CODEC.
+     * @param channel_length Number of the samples per channel. Must be same as the one given to the audio.
+     * @details
+     * The buffers are allocated and filled by zero to avoid the noise at the beginning.
+     */
+    BlockExchanger(murasaki::DuplexAudio *audio, unsigned int channel_length)
+            : audio_(audio),
+              channel_length_(channel_length),
+              phase_(0),
+              is_owner_(true) {
+        MURASAKI_ASSERT(nullptr != audio)
+        MURASAKI_ASSERT(0 != channel_length)
+
+        for (int set = 0; set < 2; set++) {
+            left_[set] = new float[channel_length];
+            right_[set] = new float[channel_length];
+            MURASAKI_ASSERT(nullptr != left_[set])
+            MURASAKI_ASSERT(nullptr != right_[set])
+        }
+        Clear();
+    }
+
+    /**
+     * @param audio Audio framework to exchange the data with the CODEC.
+     * @param channel_length Number of the samples per channel. Must be same as the one given to the audio.
+     * @param storage Buffer for the samples. At least kNumBuffers * channel_length floats.
+     * @details
+     * The buffers are taken from the storage, without the heap. The storage is filled by zero.
+     * The storage must live longer than the exchanger.
+     */
+    BlockExchanger(murasaki::DuplexAudio *audio, unsigned int channel_length, float *storage)
+            : audio_(audio),
+              channel_length_(channel_length),
+              phase_(0),
+              is_owner_(false) {
+        MURASAKI_ASSERT(nullptr != audio)
+        MURASAKI_ASSERT(0 != channel_length)
+        MURASAKI_ASSERT(nullptr != storage)
+
+        for (int set = 0; set < 2; set++) {
+            left_[set] = storage + (set * 2) * channel_length;
+            right_[set] = storage + (set * 2 + 1) * channel_length;
+        }
+        Clear();
+    }
+
+    ~BlockExchanger() {
+        if (is_owner_) {
+            for (int set = 0; set < 2; set++) {
+                delete[] left_[set];
+                delete[] right_[set];
+            }
+        }
+    }
+
+    /**
+     * @brief Transmit the last processed block and receive a new block.
+     * @return View of the received block. The samples have to be processed in place.
+     * @details
+     * Block until the end of current DMA transfer.
+     * The returned view is valid until the next call.
+     */
+    StereoBlock<float> Exchange() {
+        const unsigned int tx = phase_;
+        const unsigned int rx = phase_ ^ 1;
+
+        audio_->TransmitAndReceive(left_[tx], right_[tx], left_[rx], right_[rx]);
+        phase_ = rx;
+
+        StereoBlock<float> block;
+        block.left = ChannelSpan<float>(left_[rx], channel_length_);
+        block.right = ChannelSpan<float>(right_[rx], channel_length_);
+        return block;
+    }
+
+ private:
+    BlockExchanger(const BlockExchanger&);
+    BlockExchanger& operator=(const BlockExchanger&);
+
+    void Clear() {
+        for (int set = 0; set < 2; set++) {
+            for (unsigned int i = 0; i < channel_length_; i++) {
+                left_[set][i] = 0.0f;
+                right_[set][i] = 0.0f;
+            }
+        }
+    }
+
+    murasaki::DuplexAudio *const audio_;
+    const unsigned int channel_length_;
+    unsigned int phase_;
+    const bool is_owner_;
+    float *left_[2];
+    float *right_[2];
+};
+
+} /* namespace audio */
+
+#endif /* BLOCKEXCHANGER_HPP_ */
@@ -0,0 +1,169 @@
+/**
+ * @file blockfifo.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Lock-free FIFO of the stereo blocks between the audio task and a lower priority task.
+ */
+
+#ifndef BLOCKFIFO_HPP_
+#define BLOCKFIFO_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+#include "audioblock.hpp"
+#include "murasaki.hpp"
+
+namespace audio {
+
+/**
+ * @brief Maximum number of the slots of audio::BlockFifo.
+ */
+const unsigned int kMaxBlockFifoSlots = 8;
+
+/**
+ * @brief Ring of the block slots, handed from the audio task to a worker task, and back.
+ * @details
+ * A slot goes around the three states by the three indices.
+ * @li Push() : The audio task copies a block into the slot at the write index.
+ * @li BeginWork() and EndWork() : The worker task processes the slot at the work index in place.
+ * @li Peek() and Release() : The audio task takes the processed slot at the read index.
+ *
+ * Each index is written by one task only, as like audio::SpscQueue. Then, no call blocks, and the
+ * audio task never waits for the worker task. If the worker task is late, Push() fails, and Peek()
+ * finds nothing. The caller decides what to do.
+ *
+ * Each slot carries the sequence number given by Push(). The audio task uses it to match the result
+ * with the block it pushed.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ */
+class BlockFifo {
+ public:
+    /**
+     * @brief Number of the floats of the storage.
+     * @param slots Number of the slots.
+     * @param max_length Maximum number of the samples per channel of a block.
+     */
+    static constexpr unsigned int StorageSize(unsigned int slots, unsigned int max_length) {
+        return slots * 2 * max_length;
+    }
+
+    /**
+     * @param slots Number of the slots. 2 to kMaxBlockFifoSlots.
+     * @param max_length Maximum number of the samples per channel of a block.
+     * @param storage Memory of StorageSize(slots, max_length) floats. Not owned.
+     */
+    BlockFifo(unsigned int slots, unsigned int max_length, float *storage)
+            : slots_(slots),
+              max_length_(max_length),
+              storage_(storage),
+              write_(0),
+              work_(0),
+              read_(0) {
+        MURASAKI_ASSERT(2 <= slots && slots <= kMaxBlockFifoSlots)
+        MURASAKI_ASSERT(nullptr != storage)
+    }
+
+    /**
+     * @brief Copy a block into the free slot.
+     * @param block Block to copy. Up to max_length samples.
+     * @param sequence Sequence number of the block.
+     * @return false if no slot is free. The block is not copied.
+     * @details
+     * Called by the audio task.
+     */
+    bool Push(const StereoBlock<float> &block, uint32_t sequence) {
+        const uint32_t write = write_.load(std::memory_order_relaxed);
+        if (write - read_.load(std::memory_order_relaxed) == slots_)
+            return false;
+
+        const unsigned int slot = write % slots_;
+        const unsigned int length = block.Length();
+        MURASAKI_ASSERT(length <= max_length_)
+        float *const left = storage_ + slot * 2 * max_length_;
+        float *const right = left + max_length_;
+        for (unsigned int i = 0; i < length; i++) {
+            left[i] = block.left[i];
+            right[i] = block.right[i];
+        }
+        lengths_[slot] = length;
+        sequences_[slot] = sequence;
+
+        write_.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get the oldest block not processed yet.
+     * @param block Receives the view of the block. The worker processes it in place.
+     * @return false if no block is waiting.
+     * @details
+     * Called by the worker task. Call EndWork() after the processing.
+     */
+    bool BeginWork(StereoBlock<float> *block) {
+        const uint32_t work = work_.load(std::memory_order_relaxed);
+        if (work == write_.load(std::memory_order_acquire))
+            return false;
+        *block = Slot(work % slots_);
+        return true;
+    }
+
+    /**
+     * @brief Hand the processed block back to the audio task.
+     * @details
+     * Called by the worker task after BeginWork() succeeded.
+     */
+    void EndWork() {
+        work_.store(work_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Get the oldest processed block.
+     * @param block Receives the view of the block.
+     * @param sequence Receives the sequence number given by Push().
+     * @return false if no block is processed.
+     * @details
+     * Called by the audio task. Call Release() to free the slot.
+     */
+    bool Peek(StereoBlock<float> *block, uint32_t *sequence) {
+        const uint32_t read = read_.load(std::memory_order_relaxed);
+        if (read == work_.load(std::memory_order_acquire))
+            return false;
+        *block = Slot(read % slots_);
+        *sequence = sequences_[read % slots_];
+        return true;
+    }
+
+    /**
+     * @brief Free the slot got by Peek().
+     * @details
+     * Called by the audio task.
+     */
+    void Release() {
+        read_.store(read_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+ private:
+    StereoBlock<float> Slot(unsigned int slot) const {
+        StereoBlock<float> block;
+        float *const left = storage_ + slot * 2 * max_length_;
+        block.left = ChannelSpan<float>(left, lengths_[slot]);
+        block.right = ChannelSpan<float>(left + max_length_, lengths_[slot]);
+        return block;
+    }
+
+    const unsigned int slots_;
+    const unsigned int max_length_;
+    float *const storage_;
+    unsigned int lengths_[kMaxBlockFifoSlots];
+    uint32_t sequences_[kMaxBlockFifoSlots];
+    std::atomic<uint32_t> write_;    // Written by the audio task.
+    std::atomic<uint32_t> work_;     // Written by the worker task.
+    std::atomic<uint32_t> read_;     // Written by the audio task.
+};
+
+} /* namespace audio */
+
+#endif /* BLOCKFIFO_HPP_ */
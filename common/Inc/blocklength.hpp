@@ -0,0 +1,100 @@
+/**
+ * @file blocklength.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Run time selection of the audio block length.
+ */
+
+#ifndef BLOCKLENGTH_HPP_
+#define BLOCKLENGTH_HPP_
+
+namespace audio {
+
+const unsigned int kMinBlockLength = 16;                ///< Shortest block length.
+const unsigned int kMaxBlockLength = 512;               ///< Longest block length.
+const unsigned int kLowLatencyBlockLength = 32;         ///< Block length for the live monitoring.
+const unsigned int kDefaultBlockLength = 128;           ///< Block length for the general use.
+const unsigned int kHighEfficiencyBlockLength = 512;    ///< Block length for the heavy effects.
+
+/**
+ * @brief Current audio block length and the request to change it.
+ * @details
+ * The block length decides the round trip latency and the overhead per sample. The latency
+ * is proportional to the block length, while the overhead of the block exchange is amortized over
+ * the block.
+ *
+ * The control side calls Request() at any time. The audio task checks IsChangeRequested() at
+ * the block boundary. If requested, the audio task stops the audio, calls Apply() and restarts
+ * the audio with the new length.
+ *
+ * Request() and Apply() are single word accesses. Then, no lock is needed between one
+ * control task and the audio task.
+ */
+class BlockLength {
+ public:
+    /**
+     * @param length Initial block length. Must satisfy IsValid().
+     */
+    explicit BlockLength(unsigned int length)
+            : current_(IsValid(length) ? length : kDefaultBlockLength),
+              request_(current_) {
+    }
+
+    /**
+     * @brief Check whether the length is supported.
+     * @param length Number of the samples per channel.
+     * @return true if the length is a power of two in [kMinBlockLength, kMaxBlockLength].
+     */
+    static bool IsValid(unsigned int length) {
+        return length >= kMinBlockLength && length <= kMaxBlockLength && (length & (length - 1)) == 0;
+    }
+
+    /**
+     * @return Block length currently in use.
+     */
+    unsigned int Get() const {
+        return current_;
+    }
+
+    /**
+     * @brief Request to change the block length.
+     * @param length New block length.
+     * @return false if the length is not valid. The request is ignored.
+     * @details
+     * Called from the control task. The change takes effect at the next block boundary
+     * of the audio task.
+     */
+    bool Request(unsigned int length) {
+        if (!IsValid(length))
+            return false;
+        request_ = length;
+        return true;
+    }
+
+    /**
+     * @return true if the requested length differs from the current one.
+     */
+    bool IsChangeRequested() const {
+        return request_ != current_;
+    }
+
+    /**
+     * @brief Adopt the requested length.
+     * @return New block length.
+     * @details
+     * Called from the audio task while the audio is stopped.
+     */
+    unsigned int Apply() {
+        current_ = request_;
+        return current_;
+    }
+
+ private:
+    volatile unsigned int current_;
+    volatile unsigned int request_;
+};
+
+} /* namespace audio */
+
+#endif /* BLOCKLENGTH_HPP_ */
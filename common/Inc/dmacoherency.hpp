@@ -0,0 +1,251 @@
+/**
+ * @file dmacoherency.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Cache coherency of the audio DMA buffers on the Cortex-M7.
+ * @details
+ * The DMA doesn't see the data cache of the Cortex-M7. There are three ways to keep the audio DMA
+ * buffers coherent.
+ * @li Place the buffers in the DTCM. The DTCM is not cached. See tcm.hpp.
+ * @li Place the buffers in the SRAM region which is configured as non-cacheable by the MPU.
+ *     Variables with AUDIO_NOCACHE_BSS are placed there. ConfigureNonCacheableRegion() sets the MPU.
+ * @li Place the buffers in the cached SRAM, and maintain the cache. The port adapters of the murasaki
+ *     library clean and invalidate the whole buffer at each block.
+ *
+ * The placement of the FreeRTOS heap, where the DMA buffers are allocated, is selected by
+ * AUDIO_CONFIG_DMA_BUFFER in the platform_config.hpp. Only the DTCM and the non-cacheable region
+ * can be selected. CoherencyBenchmark compares the CPU cost of the three ways.
+ *
+ * The linker script must have the NOLOAD .nocache_bss section, and the symbols _snocache_region
+ * and _enocache_region which give the range of the MPU region. The size of the region must be a
+ * power of 2, and the start must be aligned to the size. If both symbols are equal, the MPU
+ * is not configured.
+ *
+ * On the processors without the data cache, and on the host, the cache maintenance does nothing.
+ */
+
+#ifndef DMACOHERENCY_HPP_
+#define DMACOHERENCY_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__arm__)
+#include "main.h"   // For the CMSIS cache and MPU functions.
+#endif
+
+#if defined(__DCACHE_PRESENT) && __DCACHE_PRESENT
+#define AUDIO_HAS_DCACHE true
+#else
+#define AUDIO_HAS_DCACHE false
+#endif
+
+#ifndef AUDIO_CONFIG_COHERENCY_BENCHMARK
+#define AUDIO_CONFIG_COHERENCY_BENCHMARK false
+#endif
+
+#if AUDIO_HAS_DCACHE
+/**
+ * @brief Place the variable in the non-cacheable region. The variable is not initialized by the startup.
+ */
+#define AUDIO_NOCACHE_BSS __attribute__((section(".nocache_bss")))
+
+// Symbols defined by the linker script.
+extern "C" {
+extern uint8_t _snocache_region;    // Start of the non-cacheable region.
+extern uint8_t _enocache_region;    // End of the non-cacheable region.
+}
+#else
+#define AUDIO_NOCACHE_BSS
+#endif
+
+namespace audio {
+
+/**
+ * @brief Size of the data cache line of the Cortex-M7 in byte.
+ */
+const size_t kCacheLineSize = 32;
+
+/**
+ * @brief Write back the data cache lines which cover the given range.
+ * @param address Start of the range.
+ * @param size Size of the range in byte.
+ * @details
+ * Call before the DMA reads the range.
+ */
+inline void CleanDCache(const void *address, size_t size) {
+#if AUDIO_HAS_DCACHE
+    const uintptr_t start = reinterpret_cast<uintptr_t>(address) & ~(kCacheLineSize - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(address) + size;
+    SCB_CleanDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+#else
+    (void) address;
+    (void) size;
+#endif
+}
+
+/**
+ * @brief Discard the data cache lines which cover the given range.
+ * @param address Start of the range.
+ * @param size Size of the range in byte.
+ * @details
+ * Call after the DMA wrote the range, before the CPU reads it.
+ *
+ * The lines are cleaned before being discarded. Then, the variables sharing the first and the last
+ * line with the range are not lost, even if the range is not aligned to the cache line.
+ * The CPU never writes the range. Then, the lines inside the range are never dirty, and the clean
+ * costs nothing there.
+ */
+inline void InvalidateDCache(const void *address, size_t size) {
+#if AUDIO_HAS_DCACHE
+    const uintptr_t start = reinterpret_cast<uintptr_t>(address) & ~(kCacheLineSize - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(address) + size;
+    SCB_CleanInvalidateDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+#else
+    (void) address;
+    (void) size;
+#endif
+}
+
+/**
+ * @brief Configure the .nocache_bss section as non-cacheable by the MPU.
+ * @details
+ * Call at the beginning of InitPlatform(), before any variable in the region is used.
+ * The region is the normal memory, non-cacheable, non-shareable and not executable.
+ * The MPU region 7, which has the highest priority, is used. The other memory keeps
+ * the default memory map.
+ */
+inline void ConfigureNonCacheableRegion() {
+#if AUDIO_HAS_DCACHE
+    const uint32_t base = reinterpret_cast<uint32_t>(&_snocache_region);
+    const uint32_t size = reinterpret_cast<uint32_t>(&_enocache_region) - base;
+    if (size == 0)
+        return;
+
+    MPU_Region_InitTypeDef region;
+    region.Enable = MPU_REGION_ENABLE;
+    region.Number = MPU_REGION_NUMBER7;
+    region.BaseAddress = base;
+    region.Size = static_cast<uint8_t>(31 - __builtin_clz(size) - 1);   // 2^(Size+1) byte.
+    region.SubRegionDisable = 0x00;
+    region.TypeExtField = MPU_TEX_LEVEL1;
+    region.AccessPermission = MPU_REGION_FULL_ACCESS;
+    region.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+    region.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    region.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+    region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+
+    HAL_MPU_Disable();
+    HAL_MPU_ConfigRegion(&region);
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+    // Drop the lines cached before the configuration.
+    SCB_CleanInvalidateDCache_by_Addr(reinterpret_cast<uint32_t*>(base), static_cast<int32_t>(size));
+#endif
+}
+
+/**
+ * @brief Cost of a block transfer by the each way of the coherency.
+ * @details
+ * All values are the minimum cycles of the block, measured by the cycle counter. The minimum is
+ * free from the interrupts.
+ */
+struct CoherencyCost {
+    uint32_t whole_buffer;      ///< Cached SRAM. Whole TX and RX buffers are maintained at each block.
+    uint32_t non_cacheable;     ///< MPU non-cacheable SRAM. No maintenance.
+    uint32_t tcm;               ///< DTCM. No maintenance.
+};
+
+/**
+ * @brief Comparison of the ways of the DMA cache coherency.
+ * @details
+ * Emulates the CPU side of the block exchange of the port adapter. That is, the CPU writes a block
+ * to the TX half, reads a block from the RX half, and maintains the cache as the murasaki port
+ * adapters do on the cached SRAM.
+ * The samples are 32bit stereo. Each buffer has two halves of the given channel length.
+ *
+ * The DMA is not running during the measurement. Then, the result shows the cost of the CPU only.
+ * The bus contention by the DMA is not included.
+ *
+ * Define AUDIO_CONFIG_COHERENCY_BENCHMARK as true in the platform_config.hpp to run it
+ * at the start of the platform.
+ */
+class CoherencyBenchmark {
+ public:
+    /**
+     * @brief Buffers of a way. Each has 4 x channel_length words.
+     */
+    struct Buffers {
+        int32_t *tx;
+        int32_t *rx;
+    };
+
+    /**
+     * @brief Constructor.
+     * @param channel_length Number of the samples per channel in a block.
+     * @param cycle_counter Function returning the current cycle counter.
+     */
+    CoherencyBenchmark(unsigned int channel_length, unsigned int (*cycle_counter)())
+            : channel_length_(channel_length),
+              now_(cycle_counter) {
+    }
+
+    /**
+     * @brief Measure all ways.
+     * @param cached Buffers in the cached SRAM.
+     * @param non_cacheable Buffers in the non-cacheable region.
+     * @param tcm Buffers in the DTCM.
+     * @param iterations Number of the measured blocks per way.
+     * @return Cost of each way.
+     */
+    CoherencyCost Run(const Buffers &cached, const Buffers &non_cacheable, const Buffers &tcm, unsigned int iterations) {
+        CoherencyCost cost;
+        cost.whole_buffer = Measure(cached, true, iterations);
+        cost.non_cacheable = Measure(non_cacheable, false, iterations);
+        cost.tcm = Measure(tcm, false, iterations);
+        return cost;
+    }
+
+ private:
+    // Write and read a block, with or without the cache maintenance of the whole buffers.
+    uint32_t Measure(const Buffers &buffers, bool is_maintained, unsigned int iterations) {
+        const unsigned int half_words = channel_length_ * 2;     // Stereo.
+        const size_t half_size = half_words * sizeof(int32_t);
+        volatile int32_t sink = 0;   // Keep the reads.
+        uint32_t min = UINT32_MAX;
+
+        for (unsigned int i = 0; i < iterations; i++) {
+            const unsigned int half = i & 1;
+            const uint32_t begin = now_();
+
+            if (is_maintained)
+                InvalidateDCache(buffers.rx, half_size * 2);
+
+            int32_t *const tx_half = buffers.tx + half * half_words;
+            const int32_t *const rx_half = buffers.rx + half * half_words;
+            int32_t sum = 0;
+            for (unsigned int j = 0; j < half_words; j++) {
+                tx_half[j] = static_cast<int32_t>(j);
+                sum += rx_half[j];
+            }
+
+            if (is_maintained)
+                CleanDCache(buffers.tx, half_size * 2);
+
+            const uint32_t elapsed = now_() - begin;
+            sink = sum;
+            if (elapsed < min)
+                min = elapsed;
+        }
+        (void) sink;
+        return min;
+    }
+
+    const unsigned int channel_length_;
+    unsigned int (*const now_)();
+};
+
+} /* namespace audio */
+
+#endif /* DMACOHERENCY_HPP_ */
@@ -0,0 +1,93 @@
+/**
+ * @file doublebuffer.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Double buffer to hand the coefficients to the audio task.
+ */
+
+#ifndef DOUBLEBUFFER_HPP_
+#define DOUBLEBUFFER_HPP_
+
+#include <atomic>
+
+namespace audio {
+
+/**
+ * @brief Two banks of T. The audio task reads one, while the other task writes the other.
+ * @details
+ * The writer is a task other than the audio task. It writes the back bank between BeginWrite() and
+ * EndWrite(). Then, the bank is pending until the audio task calls Update() at the block boundary.
+ * Update() swaps the banks. Then, a block is never processed by a half written bank.
+ *
+ * BeginWrite() fails while the previous bank is pending. The writer retries later. Neither side
+ * waits for the other. Then, there is no lock and no priority inversion.
+ *
+ * Only one writer and one reader are allowed.
+ */
+template<typename T>
+class DoubleBuffer {
+ public:
+    /**
+     * @param front Initial value of the bank used by the reader.
+     * @param back Initial value of the bank written by the writer.
+     */
+    DoubleBuffer(const T &front, const T &back)
+            : bank_{ front, back },
+              front_(0),
+              pending_(false) {
+    }
+
+    /**
+     * @brief Start writing the back bank.
+     * @return The back bank. nullptr if the previous bank is not taken by the reader yet.
+     * @details
+     * Called by the writer.
+     */
+    T* BeginWrite() {
+        if (pending_.load(std::memory_order_acquire))
+            return nullptr;
+        return &bank_[front_ ^ 1];
+    }
+
+    /**
+     * @brief Hand the back bank to the reader.
+     * @details
+     * Called by the writer after BeginWrite() succeeded.
+     */
+    void EndWrite() {
+        pending_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Take the pending bank, if any.
+     * @return true if the banks are swapped.
+     * @details
+     * Called by the reader at the block boundary.
+     */
+    bool Update() {
+        if (!pending_.load(std::memory_order_acquire))
+            return false;
+        front_ ^= 1;
+        pending_.store(false, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return The bank used by the reader.
+     */
+    const T& Front() const {
+        return bank_[front_];
+    }
+
+ private:
+    T bank_[2];
+    // Index of the bank used by the reader. Changed by the reader only while pending_ is true.
+    unsigned int front_;
+    // True while the back bank is waiting for the reader.
+    std::atomic<bool> pending_;
+};
+
+} /* namespace audio */
+
+#endif /* DOUBLEBUFFER_HPP_ */
@@ -0,0 +1,310 @@
+/**
+ * @file dynamics.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Stereo linked compressor and brickwall limiter with lookahead.
+ */
+
+#ifndef DYNAMICS_HPP_
+#define DYNAMICS_HPP_
+
+#include <math.h>
+
+#include "audioprocessor.hpp"
+#include "fastmath.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Compressor and brickwall limiter.
+ * @details
+ * Both channels get the same gain, from the larger absolute value of the left and right sample.
+ * Then, the stereo image doesn't move by the gain change. The gain is computed in the log2 domain
+ * by FastLog2() and FastExp2().
+ *
+ * The compressor has the hard knee static curve, and the gain is smoothed by the attack and release.
+ *
+ * The limiter looks ahead the input by the delay line. The gain reduction needed by each sample is
+ * held for lookahead + 1 samples by the sliding minimum, and then averaged over lookahead + 1 samples.
+ * The averaged gain reaches the needed reduction when the sample comes out of the delay line. Then,
+ * the output never exceeds the ceiling, while the gain changes smoothly. The compressor gain is
+ * delayed together with the sample, to limit the output of the compressor.
+ *
+ * The block is processed by the chunks of kChunk samples. Level detection, the static curve and
+ * the gain application are separated loops over the chunk, without dependency between the samples.
+ * Only the smoothing and the lookahead are the sample by sample loop.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats. The latency is
+ * lookahead samples.
+ *
+ * The setters are not synchronized with Process(). Call them before the audio starts, or from
+ * the audio task between the blocks.
+ */
+class DynamicsProcessor final : public FloatProcessor {
+ public:
+    /**
+     * @brief Number of the samples processed by a loop.
+     */
+    static const unsigned int kChunk = 32;
+
+    /**
+     * @brief Number of the floats of the storage.
+     * @param lookahead Number of the samples of the lookahead.
+     */
+    static constexpr unsigned int StorageSize(unsigned int lookahead) {
+        return 3 * lookahead             // Delay line of left, right and the compressor gain.
+        + 2 * (lookahead + 1)            // Sliding minimum. Value and position.
+        + (lookahead + 1);               // Moving average.
+    }
+
+    /**
+     * @brief Constructor.
+     * @param lookahead Number of the samples of the lookahead. 1 or more.
+     * @param sample_rate Sampling frequency [Hz].
+     * @param storage Memory of StorageSize(lookahead) floats. Not owned.
+     * @details
+     * The compressor is off, and the limiter ceiling is 0dBFS.
+     */
+    DynamicsProcessor(unsigned int lookahead, float sample_rate, float *storage)
+            : lookahead_(lookahead),
+              sample_rate_(sample_rate),
+              delay_line_(storage),
+              minimum_value_(storage + 3 * lookahead),
+              minimum_position_(minimum_value_ + lookahead + 1),
+              average_(minimum_position_ + lookahead + 1),
+              average_scale_(1.0f / (lookahead + 1)),
+              threshold_(0.0f),
+              slope_(0.0f),
+              attack_(0.0f),
+              release_(0.0f),
+              makeup_(0.0f),
+              ceiling_(0.0f),
+              limiter_release_(0.0f),
+              attack_time_(0.0f),
+              release_time_(0.0f),
+              limiter_release_time_(0.0f) {
+        MURASAKI_ASSERT(0 != lookahead)
+        MURASAKI_ASSERT(nullptr != storage)
+
+        SetCompressor(0.0f, 1.0f, 0.005f, 0.1f, 0.0f);
+        SetLimiter(0.0f, 0.05f);
+        Reset();
+    }
+
+    /**
+     * @brief Set the compressor.
+     * @param threshold Threshold level [dBFS].
+     * @param ratio Compression ratio above the threshold. 1 is off.
+     * @param attack Time constant of the gain reduction [S].
+     * @param release Time constant of the gain recovery [S].
+     * @param makeup Gain after the compression [dB].
+     * @details
+     * This function uses the math library. Call it from a task other than the audio task.
+     */
+    void SetCompressor(float threshold, float ratio, float attack, float release, float makeup) {
+        MURASAKI_ASSERT(ratio >= 1.0f)
+        threshold_ = threshold / kDecibelPerLog2;
+        slope_ = 1.0f - 1.0f / ratio;
+        attack_time_ = attack;
+        release_time_ = release;
+        attack_ = TimeConstant(attack);
+        release_ = TimeConstant(release);
+        makeup_ = makeup / kDecibelPerLog2;
+    }
+
+    /**
+     * @brief Set the limiter.
+     * @param ceiling Maximum output level [dBFS].
+     * @param release Time constant of the gain recovery [S].
+     * @details
+     * This function uses the math library. Call it from a task other than the audio task.
+     */
+    void SetLimiter(float ceiling, float release) {
+        ceiling_ = ceiling / kDecibelPerLog2 - kApproximationMargin;
+        limiter_release_time_ = release;
+        limiter_release_ = TimeConstant(release);
+    }
+
+    /**
+     * @brief Change the sampling frequency.
+     * @param sample_rate Sampling frequency [Hz].
+     * @details
+     * The time constants are computed again for the new frequency. This function uses the math library.
+     */
+    void SetSampleRate(float sample_rate) {
+        sample_rate_ = sample_rate;
+        attack_ = TimeConstant(attack_time_);
+        release_ = TimeConstant(release_time_);
+        limiter_release_ = TimeConstant(limiter_release_time_);
+    }
+
+    /**
+     * @brief Clear the state.
+     */
+    void Reset() {
+        for (unsigned int i = 0; i < 3 * lookahead_; i++)
+            delay_line_[i] = 0.0f;
+        for (unsigned int i = 0; i < lookahead_ + 1; i++)
+            average_[i] = 0.0f;
+        delay_position_ = 0;
+        window_position_ = 0;
+        minimum_head_ = 0;
+        minimum_count_ = 0;
+        average_sum_ = 0.0f;
+        compressor_gain_ = 0.0f;
+        limiter_gain_ = 0.0f;
+    }
+
+    /**
+     * @return Number of the samples of the latency.
+     */
+    unsigned int Latency() const {
+        return lookahead_;
+    }
+
+    AUDIO_ITCM_KERNEL(dynamics_process) virtual void Process(const StereoBlock<float> &block) {
+        const unsigned int length = block.Length();
+
+        for (unsigned int offset = 0; offset < length; offset += kChunk) {
+            const unsigned int count = (length - offset < kChunk) ? length - offset : kChunk;
+
+            // Stereo linked peak level in log2.
+            for (unsigned int i = 0; i < count; i++) {
+                const float peak = fmaxf(fmaxf(fabsf(block.left[offset + i]), fabsf(block.right[offset + i])), kFloor);
+                level_[i] = FastLog2(peak);
+            }
+
+            // Static curve of the compressor.
+            for (unsigned int i = 0; i < count; i++)
+                gain_[i] = fminf(0.0f, (threshold_ - level_[i]) * slope_);
+
+            // Smoothing and lookahead. gain_ receives the gain of the delayed sample.
+            for (unsigned int i = 0; i < count; i++) {
+                const float target = gain_[i];
+                compressor_gain_ = target + ((target < compressor_gain_) ? attack_ : release_) * (compressor_gain_ - target);
+                const float compressor = compressor_gain_ + makeup_;
+
+                // Reduction to keep the output of the compressor under the ceiling.
+                const float needed = fmaxf(fminf(0.0f, ceiling_ - (level_[i] + compressor)), kMinimumGain);
+                const float held = SlidingMinimum(needed);
+                limiter_gain_ = (held < limiter_gain_) ? held : held + limiter_release_ * (limiter_gain_ - held);
+                const float limiter = MovingAverage(limiter_gain_);
+
+                // Exchange the sample with the delay line.
+                float *const slot = delay_line_ + 3 * delay_position_;
+                const float left = slot[0], right = slot[1], delayed_compressor = slot[2];
+                slot[0] = block.left[offset + i];
+                slot[1] = block.right[offset + i];
+                slot[2] = compressor;
+                delay_position_ = (delay_position_ + 1 == lookahead_) ? 0 : delay_position_ + 1;
+
+                block.left[offset + i] = left;
+                block.right[offset + i] = right;
+                gain_[i] = delayed_compressor + limiter;
+            }
+
+            // Apply the gain.
+            for (unsigned int i = 0; i < count; i++) {
+                const float gain = FastExp2(gain_[i]);
+                block.left[offset + i] *= gain;
+                block.right[offset + i] *= gain;
+            }
+        }
+    }
+
+ private:
+    // Level of the silence, to avoid the log of zero. -240dBFS.
+    static constexpr float kFloor = 1e-12f;
+    // Maximum gain reduction of the limiter in log2. -120dB.
+    static constexpr float kMinimumGain = -20.0f;
+    // Error of FastLog2() and FastExp2() in log2, subtracted from the ceiling.
+    static constexpr float kApproximationMargin = 2.5e-4f;
+
+    // Coefficient of the one pole smoothing.
+    float TimeConstant(float time) const {
+        return (time <= 0.0f) ? 0.0f : expf(-1.0f / (time * sample_rate_));
+    }
+
+    // Minimum of the last lookahead + 1 values, by the monotonic queue.
+    // The queue holds the ascending values with their position in the window.
+    float SlidingMinimum(float value) {
+        const unsigned int window = lookahead_ + 1;
+
+        // Drop the value which leaves the window. It was at this position.
+        if (minimum_count_ != 0 && minimum_position_[minimum_head_] == static_cast<float>(window_position_)) {
+            minimum_head_ = (minimum_head_ + 1 == window) ? 0 : minimum_head_ + 1;
+            minimum_count_--;
+        }
+        // Drop the values not smaller than the new one. They never be the minimum.
+        while (minimum_count_ != 0) {
+            unsigned int tail = minimum_head_ + minimum_count_ - 1;
+            tail = (tail >= window) ? tail - window : tail;
+            if (minimum_value_[tail] < value)
+                break;
+            minimum_count_--;
+        }
+        unsigned int tail = minimum_head_ + minimum_count_;
+        tail = (tail >= window) ? tail - window : tail;
+        minimum_value_[tail] = value;
+        minimum_position_[tail] = static_cast<float>(window_position_);
+        minimum_count_++;
+
+        window_position_ = (window_position_ + 1 == window) ? 0 : window_position_ + 1;
+        return minimum_value_[minimum_head_];
+    }
+
+    // Average of the last lookahead + 1 values. Shares the position with SlidingMinimum().
+    float MovingAverage(float value) {
+        const unsigned int position = (window_position_ == 0) ? lookahead_ : window_position_ - 1;
+        average_sum_ += value - average_[position];
+        average_[position] = value;
+        // Sum again at each round, not to accumulate the rounding error.
+        if (position == lookahead_) {
+            average_sum_ = 0.0f;
+            for (unsigned int i = 0; i <= lookahead_; i++)
+                average_sum_ += average_[i];
+        }
+        return average_sum_ * average_scale_;
+    }
+
+    const unsigned int lookahead_;
+    float sample_rate_;
+    float *const delay_line_;          // lookahead x (left, right, compressor gain).
+    float *const minimum_value_;       // lookahead + 1.
+    float *const minimum_position_;    // lookahead + 1.
+    float *const average_;             // lookahead + 1.
+    const float average_scale_;
+
+    // Parameters. Levels and gains are in log2.
+    float threshold_;
+    float slope_;
+    float attack_;
+    float release_;
+    float makeup_;
+    float ceiling_;
+    float limiter_release_;
+    // Times of the time constants [S].
+    float attack_time_;
+    float release_time_;
+    float limiter_release_time_;
+
+    // State.
+    unsigned int delay_position_;
+    unsigned int window_position_;
+    unsigned int minimum_head_;
+    unsigned int minimum_count_;
+    float average_sum_;
+    float compressor_gain_;
+    float limiter_gain_;
+
+    // Work area of a chunk.
+    float level_[kChunk];
+    float gain_[kChunk];
+};
+
+} /* namespace audio */
+
+#endif /* DYNAMICS_HPP_ */
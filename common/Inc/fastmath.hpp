@@ -0,0 +1,69 @@
+/**
+ * @file fastmath.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Polynomial approximation of log2 and exp2 for the audio task.
+ * @details
+ * logf() and expf() of the library take several tens of cycles on the Cortex-M, and their time
+ * depends on the argument. These functions split the float into the exponent and the mantissa by
+ * the bit operation, and approximate the mantissa part by a 4th order polynomial. They have no branch
+ * except the clamp, and the loops calling them can be vectorized on the host.
+ *
+ * The polynomials are the minimax fit of the interval, with the exact value at the both ends.
+ * Then, the results are exact and continuous at the powers of 2. For example, FastExp2(0) is 1.
+ * @li FastLog2 : Absolute error 1.2e-4, that is 0.0007 dB.
+ * @li FastExp2 : Relative error 5e-6.
+ */
+
+#ifndef FASTMATH_HPP_
+#define FASTMATH_HPP_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace audio {
+
+/**
+ * @brief Approximation of log2(x).
+ * @param x Positive and normalized number. Zero, negative and denormal number are not allowed.
+ */
+inline float FastLog2(float x) {
+    uint32_t bits;
+    ::memcpy(&bits, &x, sizeof(bits));
+    const float exponent = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+
+    // Mantissa in [1, 2). log2(1 + t) for t in [0, 1).
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    ::memcpy(&m, &bits, sizeof(m));
+    const float t = m - 1.0f;
+    return exponent + (1.4387256f + (-0.67778295f + (0.32118727f - 0.082129882f * t) * t) * t) * t;
+}
+
+/**
+ * @brief Approximation of 2^x.
+ * @param x Exponent. Clamped into [-126, 127].
+ */
+inline float FastExp2(float x) {
+    x = (x < -126.0f) ? -126.0f : (x > 127.0f ? 127.0f : x);
+
+    // Integer part toward minus infinity, and the fraction in [0, 1).
+    int32_t integer = static_cast<int32_t>(x);
+    integer -= (x < static_cast<float>(integer)) ? 1 : 0;
+    const float f = x - static_cast<float>(integer);
+
+    const uint32_t bits = static_cast<uint32_t>(integer + 127) << 23;
+    float scale;
+    ::memcpy(&scale, &bits, sizeof(scale));
+    return scale * (1.0f + (0.69300392f + (0.24154981f + (0.051744272f + 0.013701992f * f) * f) * f) * f);
+}
+
+/**
+ * @brief Decibel of the amplitude per unit of log2. 20 log10(2).
+ */
+const float kDecibelPerLog2 = 6.0205999f;
+
+} /* namespace audio */
+
+#endif /* FASTMATH_HPP_ */
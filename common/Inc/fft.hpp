@@ -0,0 +1,320 @@
+/**
+ * @file fft.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief In-place complex and real FFT.
+ * @details
+ * The twiddle factors are computed by the compiler into a constexpr table. Then, the table is
+ * placed in the flash, and neither the constructor nor the transform uses the math library or the heap.
+ * All sizes share the table of kMaxFftSize points by the stride access.
+ */
+
+#ifndef FFT_HPP_
+#define FFT_HPP_
+
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Maximum number of the points of the complex and real FFT.
+ */
+const unsigned int kMaxFftSize = 2048;
+
+namespace fftdetail {
+
+// Sine and cosine evaluated by the compiler.
+// Taylor series in double. x must be in [0, pi]. Accurate enough for the float table.
+
+constexpr double kPi = 3.14159265358979323846;
+
+constexpr double Series(double x, bool is_sine) {
+    double term = is_sine ? x : 1.0;
+    double sum = term;
+    for (int n = is_sine ? 3 : 2; n < 40; n += 2) {
+        term *= -x * x / ((n - 1) * n);
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double Sine(double x) {
+    return Series(x > kPi / 2 ? kPi - x : x, true);
+}
+
+constexpr double Cosine(double x) {
+    return x > kPi / 2 ? -Series(kPi - x, false) : Series(x, false);
+}
+
+}  // namespace fftdetail
+
+/**
+ * @brief Table of exp(-j 2 pi k / kMaxFftSize) for k = 0 to kMaxFftSize / 2 - 1, as re, im.
+ */
+struct FftTwiddleTable {
+    float value[kMaxFftSize];
+
+    constexpr FftTwiddleTable()
+            : value() {
+        for (unsigned int k = 0; k < kMaxFftSize / 2; k++) {
+            const double angle = 2.0 * fftdetail::kPi * k / kMaxFftSize;
+            value[2 * k] = static_cast<float>(fftdetail::Cosine(angle));
+            value[2 * k + 1] = static_cast<float>(-fftdetail::Sine(angle));
+        }
+    }
+};
+
+/**
+ * @brief Twiddle factors in the flash.
+ */
+constexpr FftTwiddleTable kFftTwiddle = FftTwiddleTable();
+
+/**
+ * @brief In-place complex FFT.
+ * @details
+ * The data is the array of the complex numbers, interleaved as re, im, re, im, ...
+ * Neither the forward nor the inverse transform is scaled. That is, Inverse(Forward(x)) is N x x.
+ *
+ * The butterflies are radix-4, made of two radix-2 stages. Then, the input is permuted by the
+ * bit reversal, as like the radix-2. If the number of the radix-2 stages is odd, the first stage is radix-2.
+ */
+class Fft {
+ public:
+    /**
+     * @brief Constructor.
+     * @param size Number of the points. Power of 2, from 2 to kMaxFftSize.
+     */
+    explicit Fft(unsigned int size)
+            : size_(size),
+              stride_(kMaxFftSize / size) {
+        MURASAKI_ASSERT(size >= 2 && size <= kMaxFftSize && (size & (size - 1)) == 0)
+    }
+
+    /**
+     * @brief Forward transform in place.
+     * @param data size complex numbers.
+     */
+    void Forward(float *data) const {
+        Transform(data, 1.0f);
+    }
+
+    /**
+     * @brief Inverse transform in place. Not scaled.
+     * @param data size complex numbers.
+     */
+    void Inverse(float *data) const {
+        Transform(data, -1.0f);
+    }
+
+    /**
+     * @return Number of the points.
+     */
+    unsigned int Size() const {
+        return size_;
+    }
+
+ private:
+    // W^e of the size points, where W = exp(-j 2 pi / size). e is 0 to size x 3 / 4.
+    void Twiddle(unsigned int e, float sign, float *wr, float *wi) const {
+        unsigned int index = e * stride_;
+        float polarity = 1.0f;
+        if (index >= kMaxFftSize / 2) {    // W^(N/2) = -1.
+            index -= kMaxFftSize / 2;
+            polarity = -1.0f;
+        }
+        *wr = polarity * kFftTwiddle.value[2 * index];
+        *wi = polarity * sign * kFftTwiddle.value[2 * index + 1];
+    }
+
+    // sign is 1 for the forward, -1 for the inverse.
+    AUDIO_ITCM_KERNEL(fft_transform) void Transform(float *data, float sign) const {
+        const unsigned int n = size_;
+
+        // Bit reversal permutation.
+        for (unsigned int i = 1, j = 0; i < n; i++) {
+            unsigned int bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j |= bit;
+            if (i < j) {
+                float t = data[2 * i];
+                data[2 * i] = data[2 * j];
+                data[2 * j] = t;
+                t = data[2 * i + 1];
+                data[2 * i + 1] = data[2 * j + 1];
+                data[2 * j + 1] = t;
+            }
+        }
+
+        // Radix-2 stage, if the number of the stages is odd. The twiddle factor is 1.
+        unsigned int span = 1;
+        if (__builtin_ctz(n) & 1) {
+            for (unsigned int i = 0; i < n; i += 2) {
+                float *const a = data + 2 * i;
+                const float br = a[2], bi = a[3];
+                a[2] = a[0] - br;
+                a[3] = a[1] - bi;
+                a[0] += br;
+                a[1] += bi;
+            }
+            span = 2;
+        }
+
+        // Radix-4 stages. Each combines 4 transforms of span points into a transform of 4 x span points.
+        // In the bit reversed order, the 4 transforms are of the samples 0, 2, 1 and 3 modulo 4.
+        for (; span < n; span *= 4) {
+            const unsigned int length = 4 * span;
+            const unsigned int step = n / length;    // W of the length points is W^step of the n points.
+            for (unsigned int k = 0; k < span; k++) {
+                float w1r, w1i, w2r, w2i, w3r, w3i;
+                Twiddle(k * step, sign, &w1r, &w1i);
+                Twiddle(2 * k * step, sign, &w2r, &w2i);
+                Twiddle(3 * k * step, sign, &w3r, &w3i);
+
+                for (unsigned int g = k; g < n; g += length) {
+                    float *const a = data + 2 * g;
+                    float *const b = a + 2 * span;
+                    float *const c = b + 2 * span;
+                    float *const d = c + 2 * span;
+
+                    const float t0r = a[0], t0i = a[1];
+                    const float t1r = c[0] * w1r - c[1] * w1i, t1i = c[0] * w1i + c[1] * w1r;
+                    const float t2r = b[0] * w2r - b[1] * w2i, t2i = b[0] * w2i + b[1] * w2r;
+                    const float t3r = d[0] * w3r - d[1] * w3i, t3i = d[0] * w3i + d[1] * w3r;
+
+                    const float sr = t0r + t2r, si = t0i + t2i;      // t0 + t2
+                    const float dr = t0r - t2r, di = t0i - t2i;      // t0 - t2
+                    const float pr = t1r + t3r, pi = t1i + t3i;      // t1 + t3
+                    // -j sign (t1 - t3)
+                    const float mr = sign * (t1i - t3i), mi = -sign * (t1r - t3r);
+
+                    a[0] = sr + pr;
+                    a[1] = si + pi;
+                    b[0] = dr + mr;
+                    b[1] = di + mi;
+                    c[0] = sr - pr;
+                    c[1] = si - pi;
+                    d[0] = dr - mr;
+                    d[1] = di - mi;
+                }
+            }
+        }
+    }
+
+    const unsigned int size_;
+    const unsigned int stride_;
+};
+
+/**
+ * @brief In-place FFT of the real signal.
+ * @details
+ * The N real samples are transformed as N / 2 complex numbers by Fft, and separated into the
+ * spectrum of the real signal. The spectrum is conjugate symmetric. Then, the bins 0 to N / 2 are
+ * packed into the N floats as below.
+ * @li data[0] : Re X[0]. The imaginary part is 0.
+ * @li data[1] : Re X[N / 2]. The imaginary part is 0.
+ * @li data[2k], data[2k + 1] : Re X[k], Im X[k] for k = 1 to N / 2 - 1.
+ *
+ * Neither the forward nor the inverse transform is scaled. That is, Inverse(Forward(x)) is N x x.
+ */
+class RealFft {
+ public:
+    /**
+     * @brief Constructor.
+     * @param size Number of the real samples. Power of 2, from 4 to kMaxFftSize.
+     */
+    explicit RealFft(unsigned int size)
+            : size_(size),
+              stride_(kMaxFftSize / size),
+              fft_(size / 2) {
+        MURASAKI_ASSERT(size >= 4 && size <= kMaxFftSize)
+    }
+
+    /**
+     * @brief Forward transform in place.
+     * @param data size real samples. Receives the packed spectrum.
+     */
+    void Forward(float *data) const {
+        const unsigned int m = size_ / 2;
+
+        // The even and odd samples are the real and imaginary part.
+        fft_.Forward(data);
+
+        const float z0r = data[0];
+        data[0] = z0r + data[1];
+        data[1] = z0r - data[1];
+
+        for (unsigned int k = 1; k <= m / 2; k++) {
+            float *const a = data + 2 * k;
+            float *const b = data + 2 * (m - k);
+            // E = (Z[k] + conj(Z[m - k])) / 2, O = (Z[k] - conj(Z[m - k])) / 2
+            const float er = 0.5f * (a[0] + b[0]), ei = 0.5f * (a[1] - b[1]);
+            const float or_ = 0.5f * (a[0] - b[0]), oi = 0.5f * (a[1] + b[1]);
+            float wr, wi;
+            Twiddle(k, &wr, &wi);
+            const float tr = or_ * wr - oi * wi, ti = or_ * wi + oi * wr;    // T = W^k O
+
+            // X[k] = E - j T, X[m - k] = conj(E + j T)
+            a[0] = er + ti;
+            a[1] = ei - tr;
+            b[0] = er - ti;
+            b[1] = -(ei + tr);
+        }
+    }
+
+    /**
+     * @brief Inverse transform in place. Not scaled.
+     * @param data Packed spectrum. Receives size real samples.
+     */
+    void Inverse(float *data) const {
+        const unsigned int m = size_ / 2;
+
+        const float x0 = data[0];
+        data[0] = x0 + data[1];
+        data[1] = x0 - data[1];
+
+        for (unsigned int k = 1; k <= m / 2; k++) {
+            float *const a = data + 2 * k;
+            float *const b = data + 2 * (m - k);
+            // 2E = X[k] + conj(X[m - k]), 2 j T = conj(X[m - k]) - X[k]
+            const float er = a[0] + b[0], ei = a[1] - b[1];
+            const float jtr = b[0] - a[0], jti = -b[1] - a[1];
+            const float tr = jti, ti = -jtr;    // T = -j (j T)
+            float wr, wi;
+            Twiddle(k, &wr, &wi);
+            const float or_ = tr * wr + ti * wi, oi = ti * wr - tr * wi;    // O = conj(W^k) T
+
+            // Z[k] = E + O, Z[m - k] = conj(E - O). Both doubled.
+            a[0] = er + or_;
+            a[1] = ei + oi;
+            b[0] = er - or_;
+            b[1] = -(ei - oi);
+        }
+
+        fft_.Inverse(data);
+    }
+
+    /**
+     * @return Number of the real samples.
+     */
+    unsigned int Size() const {
+        return size_;
+    }
+
+ private:
+    // W^k of the size points, for k up to size / 4.
+    void Twiddle(unsigned int k, float *wr, float *wi) const {
+        *wr = kFftTwiddle.value[2 * k * stride_];
+        *wi = kFftTwiddle.value[2 * k * stride_ + 1];
+    }
+
+    const unsigned int size_;
+    const unsigned int stride_;
+    const Fft fft_;
+};
+
+} /* namespace audio */
+
+#endif /* FFT_HPP_ */
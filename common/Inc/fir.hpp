@@ -0,0 +1,180 @@
+/**
+ * @file fir.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Stereo block FIR filter.
+ */
+
+#ifndef FIR_HPP_
+#define FIR_HPP_
+
+#include <math.h>
+
+#include "audioprocessor.hpp"
+#include "doublebuffer.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Design a linear phase low pass FIR filter by the windowed sinc.
+ * @param coefficients Receives the taps coefficients.
+ * @param taps Number of the taps. Odd number gives the integer group delay.
+ * @param cutoff Cutoff frequency normalized by the sampling frequency. 0.0 to 0.5.
+ * @details
+ * Hamming window. The DC gain is normalized to 1. This function uses the math library.
+ * Call it from a task other than the audio task.
+ */
+inline void DesignFirLowPass(float *coefficients, unsigned int taps, float cutoff) {
+    const float center = (taps - 1) / 2.0f;
+    const float pi = 3.14159265f;
+    float sum = 0.0f;
+
+    for (unsigned int i = 0; i < taps; i++) {
+        const float t = i - center;
+        const float sinc = (t == 0.0f) ? 2.0f * cutoff : sinf(2.0f * pi * cutoff * t) / (pi * t);
+        const float window = (taps == 1) ? 1.0f : 0.54f - 0.46f * cosf(2.0f * pi * i / (taps - 1));
+        coefficients[i] = sinc * window;
+        sum += coefficients[i];
+    }
+    for (unsigned int i = 0; i < taps; i++)
+        coefficients[i] /= sum;
+}
+
+/**
+ * @brief Stereo FIR filter with the double length state buffer.
+ * @details
+ * Both channels have the same coefficients. The filter keeps the last taps samples of each
+ * channel in a circular buffer. Each sample is written twice, at the position and at the position
+ * + taps. Then, the last taps samples are always contiguous from the write position, and the inner
+ * loop has no modulo indexing.
+ *
+ * The inner loop processes the left and right channel together. A coefficient is loaded once for
+ * the two multiply-accumulates, and the loop is unrolled by two taps with separated accumulators.
+ * The compiler generates the dual issue friendly code for the Cortex-M7, and the FPU of the
+ * Cortex-M4 is kept busy.
+ *
+ * The memory is given by the caller. Then, the memory can be placed in the DTCM or in the static
+ * storage. StorageSize() gives the number of the floats.
+ *
+ * The coefficients are double buffered by audio::DoubleBuffer, as like audio::BiquadCascade.
+ * SetCoefficients() is called from a task other than the audio task, at any time.
+ */
+class FirFilter final : public FloatProcessor {
+ public:
+    /**
+     * @brief Number of the floats of the storage.
+     * @param taps Number of the taps.
+     */
+    static constexpr unsigned int StorageSize(unsigned int taps) {
+        return 2 * taps + 2 * 2 * taps;   // Two banks of coefficients, and double length state of two channels.
+    }
+
+    /**
+     * @brief Constructor.
+     * @param taps Number of the taps. 1 or more.
+     * @param storage Memory of StorageSize(taps) floats. Not owned.
+     * @details
+     * The coefficients are initialized as a unit impulse. That is, pass through.
+     */
+    FirFilter(unsigned int taps, float *storage)
+            : taps_(taps),
+              banks_(storage, storage + taps),
+              left_(storage + 2 * taps),
+              right_(storage + 4 * taps),
+              position_(0) {
+        MURASAKI_ASSERT(0 != taps)
+        MURASAKI_ASSERT(nullptr != storage)
+
+        for (unsigned int i = 0; i < 2 * taps_; i++)
+            storage[i] = 0.0f;
+        storage[0] = 1.0f;
+        storage[taps_] = 1.0f;
+        Reset();
+    }
+
+    /**
+     * @brief Hand the new coefficients to the audio task.
+     * @param coefficients Array of the taps coefficients. Copied.
+     * @return false if the previous coefficients are not taken by the audio task yet. Retry later.
+     * @details
+     * Called from a task other than the audio task, or before the audio starts. Never blocks.
+     */
+    bool SetCoefficients(const float *coefficients) {
+        float *const *const bank = banks_.BeginWrite();
+        if (nullptr == bank)
+            return false;
+
+        for (unsigned int i = 0; i < taps_; i++)
+            (*bank)[i] = coefficients[i];
+
+        banks_.EndWrite();
+        return true;
+    }
+
+    /**
+     * @brief Clear the state.
+     */
+    void Reset() {
+        for (unsigned int i = 0; i < 2 * taps_; i++) {
+            left_[i] = 0.0f;
+            right_[i] = 0.0f;
+        }
+        position_ = 0;
+    }
+
+    /**
+     * @return Number of the taps.
+     */
+    unsigned int Taps() const {
+        return taps_;
+    }
+
+    AUDIO_ITCM_KERNEL(fir_process) virtual void Process(const StereoBlock<float> &block) {
+        const unsigned int length = block.Length();
+        const unsigned int pairs = taps_ / 2;
+        banks_.Update();
+        const float *const h = banks_.Front();
+
+        for (unsigned int n = 0; n < length; n++) {
+            // Step back the position. The newest sample is at the position.
+            position_ = (position_ == 0) ? taps_ - 1 : position_ - 1;
+            left_[position_] = left_[position_ + taps_] = block.left[n];
+            right_[position_] = right_[position_ + taps_] = block.right[n];
+
+            // x[n - k] is at position + k, for k = 0 to taps - 1.
+            const float *const l = left_ + position_;
+            const float *const r = right_ + position_;
+            float l0 = 0.0f, l1 = 0.0f;
+            float r0 = 0.0f, r1 = 0.0f;
+            for (unsigned int k = 0; k < pairs * 2; k += 2) {
+                const float h0 = h[k];
+                const float h1 = h[k + 1];
+                l0 += h0 * l[k];
+                r0 += h0 * r[k];
+                l1 += h1 * l[k + 1];
+                r1 += h1 * r[k + 1];
+            }
+            if (taps_ & 1) {
+                l0 += h[taps_ - 1] * l[taps_ - 1];
+                r0 += h[taps_ - 1] * r[taps_ - 1];
+            }
+
+            block.left[n] = l0 + l1;
+            block.right[n] = r0 + r1;
+        }
+    }
+
+ private:
+    const unsigned int taps_;
+    DoubleBuffer<float*> banks_;    // Two banks of taps coefficients.
+    float *const left_;      // 2 x taps.
+    float *const right_;     // 2 x taps.
+    unsigned int position_;
+};
+
+} /* namespace audio */
+
+#endif /* FIR_HPP_ */
@@ -0,0 +1,287 @@
+/**
+ * @file interruptaudio.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Audio processing in the DMA interrupt, without the audio task.
+ */
+
+#ifndef INTERRUPTAUDIO_HPP_
+#define INTERRUPTAUDIO_HPP_
+
+#include <stdint.h>
+
+#include "audioblock.hpp"
+#include "murasaki.hpp"
+#include "q31.hpp"
+
+// Define as true to process the audio in the DMA interrupt by audio::InterruptAudio, instead of the
+// audio task with murasaki::DuplexAudio.
+#ifndef AUDIO_CONFIG_INTERRUPT_AUDIO
+#define AUDIO_CONFIG_INTERRUPT_AUDIO false
+#endif
+
+// Define as true to process the blocks in Q31 by the Q31 chain, instead of the float chain.
+// The samples are taken from the DMA words without the float conversion. In the task mode, the blocks are
+// exchanged by audio::Q31BlockExchanger.
+#ifndef AUDIO_CONFIG_Q31_PROCESSING
+#define AUDIO_CONFIG_Q31_PROCESSING false
+#endif
+
+namespace audio {
+
+/**
+ * @brief Order of the 16bit halves of a 32bit sample in the DMA buffer.
+ */
+enum DmaWordOrder {
+    kdwoNative,         ///< The sample is a 32bit word. The SAI with the word DMA.
+    kdwoSwappedHalves   ///< The upper half comes first. The I2S of 32bit data by the half word DMA.
+};
+
+/**
+ * @brief Audio processing called from the half and full transfer interrupt of the circular DMA.
+ * @details
+ * The class owns the circular DMA buffers of the transmission and the reception. Each buffer has two halves
+ * of a block. Each half is the interleaved stereo block of 32bit samples. The DMA is started by the platform
+ * with TxBuffer(), RxBuffer() and DmaWords().
+ *
+ * The interrupt of the reception calls OnHalfTransfer() or OnFullTransfer(). Then, the received half is
+ * converted to float, given to the callback, and the processed block is written to the same half of
+ * the transmission buffer. The transmission DMA sends it after the other half. That is, the latency
+ * from the input to the output is 2 blocks, as like the murasaki::DuplexAudio.
+ *
+ * There is no audio task, no synchronization and no context switch. The callback runs in the interrupt
+ * context on the main stack. It must return before the next half is received. Otherwise the
+ * transmission DMA sends the half being written.
+ *
+ * The transmission and the reception must be started together, and run by the same clock.
+ * The buffers have to be accessible by the DMA. Place the storage accordingly.
+ *
+ * With the Q31 callback, the block is given in Q31. The DMA word is the Q31 sample itself, with its
+ * halves swapped by the I2S. Then, there is no conversion from and to the float. Only the halves are
+ * swapped, and the samples are deinterleaved.
+ *
+ * The memory is given by the caller. DmaStorageSize() and StorageSize() give the number of
+ * the 32bit words and the samples.
+ */
+class InterruptAudio {
+ public:
+    /**
+     * @brief Processing of a block in place.
+     */
+    typedef void (*BlockCallback)(const StereoBlock<float> &block);
+
+    /**
+     * @brief Processing of a Q31 block in place.
+     */
+    typedef void (*Q31BlockCallback)(const StereoBlock<q31_t> &block);
+
+    /**
+     * @brief Number of the 32bit words of the DMA storage.
+     * @param max_length Maximum number of the samples per channel of a block.
+     */
+    static constexpr unsigned int DmaStorageSize(unsigned int max_length) {
+        return 2 * 2 * 2 * max_length;    // Transmission and reception, 2 halves, stereo.
+    }
+
+    /**
+     * @brief Number of the samples of the storage. Float or Q31.
+     * @param max_length Maximum number of the samples per channel of a block.
+     */
+    static constexpr unsigned int StorageSize(unsigned int max_length) {
+        return 2 * max_length;    // Left and right.
+    }
+
+    /**
+     * @param callback Processing of a block. Called from the DMA interrupt.
+     * @param order Order of the halves of a sample in the DMA buffer.
+     * @param max_length Maximum number of the samples per channel of a block.
+     * @param dma_storage Memory of DmaStorageSize(max_length) words. Not owned.
+     * @param storage Memory of StorageSize(max_length) floats. Not owned.
+     * @details
+     * The block length is set to max_length. Change it by SetLength() while the DMA is stopped.
+     */
+    InterruptAudio(BlockCallback callback, DmaWordOrder order, unsigned int max_length, int32_t *dma_storage, float *storage)
+            : callback_(callback),
+              order_(order),
+              max_length_(max_length),
+              dma_storage_(dma_storage),
+              q31_callback_(nullptr),
+              storage_(storage),
+              q31_storage_(nullptr),
+              length_(0),
+              tx_(nullptr),
+              rx_(nullptr) {
+        MURASAKI_ASSERT(nullptr != callback)
+        MURASAKI_ASSERT(nullptr != dma_storage)
+        MURASAKI_ASSERT(nullptr != storage)
+        SetLength(max_length);
+    }
+
+    /**
+     * @param callback Processing of a Q31 block. Called from the DMA interrupt.
+     * @param order Order of the halves of a sample in the DMA buffer.
+     * @param max_length Maximum number of the samples per channel of a block.
+     * @param dma_storage Memory of DmaStorageSize(max_length) words. Not owned.
+     * @param storage Memory of StorageSize(max_length) samples. Not owned.
+     * @details
+     * The block length is set to max_length. Change it by SetLength() while the DMA is stopped.
+     */
+    InterruptAudio(Q31BlockCallback callback, DmaWordOrder order, unsigned int max_length, int32_t *dma_storage, q31_t *storage)
+            : callback_(nullptr),
+              order_(order),
+              max_length_(max_length),
+              dma_storage_(dma_storage),
+              q31_callback_(callback),
+              storage_(nullptr),
+              q31_storage_(storage),
+              length_(0),
+              tx_(nullptr),
+              rx_(nullptr) {
+        MURASAKI_ASSERT(nullptr != callback)
+        MURASAKI_ASSERT(nullptr != dma_storage)
+        MURASAKI_ASSERT(nullptr != storage)
+        SetLength(max_length);
+    }
+
+    /**
+     * @brief Change the block length, and clear the DMA buffers.
+     * @param length Number of the samples per channel. 1 to max_length.
+     * @details
+     * Call while the DMA is stopped.
+     */
+    void SetLength(unsigned int length) {
+        MURASAKI_ASSERT(0 < length && length <= max_length_)
+        length_ = length;
+        tx_ = dma_storage_;
+        rx_ = dma_storage_ + DmaWords();
+        for (unsigned int i = 0; i < 2 * DmaWords(); i++)
+            dma_storage_[i] = 0;
+        if (nullptr != q31_callback_) {
+            q31_block_.left = ChannelSpan<q31_t>(q31_storage_, length);
+            q31_block_.right = ChannelSpan<q31_t>(q31_storage_ + max_length_, length);
+        }
+        else {
+            block_.left = ChannelSpan<float>(storage_, length);
+            block_.right = ChannelSpan<float>(storage_ + max_length_, length);
+        }
+    }
+
+    /**
+     * @return Number of the samples per channel of a block.
+     */
+    unsigned int Length() const {
+        return length_;
+    }
+
+    /**
+     * @return Transmission buffer of DmaWords() words.
+     */
+    int32_t* TxBuffer() {
+        return tx_;
+    }
+
+    /**
+     * @return Reception buffer of DmaWords() words.
+     */
+    int32_t* RxBuffer() {
+        return rx_;
+    }
+
+    /**
+     * @return Number of the 32bit words of a circular buffer, both halves.
+     */
+    unsigned int DmaWords() const {
+        return 2 * 2 * length_;
+    }
+
+    /**
+     * @brief Process the first half. Called by the half transfer interrupt of the reception.
+     */
+    void OnHalfTransfer() {
+        Process(0);
+    }
+
+    /**
+     * @brief Process the second half. Called by the transfer complete interrupt of the reception.
+     */
+    void OnFullTransfer() {
+        Process(2 * length_);
+    }
+
+    /**
+     * @brief Convert a sample to the word in the DMA buffer.
+     */
+    static int32_t ToDmaWord(q31_t sample, DmaWordOrder order) {
+        if (order == kdwoNative)
+            return sample;
+        const uint32_t word = static_cast<uint32_t>(sample);
+        return static_cast<int32_t>((word << 16) | (word >> 16));
+    }
+
+    /**
+     * @brief Convert the word in the DMA buffer to a sample.
+     * @details
+     * Swapping the halves is its own inverse.
+     */
+    static q31_t FromDmaWord(int32_t word, DmaWordOrder order) {
+        return ToDmaWord(word, order);
+    }
+
+ private:
+    InterruptAudio(const InterruptAudio&);
+    InterruptAudio& operator=(const InterruptAudio&);
+
+    void Process(unsigned int offset) {
+        const int32_t *const rx = rx_ + offset;
+        int32_t *const tx = tx_ + offset;
+
+        if (nullptr != q31_callback_) {
+            ProcessQ31(rx, tx);
+            return;
+        }
+
+        for (unsigned int i = 0; i < length_; i++) {
+            block_.left[i] = Q31ToFloat(FromDmaWord(rx[2 * i], order_));
+            block_.right[i] = Q31ToFloat(FromDmaWord(rx[2 * i + 1], order_));
+        }
+
+        callback_(block_);
+
+        for (unsigned int i = 0; i < length_; i++) {
+            tx[2 * i] = ToDmaWord(FloatToQ31(block_.left[i]), order_);
+            tx[2 * i + 1] = ToDmaWord(FloatToQ31(block_.right[i]), order_);
+        }
+    }
+
+    void ProcessQ31(const int32_t *rx, int32_t *tx) {
+        for (unsigned int i = 0; i < length_; i++) {
+            q31_block_.left[i] = FromDmaWord(rx[2 * i], order_);
+            q31_block_.right[i] = FromDmaWord(rx[2 * i + 1], order_);
+        }
+
+        q31_callback_(q31_block_);
+
+        for (unsigned int i = 0; i < length_; i++) {
+            tx[2 * i] = ToDmaWord(q31_block_.left[i], order_);
+            tx[2 * i + 1] = ToDmaWord(q31_block_.right[i], order_);
+        }
+    }
+
+    const BlockCallback callback_;
+    const DmaWordOrder order_;
+    const unsigned int max_length_;
+    int32_t *const dma_storage_;
+    const Q31BlockCallback q31_callback_;
+    float *const storage_;
+    q31_t *const q31_storage_;
+    unsigned int length_;
+    int32_t *tx_;
+    int32_t *rx_;
+    StereoBlock<float> block_;
+    StereoBlock<q31_t> q31_block_;
+};
+
+} /* namespace audio */
+
+#endif /* INTERRUPTAUDIO_HPP_ */
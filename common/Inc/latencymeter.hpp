@@ -0,0 +1,117 @@
+/**
+ * @file latencymeter.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Latency measurement from the DMA interrupt to the processed block.
+ */
+
+#ifndef LATENCYMETER_HPP_
+#define LATENCYMETER_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+#include "loadmeter.hpp"
+
+namespace audio {
+
+/**
+ * @brief Latency of the audio processing against the DMA interrupt.
+ * @details
+ * The DMA interrupt of the received block calls NotifyInterrupt(). The processing calls Begin() and
+ * End() around the block. Two latencies are measured from the interrupt :
+ * @li Response : to Begin(). The scheduler latency of the audio task, or the entry of the interrupt handler.
+ * @li Completion : to End(). The time until the processed block is ready for the transmission.
+ *
+ * The jitter of the response is its max - min. Both are kept by audio::LoadMeter against the budget
+ * of the block. Then the completion histogram over the budget shows the blocks late to the DMA.
+ *
+ * @code
+ * // DMA interrupt
+ * meter.NotifyInterrupt(murasaki::GetCycleCounter());
+ *
+ * // Audio task or the interrupt handler.
+ * meter.Begin(murasaki::GetCycleCounter());
+ * // process the block.
+ * meter.End(murasaki::GetCycleCounter());
+ * @endcode
+ *
+ * A block without the interrupt notified since the last block is not measured. For example, the
+ * first block before the DMA is hooked.
+ *
+ * Read() is called from a task other than the audio processing, as like audio::LoadMeter.
+ */
+class LatencyMeter {
+ public:
+    LatencyMeter()
+            : interrupt_(0),
+              is_notified_(false),
+              is_measuring_(false) {
+    }
+
+    /**
+     * @brief Set the cycles of the block period, and clear the statistics.
+     * @param cycles Core clock cycles of the block period.
+     */
+    void SetBudget(uint32_t cycles) {
+        response_.SetBudget(cycles);
+        completion_.SetBudget(cycles);
+    }
+
+    /**
+     * @brief Record the DMA interrupt of the received block.
+     * @param now Current value of the cycle counter.
+     * @details
+     * Called from the interrupt context.
+     */
+    void NotifyInterrupt(uint32_t now) {
+        interrupt_.store(now, std::memory_order_relaxed);
+        is_notified_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Mark the start of the processing of the block notified last.
+     * @param now Current value of the cycle counter.
+     */
+    void Begin(uint32_t now) {
+        is_measuring_ = is_notified_.exchange(false, std::memory_order_acquire);
+        if (!is_measuring_)
+            return;
+        const uint32_t interrupt = interrupt_.load(std::memory_order_relaxed);
+        response_.Begin(interrupt);
+        response_.End(now);
+        completion_.Begin(interrupt);
+    }
+
+    /**
+     * @brief Mark the end of the processing.
+     * @param now Current value of the cycle counter.
+     */
+    void End(uint32_t now) {
+        if (is_measuring_)
+            completion_.End(now);
+    }
+
+    /**
+     * @brief Get the statistics.
+     * @param response Receives the snapshot of the response latency.
+     * @param completion Receives the snapshot of the completion latency.
+     * @param reset If true, the statistics are cleared at the next block.
+     */
+    void Read(LoadStatistics *response, LoadStatistics *completion, bool reset) {
+        response_.Read(response, reset);
+        completion_.Read(completion, reset);
+    }
+
+ private:
+    std::atomic<uint32_t> interrupt_;
+    std::atomic<bool> is_notified_;
+    bool is_measuring_;
+    LoadMeter response_;
+    LoadMeter completion_;
+};
+
+} /* namespace audio */
+
+#endif /* LATENCYMETER_HPP_ */
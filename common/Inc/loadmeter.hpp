@@ -0,0 +1,188 @@
+/**
+ * @file loadmeter.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief CPU load measurement of the audio task.
+ */
+
+#ifndef LOADMETER_HPP_
+#define LOADMETER_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+namespace audio {
+
+/**
+ * @brief Number of the histogram bins.
+ * @details
+ * Each bin covers 10% of the block budget. The last bin counts the blocks exceeding the budget.
+ */
+const unsigned int kLoadHistogramBins = 11;
+
+/**
+ * @brief Snapshot of the load statistics.
+ * @details
+ * All cycles are measured by the cycle counter of the core.
+ */
+struct LoadStatistics {
+    uint32_t blocks;                            ///< Number of the measured blocks.
+    uint32_t budget;                            ///< Cycles per block to keep the real time.
+    uint32_t min;                               ///< Shortest processing cycles.
+    uint32_t max;                               ///< Longest processing cycles.
+    uint64_t sum;                               ///< Sum of the processing cycles.
+    uint32_t histogram[kLoadHistogramBins];     ///< Number of the blocks in each 10% of the budget.
+
+    /**
+     * @brief Convert cycles to the ratio against the budget.
+     * @param cycles Processing cycles.
+     * @return Load in 0.1% unit.
+     */
+    unsigned int PerMille(uint64_t cycles) const {
+        return budget == 0 ? 0 : static_cast<unsigned int>(cycles * 1000 / budget);
+    }
+
+    /**
+     * @return Mean processing cycles per block.
+     */
+    uint32_t Mean() const {
+        return blocks == 0 ? 0 : static_cast<uint32_t>(sum / blocks);
+    }
+};
+
+/**
+ * @brief Per block CPU load meter.
+ * @details
+ * The audio task calls Begin() and End() around the processing of each block, with the value of
+ * the cycle counter. The meter keeps min, max, mean and the histogram of the processing cycles
+ * against the budget of the block. No memory is allocated during the measurement.
+ *
+ * @code
+ * meter.SetBudget(SystemCoreClock / fs * channel_length);
+ * while (true) {
+ *     audio::StereoBlock<float> block = exchanger.Exchange();
+ *     meter.Begin(murasaki::GetCycleCounter());
+ *     // process the block.
+ *     meter.End(murasaki::GetCycleCounter());
+ * }
+ * @endcode
+ *
+ * The other task gets the result by Read(). The audio task is never blocked by the reader.
+ * The statistics are guarded by a sequence number. The reader retries when the audio task
+ * updated the statistics during the read.
+ *
+ * The cycle counter is 32bit. The processing time of a block must be shorter than its wrap around time.
+ */
+class LoadMeter {
+ public:
+    LoadMeter()
+            : begin_(0),
+              bin_width_(1),
+              sequence_(0),
+              reset_request_(false) {
+        stats_.budget = 0;
+        Clear();
+    }
+
+    /**
+     * @brief Set the cycles available for one block, and clear the statistics.
+     * @param cycles Core clock cycles of the block period.
+     * @details
+     * Called from the audio task when the block length or the sampling frequency is changed.
+     */
+    void SetBudget(uint32_t cycles) {
+        BeginUpdate();
+        stats_.budget = cycles;
+        bin_width_ = cycles / (kLoadHistogramBins - 1);
+        if (bin_width_ == 0)
+            bin_width_ = 1;
+        Clear();
+        EndUpdate();
+    }
+
+    /**
+     * @brief Mark the start of the processing.
+     * @param now Current value of the cycle counter.
+     */
+    void Begin(uint32_t now) {
+        begin_ = now;
+    }
+
+    /**
+     * @brief Mark the end of the processing, and update the statistics.
+     * @param now Current value of the cycle counter.
+     */
+    void End(uint32_t now) {
+        const uint32_t elapsed = now - begin_;    // Wrap around safe.
+
+        BeginUpdate();
+        if (reset_request_.load(std::memory_order_relaxed)) {
+            Clear();
+            reset_request_.store(false, std::memory_order_relaxed);
+        }
+
+        stats_.blocks++;
+        stats_.sum += elapsed;
+        if (elapsed < stats_.min)
+            stats_.min = elapsed;
+        if (elapsed > stats_.max)
+            stats_.max = elapsed;
+
+        unsigned int bin = elapsed / bin_width_;
+        if (bin >= kLoadHistogramBins)
+            bin = kLoadHistogramBins - 1;
+        stats_.histogram[bin]++;
+        EndUpdate();
+    }
+
+    /**
+     * @brief Get the statistics.
+     * @param stats Receives the snapshot.
+     * @param reset If true, the statistics are cleared by the audio task at the next block.
+     * @details
+     * Called from a task other than the audio task. By resetting at each read, the snapshot
+     * shows the load of the interval between reads.
+     */
+    void Read(LoadStatistics *stats, bool reset) {
+        uint32_t before;
+        uint32_t after;
+        do {
+            before = sequence_.load(std::memory_order_acquire);
+            *stats = stats_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence_.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+
+        if (reset)
+            reset_request_.store(true, std::memory_order_relaxed);
+    }
+
+ private:
+    // The sequence number is odd while the statistics are being updated.
+    void BeginUpdate() {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    void EndUpdate() {
+        sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    void Clear() {
+        stats_.blocks = 0;
+        stats_.min = UINT32_MAX;
+        stats_.max = 0;
+        stats_.sum = 0;
+        for (unsigned int i = 0; i < kLoadHistogramBins; i++)
+            stats_.histogram[i] = 0;
+    }
+
+    uint32_t begin_;
+    uint32_t bin_width_;
+    LoadStatistics stats_;
+    std::atomic<uint32_t> sequence_;
+    std::atomic<bool> reset_request_;
+};
+
+} /* namespace audio */
+
+#endif /* LOADMETER_HPP_ */
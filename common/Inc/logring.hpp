@@ -0,0 +1,210 @@
+/**
+ * @file logring.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Lock-free log ring for the audio task and the interrupts, with the deferred formatting.
+ */
+
+#ifndef LOGRING_HPP_
+#define LOGRING_HPP_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <type_traits>
+
+/**
+ * @brief Append a message to the audio::LogRing, checking the arguments.
+ * @param log Pointer to the audio::LogRing.
+ * @param now Current value of the cycle counter.
+ * @param format Format as like printf. Static storage.
+ * @details
+ * The arguments are checked against the format by the compiler, as like printf. They are formatted
+ * later as audio::LogArg. Then, use the l modifier, and give the integers as long or unsigned long.
+ * The value is the return value of LogRing::Log().
+ *
+ * @code
+ * AUDIO_LOG(murasaki::platform.log, murasaki::GetCycleCounter(), "Missed %lu blocks", static_cast<unsigned long>(missed));
+ * @endcode
+ */
+#define AUDIO_LOG(log, now, format, ...) \
+    ((false ? audio::CheckLogFormat(format, ##__VA_ARGS__) : static_cast<void>(0)), \
+     (log)->Log(now, format, ##__VA_ARGS__))
+
+namespace audio {
+
+/**
+ * @brief Maximum number of the arguments of a log message.
+ */
+const unsigned int kLogArgs = 4;
+
+/**
+ * @brief Argument of a log message. Same width as a pointer.
+ * @details
+ * Use the l modifier in the format, as like %lu, %ld and %lx. %s takes a string of the static storage.
+ */
+typedef unsigned long LogArg;
+
+/**
+ * @brief Check the arguments against the format at the compile time. Never called.
+ */
+inline void CheckLogFormat(const char *format, ...) __attribute__((format(printf, 1, 2)));
+inline void CheckLogFormat(const char*, ...) {
+}
+
+/**
+ * @brief A log message taken from the audio::LogRing. Not formatted yet.
+ */
+struct LogEntry {
+    const char *format;         ///< Format string as like printf. Static storage.
+    uint32_t timestamp;         ///< Cycle counter at the log.
+    LogArg args[kLogArgs];      ///< Arguments of the format. Unused ones are 0.
+
+    /**
+     * @brief Format the message.
+     * @param text Receives the formatted message. Truncated to the size.
+     * @param size Size of the text in byte, including the terminating null.
+     * @return Return value of snprintf().
+     */
+    int Format(char *text, size_t size) const {
+        return snprintf(text, size, format, args[0], args[1], args[2], args[3]);
+    }
+};
+
+/**
+ * @brief Log from the audio task and the interrupts, formatted later by a lower priority task.
+ * @tparam N Number of the slots. Power of 2.
+ * @details
+ * Log() copies the format pointer, the timestamp and the raw arguments into a slot. There is no
+ * formatting, no lock, no system call and no UART access. Read() takes the messages in order
+ * from a lower priority task, and LogEntry::Format() formats them there. Then, the text goes to the
+ * console by murasaki::debugger.
+ *
+ * Any context can call Log(), including the interrupts which preempt another Log(). A slot is
+ * reserved by the compare and swap of the write index, and published by its sequence number.
+ * On a single core, the swap fails only when an interrupt logged between the load and the swap.
+ * Then, Log() finishes in a fixed number of steps plus one retry per such interrupt. Only one
+ * task calls Read().
+ *
+ * If the ring is full, the message is dropped and counted. The writer never waits.
+ *
+ * The format string and the %s arguments are read when formatted. They must be in the static storage.
+ * The arguments are integers or pointers. The float is not supported, because it is promoted
+ * to the double. Multiply it to an integer.
+ */
+template<unsigned int N>
+class LogRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+ public:
+    LogRing()
+            : head_(0),
+              tail_(0),
+              dropped_(0) {
+        for (unsigned int i = 0; i < N; i++)
+            slot_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Append a message.
+     * @param now Current value of the cycle counter.
+     * @param format Format string as like printf. Static storage.
+     * @param args Up to kLogArgs integers or pointers.
+     * @return false if the ring is full. The message is dropped.
+     * @details
+     * Called from any task or interrupt. The arguments are not checked against the format.
+     * Use AUDIO_LOG() to check them.
+     */
+    template<typename ... Args>
+    bool Log(uint32_t now, const char *format, Args ... args) {
+        static_assert(sizeof...(Args) <= kLogArgs, "Too many arguments of the log");
+        const LogArg values[kLogArgs + 1] = { ToLogArg(args)... };    // +1 for the message without argument.
+
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        Slot *slot;
+        while (true) {
+            slot = &slot_[head & (N - 1)];
+            const int32_t lap = static_cast<int32_t>(slot->sequence.load(std::memory_order_acquire) - head);
+            if (lap < 0) {
+                // Not read yet since the last round.
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            // On failure, the head is reloaded. Retry by the new head.
+            if (lap == 0 && head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+                break;
+            if (lap > 0)
+                head = head_.load(std::memory_order_relaxed);
+        }
+
+        slot->entry.format = format;
+        slot->entry.timestamp = now;
+        for (unsigned int i = 0; i < kLogArgs; i++)
+            slot->entry.args[i] = values[i];
+        slot->sequence.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest message.
+     * @param entry Receives the message.
+     * @return false if there is no message, or the oldest one is still being written.
+     * @details
+     * Called by one lower priority task.
+     */
+    bool Read(LogEntry *entry) {
+        Slot &slot = slot_[tail_ & (N - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != tail_ + 1)
+            return false;
+        *entry = slot.entry;
+        slot.sequence.store(tail_ + N, std::memory_order_release);
+        tail_++;
+        return true;
+    }
+
+    /**
+     * @return Number of the messages dropped because the ring was full.
+     */
+    uint32_t Dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+ private:
+    // The sequence is the head which may write the slot next, or that head + 1 after the write.
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        LogEntry entry;
+    };
+
+    template<typename T>
+    static LogArg ToLogArg(T value) {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Integer or string argument only");
+        return static_cast<LogArg>(value);
+    }
+
+    static LogArg ToLogArg(const char *value) {
+        return reinterpret_cast<LogArg>(value);
+    }
+
+    Slot slot_[N];
+    std::atomic<uint32_t> head_;        // Next message to reserve. Written by the writers.
+    uint32_t tail_;                     // Next message to read. Written by the reader only.
+    std::atomic<uint32_t> dropped_;
+};
+
+/**
+ * @brief Number of the slots of audio::DebugLog.
+ */
+const unsigned int kDebugLogLength = 64;
+
+/**
+ * @brief Debug log of the platform. Printed by ExecPlatform().
+ */
+class DebugLog final : public LogRing<kDebugLogLength> {
+};
+
+} /* namespace audio */
+
+#endif /* LOGRING_HPP_ */
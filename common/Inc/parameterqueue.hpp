@@ -0,0 +1,43 @@
+/**
+ * @file parameterqueue.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Queue of the parameter changes from the control task to the audio task.
+ */
+
+#ifndef PARAMETERQUEUE_HPP_
+#define PARAMETERQUEUE_HPP_
+
+#include "spscqueue.hpp"
+
+namespace audio {
+
+const unsigned int kParameterQueueLength = 16;     ///< Number of the slots of the ParameterQueue.
+
+/**
+ * @brief Change of a parameter of the audio task.
+ * @details
+ * The meaning of the id is defined by the application.
+ */
+struct Parameter {
+    unsigned int id;        ///< Parameter to change.
+    float value;            ///< New value.
+};
+
+/**
+ * @brief Parameter changes from the control task to the audio task.
+ * @details
+ * The control task pushes the changes at any time. The audio task pops all of them at the block
+ * boundary, and applies them to the processing stages. Then, the setters of the stages which are
+ * not synchronized with Process() are called from the audio task only.
+ *
+ * Up to kParameterQueueLength - 1 changes are queued. Push() fails when the queue is full.
+ * The control task retries later.
+ */
+class ParameterQueue final : public SpscQueue<Parameter, kParameterQueueLength> {
+};
+
+} /* namespace audio */
+
+#endif /* PARAMETERQUEUE_HPP_ */
@@ -0,0 +1,235 @@
+/**
+ * @file partitionedconvolver.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Uniformly partitioned FFT convolution for the long impulse response.
+ */
+
+#ifndef PARTITIONEDCONVOLVER_HPP_
+#define PARTITIONEDCONVOLVER_HPP_
+
+#include "audioprocessor.hpp"
+#include "fft.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+#ifndef AUDIO_CONFIG_CONVOLUTION
+#define AUDIO_CONFIG_CONVOLUTION false
+#endif
+
+namespace audio {
+
+/**
+ * @brief Spectra of the partitioned impulse response.
+ * @details
+ * The impulse response is divided into the partitions of partition_size samples. Each partition is
+ * padded by partition_size zeros, and transformed by the 2 x partition_size points FFT. The spectrum
+ * is scaled by 1 / (2 x partition_size), to cancel the gain of the inverse FFT.
+ *
+ * The spectrum of the real signal is conjugate symmetric. Then, only the bins 0 to partition_size
+ * are stored. bins has partitions x (partition_size + 1) complex numbers, interleaved as re, im.
+ *
+ * The spectra are generated on the host by host-sim/tools/irspectrum.cpp, as a header file.
+ * Then, they are placed in the flash. The header defines the IrSpectrum as constexpr, to size the
+ * storage of the PartitionedConvolver at the compile time.
+ */
+struct IrSpectrum {
+    unsigned int partition_size;    ///< Number of the samples in a partition.
+    unsigned int partitions;        ///< Number of the partitions.
+    const float *bins;              ///< Spectra of the partitions.
+};
+
+/**
+ * @brief Compute the spectra of the partitioned impulse response.
+ * @param fft FFT of 2 x partition size points.
+ * @param ir Impulse response of partitions x partition size taps.
+ * @param partitions Number of the partitions.
+ * @param bins Receives partitions x (partition size + 1) complex numbers. See IrSpectrum.
+ * @param scratch Work area of 2 x FFT points floats.
+ * @details
+ * Used by the host tool to generate the spectra in the flash. Also, the target can compute the
+ * spectra of the impulse response given at run time, from a task other than the audio task.
+ */
+inline void ComputeIrSpectrum(const Fft &fft, const float *ir, unsigned int partitions, float *bins, float *scratch) {
+    const unsigned int n = fft.Size();
+    const unsigned int partition_size = n / 2;
+
+    for (unsigned int p = 0; p < partitions; p++) {
+        for (unsigned int i = 0; i < 2 * n; i++)
+            scratch[i] = 0.0f;
+        for (unsigned int i = 0; i < partition_size; i++)
+            scratch[2 * i] = ir[p * partition_size + i] / n;
+        fft.Forward(scratch);
+        for (unsigned int i = 0; i < 2 * (partition_size + 1); i++)
+            bins[p * 2 * (partition_size + 1) + i] = scratch[i];
+    }
+}
+
+/**
+ * @brief Stereo convolution by the uniformly partitioned overlap-save method.
+ * @details
+ * Both channels are convolved with the same impulse response. The left and right channels are packed
+ * into a complex signal as left + j right. The impulse response is real. Then, the real and
+ * imaginary part of the result are the left and right output. One complex FFT and one inverse FFT
+ * per partition process both channels.
+ *
+ * The spectra of the input partitions are kept in the frequency domain delay line. At each partition,
+ * the newest input spectrum is added to the delay line, and the products of the delay line and
+ * the spectra of the impulse response are accumulated. The cost per partition grows with the length
+ * of the impulse response by the complex multiply-accumulate only.
+ *
+ * If the block length is a multiple of the partition size, the block is processed without additional
+ * latency. Otherwise, the samples are buffered until a partition is filled, and the latency is
+ * the partition size.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ */
+class PartitionedConvolver final : public FloatProcessor {
+ public:
+    /**
+     * @brief Number of the floats of the storage.
+     * @param partition_size Number of the samples in a partition.
+     * @param partitions Number of the partitions of the impulse response.
+     */
+    static constexpr unsigned int StorageSize(unsigned int partition_size, unsigned int partitions) {
+        return partitions * 4 * partition_size       // Frequency domain delay line.
+        + 4 * partition_size                         // Accumulator of the output spectrum.
+        + 2 * partition_size                         // Previous input partition.
+        + 2 * partition_size;                        // Input and output of the partial partition.
+    }
+
+    /**
+     * @brief Constructor.
+     * @param ir Spectra of the impulse response. Referred, not copied.
+     * @param storage Memory of StorageSize(ir.partition_size, ir.partitions) floats. Not owned.
+     */
+    PartitionedConvolver(const IrSpectrum &ir, float *storage)
+            : ir_(ir),
+              size_(ir.partition_size),
+              fft_(2 * ir.partition_size),
+              delay_line_(storage),
+              accumulator_(delay_line_ + ir.partitions * 4 * ir.partition_size),
+              previous_(accumulator_ + 4 * ir.partition_size),
+              buffer_(previous_ + 2 * ir.partition_size),
+              head_(0),
+              fill_(0) {
+        MURASAKI_ASSERT(0 != ir.partitions)
+        MURASAKI_ASSERT(nullptr != ir.bins)
+        Reset();
+    }
+
+    /**
+     * @brief Clear the state.
+     */
+    void Reset() {
+        for (unsigned int i = 0; i < ir_.partitions * 4 * size_; i++)
+            delay_line_[i] = 0.0f;
+        for (unsigned int i = 0; i < 2 * size_; i++) {
+            previous_[i] = 0.0f;
+            buffer_[i] = 0.0f;
+        }
+        head_ = 0;
+        fill_ = 0;
+    }
+
+    /**
+     * @return Number of the taps of the impulse response.
+     */
+    unsigned int Taps() const {
+        return ir_.partitions * size_;
+    }
+
+    AUDIO_ITCM_KERNEL(convolver_process) virtual void Process(const StereoBlock<float> &block) {
+        const unsigned int length = block.Length();
+
+        // Aligned to the partition. Process in place without latency.
+        if (fill_ == 0 && length % size_ == 0) {
+            for (unsigned int offset = 0; offset < length; offset += size_)
+                ProcessPartition(
+                                 ChannelSpan<float>(&block.left[offset], size_, block.left.Stride()),
+                                 ChannelSpan<float>(&block.right[offset], size_, block.right.Stride()));
+            return;
+        }
+
+        // Shorter than the partition. The buffer has the output of the last partition.
+        // Exchange it with the input sample by sample, and process when the buffer is filled by the input.
+        float *const left = buffer_;
+        float *const right = buffer_ + size_;
+        for (unsigned int i = 0; i < length; i++) {
+            float t = block.left[i];
+            block.left[i] = left[fill_];
+            left[fill_] = t;
+            t = block.right[i];
+            block.right[i] = right[fill_];
+            right[fill_] = t;
+
+            if (++fill_ == size_) {
+                ProcessPartition(ChannelSpan<float>(left, size_), ChannelSpan<float>(right, size_));
+                fill_ = 0;
+            }
+        }
+    }
+
+ private:
+    // Convolve a partition in place.
+    AUDIO_ITCM_KERNEL(convolver_partition) void ProcessPartition(const ChannelSpan<float> &left, const ChannelSpan<float> &right) {
+        const unsigned int n = 2 * size_;   // FFT points.
+
+        // Input frame of the overlap-save : previous partition and this partition, as left + j right.
+        float *const spectrum = delay_line_ + head_ * 2 * n;
+        for (unsigned int i = 0; i < size_; i++) {
+            spectrum[2 * i] = previous_[2 * i];
+            spectrum[2 * i + 1] = previous_[2 * i + 1];
+            previous_[2 * i] = spectrum[2 * (size_ + i)] = left[i];
+            previous_[2 * i + 1] = spectrum[2 * (size_ + i) + 1] = right[i];
+        }
+        fft_.Forward(spectrum);
+
+        // Accumulate the products of the delay line and the impulse response.
+        for (unsigned int i = 0; i < 2 * n; i++)
+            accumulator_[i] = 0.0f;
+        unsigned int slot = head_;
+        for (unsigned int p = 0; p < ir_.partitions; p++) {
+            const float *const x = delay_line_ + slot * 2 * n;
+            const float *const h = ir_.bins + p * 2 * (size_ + 1);
+
+            // Bins 0 to size_ are stored.
+            for (unsigned int k = 0; k <= size_; k++) {
+                accumulator_[2 * k] += x[2 * k] * h[2 * k] - x[2 * k + 1] * h[2 * k + 1];
+                accumulator_[2 * k + 1] += x[2 * k] * h[2 * k + 1] + x[2 * k + 1] * h[2 * k];
+            }
+            // The others are the conjugate of the stored bins.
+            for (unsigned int k = size_ + 1; k < n; k++) {
+                const float hr = h[2 * (n - k)];
+                const float hi = -h[2 * (n - k) + 1];
+                accumulator_[2 * k] += x[2 * k] * hr - x[2 * k + 1] * hi;
+                accumulator_[2 * k + 1] += x[2 * k] * hi + x[2 * k + 1] * hr;
+            }
+
+            slot = (slot == 0) ? ir_.partitions - 1 : slot - 1;
+        }
+        head_ = (head_ + 1 == ir_.partitions) ? 0 : head_ + 1;
+
+        // The last half of the inverse transform is the output. The first half is the circular alias.
+        fft_.Inverse(accumulator_);
+        for (unsigned int i = 0; i < size_; i++) {
+            left[i] = accumulator_[2 * (size_ + i)];
+            right[i] = accumulator_[2 * (size_ + i) + 1];
+        }
+    }
+
+    const IrSpectrum ir_;
+    const unsigned int size_;
+    const Fft fft_;
+    float *const delay_line_;     // partitions x 2 x size_ complex.
+    float *const accumulator_;    // 2 x size_ complex.
+    float *const previous_;       // size_ complex.
+    float *const buffer_;         // size_ left and size_ right.
+    unsigned int head_;           // Slot of the newest spectrum in the delay line.
+    unsigned int fill_;           // Number of the samples in the buffer.
+};
+
+} /* namespace audio */
+
+#endif /* PARTITIONEDCONVOLVER_HPP_ */
@@ -0,0 +1,480 @@
+/**
+ * @file pipeline.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Chain of the processing stages, composed at compile time or at run time.
+ * @details
+ * audio::StaticChain composes the stages by the template arguments. The calls to the stages are
+ * resolved at compile time, and the consecutive sample stages are fused into a loop over the block.
+ * audio::DynamicChain composes the audio::FloatProcessor at run time, for the chain configured
+ * in the field. A StaticChain is a FloatProcessor. Then, it can be a stage of a DynamicChain.
+ * audio::Q31StaticChain is the same composition for the Q31 blocks.
+ */
+
+#ifndef PIPELINE_HPP_
+#define PIPELINE_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "audioprocessor.hpp"
+#include "biquad.hpp"
+#include "doublebuffer.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Maximum number of the stages of audio::DynamicChain.
+ */
+const unsigned int kMaxChainStages = 8;
+
+/**
+ * @brief void, if all the types are valid.
+ */
+template<typename ... T>
+struct MakeVoid {
+    typedef void type;
+};
+
+/**
+ * @brief Check whether T is a sample stage.
+ * @details
+ * A sample stage processes a stereo sample at a time. It has the following members.
+ * @li Context : Type of the state used in the block. It has void Process(T &left, T &right), where T is
+ *     the sample type of the chain.
+ * @li Context Begin(unsigned int length) : Copy the state to the context at the start of the block.
+ * @li void End(const Context &context) : Copy back the state at the end of the block.
+ *
+ * The context is a local variable of the fused loop. Then, the compiler keeps it in the registers,
+ * without the load and store of the members for each sample.
+ *
+ * Other stage is a block stage. It is a final class derived from audio::AudioProcessor of the sample type.
+ */
+template<typename T, typename = void>
+struct IsSampleStage : std::false_type {
+};
+
+template<typename T>
+struct IsSampleStage<T, typename MakeVoid<typename T::Context>::type> : std::true_type {
+};
+
+/**
+ * @brief Stages composed at compile time.
+ * @tparam T Type of the sample. float or q31_t.
+ * @tparam Stages Types of the stages, in the order of the processing.
+ * @details
+ * The chain keeps the references to the stages. The stages are created by the caller.
+ *
+ * The block stages are called by their types. As they are final, the calls are not virtual, and can
+ * be inlined. The consecutive sample stages are fused. That is, one loop over the block calls all the
+ * sample stages for each sample. The samples are loaded and stored once, and stay in the registers
+ * between the stages.
+ *
+ * Process() is the only virtual call, once per block. Called by its final type, the call is not
+ * virtual. With AUDIO_CONFIG_USE_TCM, Process() and the sample loops are inlined into the caller,
+ * because a class template can't be placed in the ITCM by itself.
+ */
+template<typename T, typename ... Stages>
+class BasicStaticChain final : public AudioProcessor<T> {
+ public:
+    /**
+     * @brief Number of the stages.
+     */
+    static const unsigned int kStages = sizeof...(Stages);
+
+    /**
+     * @param stages Stages. Not owned.
+     */
+    explicit BasicStaticChain(Stages &... stages)
+            : stages_(stages...) {
+    }
+
+    /**
+     * @brief Access to a stage.
+     * @tparam I Index of the stage.
+     */
+    template<unsigned int I>
+    typename std::tuple_element<I, std::tuple<Stages...>>::type& Stage() const {
+        return std::get<I>(stages_);
+    }
+
+    AUDIO_ITCM_INLINE virtual void Process(const StereoBlock<T> &block) {
+        Run<0>(block, Kind<KindOf(0)>());
+    }
+
+ private:
+    enum {
+        kEndKind,
+        kBlockKind,
+        kSampleKind
+    };
+
+    template<int K>
+    using Kind = std::integral_constant<int, K>;
+
+    static constexpr int KindOf(unsigned int i) {
+        const int kinds[] = { (IsSampleStage<Stages>::value ? kSampleKind : kBlockKind)..., kEndKind };
+        return kinds[i];
+    }
+
+    // Number of the consecutive sample stages from i.
+    static constexpr unsigned int SampleRun(unsigned int i) {
+        const int kinds[] = { (IsSampleStage<Stages>::value ? kSampleKind : kBlockKind)..., kEndKind };
+        unsigned int end = i;
+        while (kinds[end] == kSampleKind)
+            end++;
+        return end - i;
+    }
+
+    template<unsigned int I>
+    AUDIO_ITCM_INLINE void Run(const StereoBlock<T> &block, Kind<kEndKind>) {
+    }
+
+    template<unsigned int I>
+    AUDIO_ITCM_INLINE void Run(const StereoBlock<T> &block, Kind<kBlockKind>) {
+        std::get<I>(stages_).Process(block);
+        Run<I + 1>(block, Kind<KindOf(I + 1)>());
+    }
+
+    template<unsigned int I>
+    AUDIO_ITCM_INLINE void Run(const StereoBlock<T> &block, Kind<kSampleKind>) {
+        Fuse<I>(block, std::make_index_sequence<SampleRun(I)>());
+        Run<I + SampleRun(I)>(block, Kind<KindOf(I + SampleRun(I))>());
+    }
+
+    // Run the sample stages from I to I + sizeof...(K) - 1 by a loop.
+    template<unsigned int I, std::size_t ... K>
+    AUDIO_ITCM_INLINE void Fuse(const StereoBlock<T> &block, std::index_sequence<K...>) {
+        const unsigned int length = block.Length();
+        auto contexts = std::make_tuple(std::get<I + K>(stages_).Begin(length)...);
+
+        for (unsigned int n = 0; n < length; n++) {
+            T left = block.left[n];
+            T right = block.right[n];
+            // The initializer list calls the stages in the order.
+            const int order[] = { (std::get<K>(contexts).Process(left, right), 0)... };
+            (void) order;
+            block.left[n] = left;
+            block.right[n] = right;
+        }
+
+        const int order[] = { (std::get<I + K>(stages_).End(std::get<K>(contexts)), 0)... };
+        (void) order;
+    }
+
+    std::tuple<Stages&...> stages_;
+};
+
+/**
+ * @brief Stages of the float block composed at compile time.
+ */
+template<typename ... Stages>
+using StaticChain = BasicStaticChain<float, Stages...>;
+
+/**
+ * @brief Stages of the Q31 block composed at compile time.
+ */
+template<typename ... Stages>
+using Q31StaticChain = BasicStaticChain<q31_t, Stages...>;
+
+/**
+ * @brief Stages composed at run time.
+ * @details
+ * The list of the stages is double buffered by audio::DoubleBuffer, as like the coefficients of
+ * audio::BiquadCascade. SetStages() is called from a task other than the audio task. The audio task
+ * takes the new list at the beginning of the next Process(). Then, the chain can be reconfigured
+ * while the audio is running.
+ *
+ * Each stage is called by the virtual Process(). Use a audio::StaticChain as a stage, to fuse the
+ * stages always used together.
+ *
+ * A stage removed from the list keeps its state. Reset it before adding it again, if needed.
+ *
+ * Without SetStages(), the chain has no stage. That is, the block passes through.
+ */
+class DynamicChain final : public FloatProcessor {
+ public:
+    DynamicChain()
+            : lists_(List(), List()) {
+    }
+
+    /**
+     * @brief Hand the new list of the stages to the audio task.
+     * @param stages Array of the stages in the order of the processing. Copied. The stages are not owned.
+     * @param count Number of the stages. 0 to kMaxChainStages.
+     * @return false if the previous list is not taken by the audio task yet. Retry later.
+     * @details
+     * Called from a task other than the audio task, or before the audio starts. Never blocks.
+     */
+    bool SetStages(FloatProcessor *const *stages, unsigned int count) {
+        if (count > kMaxChainStages)
+            return false;
+        List *const list = lists_.BeginWrite();
+        if (nullptr == list)
+            return false;
+
+        for (unsigned int i = 0; i < count; i++) {
+            MURASAKI_ASSERT(nullptr != stages[i])
+            list->stages[i] = stages[i];
+        }
+        list->count = count;
+
+        lists_.EndWrite();
+        return true;
+    }
+
+    virtual void Process(const StereoBlock<float> &block) {
+        lists_.Update();
+        const List &list = lists_.Front();
+        for (unsigned int i = 0; i < list.count; i++)
+            list.stages[i]->Process(block);
+    }
+
+ private:
+    // Value initialized List() has no stage.
+    struct List {
+        FloatProcessor *stages[kMaxChainStages];
+        unsigned int count;
+    };
+
+    DoubleBuffer<List> lists_;
+};
+
+/**
+ * @brief Sample stage of the stereo gain.
+ * @details
+ * SetGain() gives the target. The gain moves linearly to the target during the next block.
+ * Then, the change doesn't make the step in the waveform.
+ *
+ * The setter is called from the audio task between the blocks.
+ */
+class SampleGain {
+ public:
+    struct Context {
+        float gain;
+        float step;
+
+        void Process(float &left, float &right) {
+            gain += step;
+            left *= gain;
+            right *= gain;
+        }
+    };
+
+    /**
+     * @param gain Initial linear gain.
+     */
+    explicit SampleGain(float gain = 1.0f)
+            : gain_(gain),
+              target_(gain) {
+    }
+
+    /**
+     * @param gain Linear gain at the end of the next block.
+     */
+    void SetGain(float gain) {
+        target_ = gain;
+    }
+
+    Context Begin(unsigned int length) const {
+        const Context context = { gain_, (0 == length) ? 0.0f : (target_ - gain_) / length };
+        return context;
+    }
+
+    void End(const Context &context) {
+        gain_ = target_;
+    }
+
+ private:
+    float gain_;
+    float target_;
+};
+
+/**
+ * @brief Sample stage of the stereo biquad cascade.
+ * @tparam S Number of the biquad stages. The loop over the stages is unrolled.
+ * @details
+ * The transposed direct form II, same as audio::BiquadCascade. The coefficients and the states are
+ * copied to the context for each block.
+ *
+ * The setter is called from the audio task between the blocks, or before the audio starts.
+ * Use audio::BiquadCascade to change the coefficients from other task.
+ */
+template<unsigned int S>
+class SampleBiquad {
+ public:
+    struct Context {
+        BiquadCoefficients c[S];
+        float state[2][S][2];
+
+        void Process(float &left, float &right) {
+            for (unsigned int i = 0; i < S; i++) {
+                left = Section(c[i], state[0][i], left);
+                right = Section(c[i], state[1][i], right);
+            }
+        }
+
+     private:
+        static float Section(const BiquadCoefficients &c, float s[2], float x) {
+            const float y = c.b0 * x + s[0];
+            s[0] = c.b1 * x - c.a1 * y + s[1];
+            s[1] = c.b2 * x - c.a2 * y;
+            return y;
+        }
+    };
+
+    /**
+     * @details
+     * All the stages pass through.
+     */
+    SampleBiquad() {
+        const BiquadCoefficients pass_through = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        for (unsigned int i = 0; i < S; i++)
+            context_.c[i] = pass_through;
+        Reset();
+    }
+
+    /**
+     * @param coefficients Array of S coefficients. Copied.
+     */
+    void SetCoefficients(const BiquadCoefficients *coefficients) {
+        for (unsigned int i = 0; i < S; i++)
+            context_.c[i] = coefficients[i];
+    }
+
+    /**
+     * @brief Clear the states.
+     */
+    void Reset() {
+        for (unsigned int ch = 0; ch < 2; ch++)
+            for (unsigned int i = 0; i < S; i++) {
+                context_.state[ch][i][0] = 0.0f;
+                context_.state[ch][i][1] = 0.0f;
+            }
+    }
+
+    Context Begin(unsigned int length) const {
+        return context_;
+    }
+
+    void End(const Context &context) {
+        for (unsigned int ch = 0; ch < 2; ch++)
+            for (unsigned int i = 0; i < S; i++) {
+                context_.state[ch][i][0] = context.state[ch][i][0];
+                context_.state[ch][i][1] = context.state[ch][i][1];
+            }
+    }
+
+ private:
+    Context context_;
+};
+
+/**
+ * @brief Sample stage of the stereo feedback delay.
+ * @details
+ * out = in + mix * delayed, and the delay line gets in + feedback * delayed. The delay line is a
+ * circular buffer of the power of 2 length, and indexed by the mask.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ *
+ * The setters are called from the audio task between the blocks, or before the audio starts.
+ */
+class SampleDelay {
+ public:
+    struct Context {
+        float *left_line;
+        float *right_line;
+        unsigned int mask;
+        unsigned int position;
+        unsigned int delay;
+        float feedback;
+        float mix;
+
+        void Process(float &left, float &right) {
+            const unsigned int read = (position - delay) & mask;
+            const float left_delayed = left_line[read];
+            const float right_delayed = right_line[read];
+            left_line[position] = left + feedback * left_delayed;
+            right_line[position] = right + feedback * right_delayed;
+            left += mix * left_delayed;
+            right += mix * right_delayed;
+            position = (position + 1) & mask;
+        }
+    };
+
+    /**
+     * @brief Number of the floats of the storage.
+     * @param size Length of the delay line. Power of 2.
+     */
+    static constexpr unsigned int StorageSize(unsigned int size) {
+        return 2 * size;
+    }
+
+    /**
+     * @param size Length of the delay line. Power of 2. The delay is up to size - 1 samples.
+     * @param storage Memory of StorageSize(size) floats. Not owned.
+     * @details
+     * The delay is size - 1 samples. The feedback and the mix are 0. That is, pass through.
+     */
+    SampleDelay(unsigned int size, float *storage)
+            : size_(size) {
+        MURASAKI_ASSERT(size >= 2 && (size & (size - 1)) == 0)
+        MURASAKI_ASSERT(nullptr != storage)
+
+        context_.left_line = storage;
+        context_.right_line = storage + size;
+        context_.mask = size - 1;
+        context_.position = 0;
+        context_.delay = size - 1;
+        context_.feedback = 0.0f;
+        context_.mix = 0.0f;
+        Reset();
+    }
+
+    /**
+     * @param delay Delay [samples]. 1 to size - 1.
+     */
+    void SetDelay(unsigned int delay) {
+        MURASAKI_ASSERT(0 < delay && delay < size_)
+        context_.delay = delay;
+    }
+
+    /**
+     * @param feedback Gain of the delayed sample fed back to the line. Less than 1 in magnitude.
+     * @param mix Gain of the delayed sample added to the output.
+     */
+    void SetFeedback(float feedback, float mix) {
+        context_.feedback = feedback;
+        context_.mix = mix;
+    }
+
+    /**
+     * @brief Clear the delay line.
+     */
+    void Reset() {
+        for (unsigned int i = 0; i < size_; i++) {
+            context_.left_line[i] = 0.0f;
+            context_.right_line[i] = 0.0f;
+        }
+    }
+
+    Context Begin(unsigned int length) const {
+        return context_;
+    }
+
+    void End(const Context &context) {
+        context_.position = context.position;
+    }
+
+ private:
+    const unsigned int size_;
+    Context context_;
+};
+
+} /* namespace audio */
+
+#endif /* PIPELINE_HPP_ */
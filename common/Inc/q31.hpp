@@ -0,0 +1,218 @@
+/**
+ * @file q31.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Saturating Q31 fixed point arithmetic.
+ * @details
+ * Each function has two implementations. On the Cortex-M4 / M7, the DSP extension and
+ * the FPU instructions are used. On other targets like the host simulation, the portable C++
+ * implementation is used. The portable one is the reference of the result. Both implementations
+ * return the identical bit pattern for all input, by the definition of the instructions:
+ *
+ * @li QADD / QSUB : 32bit add / subtract with signed saturation.
+ * @li SMULL : 64bit signed product. The bits 62 to 31 are the Q31 product, truncated.
+ * @li VCVT.S32.F32 with 31 fraction bits : Round toward zero, signed saturation, NaN to zero.
+ *
+ * Define AUDIO_Q31_FORCE_REFERENCE as true to use the reference implementation on the target.
+ *
+ * The reference is checked against the 64bit integer and the double models by bench/q31.cpp of the host-sim.
+ * The host can't run the instructions. On the target, SelfTestQ31() compares them with the reference
+ * in the namespace audio::reference. ExecPlatform() runs it at the start of the Q31 processing.
+ */
+
+#ifndef Q31_HPP_
+#define Q31_HPP_
+
+#include "audioblock.hpp"
+
+#ifndef AUDIO_Q31_FORCE_REFERENCE
+#define AUDIO_Q31_FORCE_REFERENCE false
+#endif
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP && ! AUDIO_Q31_FORCE_REFERENCE
+#define AUDIO_Q31_USE_DSP_INSTRUCTION true
+#else
+#define AUDIO_Q31_USE_DSP_INSTRUCTION false
+#endif
+
+#if defined(__ARM_FP) && (__ARM_FP & 4) && ! AUDIO_Q31_FORCE_REFERENCE
+#define AUDIO_Q31_USE_FPU_INSTRUCTION true
+#else
+#define AUDIO_Q31_USE_FPU_INSTRUCTION false
+#endif
+
+namespace audio {
+
+const q31_t kQ31Max = INT32_MAX;    ///< Largest Q31 value. 1 - 2^-31.
+const q31_t kQ31Min = INT32_MIN;    ///< Smallest Q31 value. -1.0.
+
+/**
+ * @brief Saturate a 64bit value into the Q31 range.
+ */
+inline q31_t SaturateQ31(int64_t x) {
+    if (x > kQ31Max)
+        return kQ31Max;
+    if (x < kQ31Min)
+        return kQ31Min;
+    return static_cast<q31_t>(x);
+}
+
+namespace reference {
+
+/**
+ * @brief Portable a + b with saturation.
+ */
+inline q31_t SaturatingAdd(q31_t a, q31_t b) {
+    return SaturateQ31(static_cast<int64_t>(a) + b);
+}
+
+/**
+ * @brief Portable a - b with saturation.
+ */
+inline q31_t SaturatingSub(q31_t a, q31_t b) {
+    return SaturateQ31(static_cast<int64_t>(a) - b);
+}
+
+/**
+ * @brief Portable a * b in Q31, with saturation.
+ * @details
+ * The floor of the 64bit product / 2^31. Only -1.0 * -1.0 overflows. It saturates to kQ31Max.
+ */
+inline q31_t MultiplyQ31(q31_t a, q31_t b) {
+    return SaturateQ31((static_cast<int64_t>(a) * b) >> 31);
+}
+
+/**
+ * @brief Portable conversion of a float sample to Q31.
+ */
+inline q31_t FloatToQ31(float x) {
+    if (x != x)
+        return 0;
+    if (x >= 1.0f)
+        return kQ31Max;
+    if (x <= -1.0f)
+        return kQ31Min;
+    // Scaling by 2^31 is exact in float. The cast truncates toward zero.
+    return static_cast<q31_t>(x * 2147483648.0f);
+}
+
+} /* namespace reference */
+
+/**
+ * @brief a + b with saturation.
+ */
+inline q31_t SaturatingAdd(q31_t a, q31_t b) {
+#if AUDIO_Q31_USE_DSP_INSTRUCTION
+    q31_t result;
+    asm ("qadd %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+    return result;
+#else
+    return reference::SaturatingAdd(a, b);
+#endif
+}
+
+/**
+ * @brief a - b with saturation.
+ */
+inline q31_t SaturatingSub(q31_t a, q31_t b) {
+#if AUDIO_Q31_USE_DSP_INSTRUCTION
+    q31_t result;
+    asm ("qsub %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+    return result;
+#else
+    return reference::SaturatingSub(a, b);
+#endif
+}
+
+/**
+ * @brief a * b in Q31, with saturation.
+ * @details
+ * The product is truncated to 31 fractional bits. The error is less than 1 LSB.
+ * -1.0 * -1.0 saturates to kQ31Max.
+ *
+ * On the target, the upper word of SMULL is doubled by QADD. Only -1.0 * -1.0 makes it saturate,
+ * and the lower word is zero then. Otherwise, bit 31 of the lower word is the LSB of the result.
+ */
+inline q31_t MultiplyQ31(q31_t a, q31_t b) {
+#if AUDIO_Q31_USE_DSP_INSTRUCTION
+    q31_t result;
+    uint32_t low;
+    asm ("smull %1, %0, %2, %3\n\t"
+            "qadd %0, %0, %0\n\t"
+            "orr %0, %0, %1, lsr #31" : "=&r" (result), "=&r" (low) : "r" (a), "r" (b));
+    return result;
+#else
+    return reference::MultiplyQ31(a, b);
+#endif
+}
+
+/**
+ * @brief x * 2^shift with saturation.
+ * @param x Value to shift.
+ * @param shift Number of bits to shift left. 0 to 31.
+ */
+inline q31_t SaturatingShiftLeft(q31_t x, unsigned int shift) {
+    return SaturateQ31(static_cast<int64_t>(x) * (static_cast<int64_t>(1) << shift));
+}
+
+/**
+ * @brief Convert a float sample to Q31.
+ * @details
+ * Round toward zero. Saturate out of [-1.0, 1.0). NaN is converted to zero.
+ */
+inline q31_t FloatToQ31(float x) {
+#if AUDIO_Q31_USE_FPU_INSTRUCTION
+    q31_t result;
+    asm ("vcvt.s32.f32 %1, %1, #31\n\t"
+            "vmov %0, %1" : "=r" (result), "+t" (x));
+    return result;
+#else
+    return reference::FloatToQ31(x);
+#endif
+}
+
+/**
+ * @brief Convert a Q31 sample to float.
+ * @details
+ * Round to nearest even. The scaling is exact.
+ */
+inline float Q31ToFloat(q31_t x) {
+    return static_cast<float>(x) * (1.0f / 2147483648.0f);
+}
+
+/**
+ * @brief Compare the instructions with the reference.
+ * @return true if all results are identical.
+ * @details
+ * The corners and the pseudo random values are given to the functions with the instructions and
+ * to the reference. On the host, the reference is compared with itself.
+ */
+inline bool SelfTestQ31() {
+    const q31_t corners[] = { kQ31Min, kQ31Min + 1, -0x40000000, -2, -1, 0, 1, 2, 0x40000000, kQ31Max - 1, kQ31Max };
+    const float floats[] = { 1.0f, -1.0f, 2.0f, 0.5f, -0.5f, 0.0f, 1e-10f, -1e-10f, 0.999999f, -0.999999f };
+    const unsigned int kCorners = sizeof(corners) / sizeof(corners[0]);
+    const unsigned int kRandoms = 64;
+
+    bool is_ok = true;
+    uint32_t seed = 12345;
+    for (unsigned int i = 0; i < kCorners + kRandoms; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        const q31_t a = i < kCorners ? corners[i] : static_cast<q31_t>(seed);
+        for (unsigned int j = 0; j < kCorners + kRandoms; j++) {
+            seed = seed * 1664525u + 1013904223u;
+            const q31_t b = j < kCorners ? corners[j] : static_cast<q31_t>(seed);
+            is_ok = is_ok && SaturatingAdd(a, b) == reference::SaturatingAdd(a, b);
+            is_ok = is_ok && SaturatingSub(a, b) == reference::SaturatingSub(a, b);
+            is_ok = is_ok && MultiplyQ31(a, b) == reference::MultiplyQ31(a, b);
+        }
+        is_ok = is_ok && FloatToQ31(Q31ToFloat(a)) == reference::FloatToQ31(Q31ToFloat(a));
+    }
+    for (float x : floats)
+        is_ok = is_ok && FloatToQ31(x) == reference::FloatToQ31(x);
+    return is_ok;
+}
+
+} /* namespace audio */
+
+#endif /* Q31_HPP_ */
@@ -0,0 +1,197 @@
+/**
+ * @file q31blockexchanger.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Q31 block exchange of the audio task, on the circular DMA.
+ */
+
+#ifndef Q31BLOCKEXCHANGER_HPP_
+#define Q31BLOCKEXCHANGER_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+#include "audioblock.hpp"
+#include "interruptaudio.hpp"
+#include "murasaki.hpp"
+#include "tasknotification.hpp"
+
+namespace audio {
+
+/**
+ * @brief Exchange of the Q31 blocks between the audio task and the circular DMA.
+ * @details
+ * murasaki::DuplexAudio exchanges only the float blocks. This class replaces it in the Q31 processing of
+ * the audio task. The DMA buffers have the same layout as audio::InterruptAudio. Each buffer has two halves
+ * of a block, and each half is the interleaved stereo block of the DMA words. The DMA is started by
+ * the platform with TxBuffer(), RxBuffer() and DmaWords().
+ *
+ * The interrupt of the reception calls OnHalfTransfer() or OnFullTransfer(). They record the received half,
+ * and wake up the audio task by audio::TaskNotification. Exchange() of the audio task writes the block
+ * processed in the last call into its half of the transmission buffer, waits for the next half,
+ * and takes the received samples as Q31. The words are converted only by the swap of the halves
+ * and the deinterleave. The latency from the input to the output is 2 blocks, as like the
+ * murasaki::DuplexAudio.
+ *
+ * The block must be processed within a block period. Otherwise, the transmission DMA sends the half
+ * not yet written. If the audio task is late by a block or more, Exchange() takes the latest half,
+ * and the missed halves are counted by audio::XrunMonitor of the platform.
+ *
+ * The memory is given by the caller. InterruptAudio::DmaStorageSize() and InterruptAudio::StorageSize()
+ * give the number of the 32bit words and the samples.
+ */
+class Q31BlockExchanger {
+ public:
+    /**
+     * @param order Order of the halves of a sample in the DMA buffer.
+     * @param max_length Maximum number of the samples per channel of a block.
+     * @param dma_storage Memory of InterruptAudio::DmaStorageSize(max_length) words. Not owned.
+     * @param storage Memory of InterruptAudio::StorageSize(max_length) samples. Not owned.
+     * @details
+     * The block length is set to max_length. Change it by SetLength() while the DMA is stopped.
+     */
+    Q31BlockExchanger(DmaWordOrder order, unsigned int max_length, int32_t *dma_storage, q31_t *storage)
+            : order_(order),
+              max_length_(max_length),
+              dma_storage_(dma_storage),
+              storage_(storage),
+              length_(0),
+              tx_(nullptr),
+              rx_(nullptr),
+              received_(0),
+              offset_(0),
+              is_processed_(false) {
+        MURASAKI_ASSERT(nullptr != dma_storage)
+        MURASAKI_ASSERT(nullptr != storage)
+        Resize(max_length);
+    }
+
+    /**
+     * @brief Make the calling task the receiver of the blocks.
+     * @details
+     * Called by the audio task once, before the DMA is started.
+     */
+    void Attach() {
+        notification_.Attach();
+    }
+
+    /**
+     * @brief Change the block length, and clear the DMA buffers.
+     * @param length Number of the samples per channel. 1 to max_length.
+     * @details
+     * Called by the attached task while the DMA is stopped. The block being processed and the halves
+     * received before are discarded.
+     */
+    void SetLength(unsigned int length) {
+        Resize(length);
+        notification_.Clear();
+    }
+
+    /**
+     * @return Number of the samples per channel of a block.
+     */
+    unsigned int Length() const {
+        return length_;
+    }
+
+    /**
+     * @return Transmission buffer of DmaWords() words.
+     */
+    int32_t* TxBuffer() {
+        return tx_;
+    }
+
+    /**
+     * @return Reception buffer of DmaWords() words.
+     */
+    int32_t* RxBuffer() {
+        return rx_;
+    }
+
+    /**
+     * @return Number of the 32bit words of a circular buffer, both halves.
+     */
+    unsigned int DmaWords() const {
+        return 2 * 2 * length_;
+    }
+
+    /**
+     * @brief Hand the first half to the audio task. Called by the half transfer interrupt of the reception.
+     */
+    void OnHalfTransfer() {
+        received_.store(0, std::memory_order_release);
+        notification_.GiveFromIsr();
+    }
+
+    /**
+     * @brief Hand the second half to the audio task. Called by the transfer complete interrupt of the reception.
+     */
+    void OnFullTransfer() {
+        received_.store(2 * length_, std::memory_order_release);
+        notification_.GiveFromIsr();
+    }
+
+    /**
+     * @brief Transmit the last processed block and receive a new block.
+     * @return View of the received block. The samples have to be processed in place.
+     * @details
+     * Called by the attached task. Block until the next half is received.
+     * The returned view is valid until the next call.
+     */
+    StereoBlock<q31_t> Exchange() {
+        if (is_processed_) {
+            int32_t *const tx = tx_ + offset_;
+            for (unsigned int i = 0; i < length_; i++) {
+                tx[2 * i] = InterruptAudio::ToDmaWord(block_.left[i], order_);
+                tx[2 * i + 1] = InterruptAudio::ToDmaWord(block_.right[i], order_);
+            }
+        }
+
+        notification_.Wait();
+        offset_ = received_.load(std::memory_order_acquire);
+
+        const int32_t *const rx = rx_ + offset_;
+        for (unsigned int i = 0; i < length_; i++) {
+            block_.left[i] = InterruptAudio::FromDmaWord(rx[2 * i], order_);
+            block_.right[i] = InterruptAudio::FromDmaWord(rx[2 * i + 1], order_);
+        }
+        is_processed_ = true;
+        return block_;
+    }
+
+ private:
+    Q31BlockExchanger(const Q31BlockExchanger&);
+    Q31BlockExchanger& operator=(const Q31BlockExchanger&);
+
+    void Resize(unsigned int length) {
+        MURASAKI_ASSERT(0 < length && length <= max_length_)
+        length_ = length;
+        tx_ = dma_storage_;
+        rx_ = dma_storage_ + DmaWords();
+        for (unsigned int i = 0; i < 2 * DmaWords(); i++)
+            dma_storage_[i] = 0;
+        block_.left = ChannelSpan<q31_t>(storage_, length);
+        block_.right = ChannelSpan<q31_t>(storage_ + max_length_, length);
+        is_processed_ = false;
+    }
+
+    const DmaWordOrder order_;
+    const unsigned int max_length_;
+    int32_t *const dma_storage_;
+    q31_t *const storage_;
+    unsigned int length_;
+    int32_t *tx_;
+    int32_t *rx_;
+    // Offset of the half received last. Written by the DMA interrupt.
+    std::atomic<unsigned int> received_;
+    // Offset of the half of the block returned by the last Exchange().
+    unsigned int offset_;
+    bool is_processed_;
+    TaskNotification notification_;
+    StereoBlock<q31_t> block_;
+};
+
+} /* namespace audio */
+
+#endif /* Q31BLOCKEXCHANGER_HPP_ */
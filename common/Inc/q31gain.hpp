@@ -0,0 +1,97 @@
+/**
+ * @file q31gain.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Stereo gain stage in Q31.
+ */
+
+#ifndef Q31GAIN_HPP_
+#define Q31GAIN_HPP_
+
+#include "audioprocessor.hpp"
+#include "fastmath.hpp"
+#include "q31.hpp"
+
+namespace audio {
+
+/**
+ * @brief Stereo gain with saturation, in Q31.
+ * @details
+ * The gain is represented as mantissa * 2^shift, where the mantissa is Q31 and the shift is 0 to 7.
+ * Then, the gain up to +42dB is available without losing the precision.
+ *
+ * The mantissa of the power of 2 is 0.5, and MultiplyQ31() by 0.5 drops the LSB of the sample. Then, the
+ * gain of the power of 2 from 1 to 128, including the unity gain, is applied by the shift only. The unity gain passes the samples bit by bit.
+ *
+ * SetGain() is not synchronized with Process(). Call it from the audio task between the blocks.
+ * The new gain is applied at the next Process().
+ */
+class Q31Gain final : public Q31Processor {
+ public:
+    /**
+     * @brief Unity gain.
+     */
+    Q31Gain()
+            : mantissa_{ kUnityMantissa, kUnityMantissa },
+              shift_{ 1, 1 } {
+    }
+
+    /**
+     * @brief Set the linear gain of each channel.
+     * @param left_gain Left gain. 0.0 to 128.0.
+     * @param right_gain Right gain. 0.0 to 128.0.
+     */
+    void SetGain(float left_gain, float right_gain) {
+        Quantize(left_gain, &mantissa_[0], &shift_[0]);
+        Quantize(right_gain, &mantissa_[1], &shift_[1]);
+    }
+
+    /**
+     * @brief Set the gain of both channels.
+     * @param level Gain [dB]. Up to +42dB. 0dB is the exact unity gain.
+     */
+    void SetLevel(float level) {
+        const float gain = FastExp2(level / kDecibelPerLog2);
+        SetGain(gain, gain);
+    }
+
+    virtual void Process(const StereoBlock<q31_t> &block) {
+        Apply(block.left, mantissa_[0], shift_[0]);
+        Apply(block.right, mantissa_[1], shift_[1]);
+    }
+
+ private:
+    // The mantissa of the gain of the power of 2. 0.5 in Q31.
+    static const q31_t kUnityMantissa = 0x40000000;
+
+    static void Quantize(float gain, q31_t *mantissa, unsigned int *shift) {
+        unsigned int s = 0;
+        // Normalize the gain into [0, 1.0).
+        while (gain >= 1.0f && s < 7) {
+            gain *= 0.5f;
+            s++;
+        }
+        *mantissa = FloatToQ31(gain);
+        *shift = s;
+    }
+
+    static void Apply(const ChannelSpan<q31_t> &channel, q31_t mantissa, unsigned int shift) {
+        const unsigned int length = channel.Length();
+        if (mantissa == kUnityMantissa && shift > 0) {
+            // Power of 2. Exact.
+            for (unsigned int i = 0; i < length; i++)
+                channel[i] = SaturatingShiftLeft(channel[i], shift - 1);
+            return;
+        }
+        for (unsigned int i = 0; i < length; i++)
+            channel[i] = SaturatingShiftLeft(MultiplyQ31(channel[i], mantissa), shift);
+    }
+
+    q31_t mantissa_[2];
+    unsigned int shift_[2];
+};
+
+} /* namespace audio */
+
+#endif /* Q31GAIN_HPP_ */
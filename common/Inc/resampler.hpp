@@ -0,0 +1,540 @@
+/**
+ * @file resampler.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Polyphase sample rate converter.
+ * @details
+ * The coefficients of the polyphase filter are computed by the compiler into a constexpr table.
+ * Then, the table is placed in the flash.
+ */
+
+#ifndef RESAMPLER_HPP_
+#define RESAMPLER_HPP_
+
+#include <stdint.h>
+
+#include "audioblock.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+#ifndef AUDIO_CONFIG_RESAMPLING
+#define AUDIO_CONFIG_RESAMPLING false
+#endif
+
+#ifndef AUDIO_CONFIG_PROCESSING_RATE
+#define AUDIO_CONFIG_PROCESSING_RATE 44100
+#endif
+
+namespace audio {
+
+namespace resamplerdetail {
+
+// Functions evaluated by the compiler. Accurate enough for the float table.
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Sine of any x, by the Taylor series in [-pi, pi].
+constexpr double Sine(double x) {
+    while (x > kPi)
+        x -= 2.0 * kPi;
+    while (x < -kPi)
+        x += 2.0 * kPi;
+    double term = x;
+    double sum = x;
+    for (int n = 3; n < 40; n += 2) {
+        term *= -x * x / ((n - 1) * n);
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double SquareRoot(double x) {
+    double y = (x > 1.0) ? x : 1.0;
+    for (int i = 0; i < 40; i++)
+        y = 0.5 * (y + x / y);
+    return y;
+}
+
+// Modified Bessel function of the first kind, order 0.
+constexpr double BesselI0(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k < 40; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+// Kaiser windowed sinc. x in the input samples. Zero outside of [-half, half].
+constexpr double WindowedSinc(double x, double cutoff, double half, double beta, double i0_beta) {
+    if (x <= -half || x >= half)
+        return 0.0;
+    const double ratio = x / half;
+    const double window = BesselI0(beta * SquareRoot(1.0 - ratio * ratio)) / i0_beta;
+    const double sinc = (x == 0.0) ? 2.0 * cutoff : Sine(2.0 * kPi * cutoff * x) / (kPi * x);
+    return sinc * window;
+}
+
+}  // namespace resamplerdetail
+
+/**
+ * @brief Cutoff frequency of the anti-aliasing filter, normalized by the input rate.
+ * @param input_rate Input sampling frequency [Hz].
+ * @param output_rate Output sampling frequency [Hz].
+ * @param taps Number of the taps of a phase.
+ * @details
+ * The transition band of the Kaiser window of beta 8 is 5 / taps of the input rate. The cutoff is
+ * placed to start the stopband at the Nyquist frequency of the lower rate. With ResamplerTaps(),
+ * the passband is flat up to 0.38 of the lower rate.
+ */
+constexpr double ResamplerCutoff(unsigned int input_rate, unsigned int output_rate, unsigned int taps) {
+    return 0.5 * ((input_rate < output_rate) ? input_rate : output_rate) / input_rate - 2.5 / taps;
+}
+
+/**
+ * @brief Coefficients of the polyphase filter.
+ * @tparam P Number of the phases between the adjacent input samples.
+ * @tparam T Number of the taps of a phase. Even number. The transition band is narrower by more taps.
+ * @details
+ * The prototype filter is the Kaiser windowed sinc of P x T taps at P times of the input rate.
+ * The stopband attenuation is 80dB.
+ * value[p x T + k] is the coefficient of the phase p / P for the tap k. The phase P is included,
+ * to interpolate the phases between P - 1 and P.
+ *
+ * Define the table as constexpr, to compute it by the compiler.
+ */
+template<unsigned int P, unsigned int T>
+struct PolyphaseTable {
+    static const unsigned int kPhases = P;    ///< Number of the phases.
+    static const unsigned int kTaps = T;      ///< Number of the taps of a phase.
+    float value[(P + 1) * T];                 ///< Coefficients.
+
+    /**
+     * @param input_rate Input sampling frequency [Hz].
+     * @param output_rate Output sampling frequency [Hz].
+     */
+    constexpr PolyphaseTable(unsigned int input_rate, unsigned int output_rate)
+            : value() {
+        const double beta = 8.0;
+        const double i0_beta = resamplerdetail::BesselI0(beta);
+        for (unsigned int p = 0; p <= P; p++)
+            for (unsigned int k = 0; k < T; k++)
+                value[p * T + k] = static_cast<float>(resamplerdetail::WindowedSinc(
+                        static_cast<double>(p) / P + T / 2 - 1.0 - k,
+                        ResamplerCutoff(input_rate, output_rate, T),
+                        T / 2,
+                        beta,
+                        i0_beta));
+    }
+};
+
+/**
+ * @brief Number of the taps for the input rate. 64 per 48kHz.
+ * @details
+ * The transition band in Hz is the same for any input rate.
+ */
+constexpr unsigned int ResamplerTaps(unsigned int input_rate) {
+    return 64 * ((input_rate + 47999) / 48000);
+}
+
+/**
+ * @brief Number of the phases for the conversion.
+ * @details
+ * The integer ratio uses only a few phases without the interpolation. Then, 64 phases are enough.
+ * The other ratio needs 128 phases, to keep the THD+N around -95dB.
+ */
+constexpr unsigned int ResamplerPhases(unsigned int input_rate, unsigned int output_rate) {
+    return (input_rate % output_rate == 0 || output_rate % input_rate == 0) ? 64 : 128;
+}
+
+/**
+ * @brief PolyphaseTable of the phases and taps suitable for the conversion.
+ * @details
+ * constexpr ResamplerTable<48000, 44100> table(48000, 44100);
+ */
+template<unsigned int I, unsigned int O>
+using ResamplerTable = PolyphaseTable<ResamplerPhases(I, O), ResamplerTaps(I)>;
+
+/**
+ * @brief Reference to a PolyphaseTable, without its size in the type.
+ */
+struct PolyphaseFilter {
+    unsigned int phases;            ///< Number of the phases.
+    unsigned int taps;              ///< Number of the taps of a phase.
+    const float *coefficients;      ///< (phases + 1) x taps coefficients.
+
+    template<unsigned int P, unsigned int T>
+    constexpr PolyphaseFilter(const PolyphaseTable<P, T> &table)
+            : phases(P),
+              taps(T),
+              coefficients(table.value) {
+    }
+};
+
+/**
+ * @brief Greatest common divisor.
+ */
+constexpr unsigned int GreatestCommonDivisor(unsigned int a, unsigned int b) {
+    return (b == 0) ? a : GreatestCommonDivisor(b, a % b);
+}
+
+/**
+ * @brief Stereo polyphase sample rate converter.
+ * @details
+ * The position of the output sample on the input is kept as the integer index and the fraction
+ * numerator / denominator. The coefficients at the fraction are interpolated linearly between the
+ * adjacent phases of the table. Then, any ratio is converted by the same table.
+ *
+ * @li Fixed ratio : SetRatio(input_rate, output_rate). The step is the exact rational number.
+ *     The output has no drift against the input for ever.
+ * @li Adaptive ratio : SetAdaptiveRatio(ratio). The step is a fixed point number of 20 fraction bits.
+ *     The ratio can be changed at each block without discontinuity. For example, the ratio is
+ *     controlled by the fill level of a FIFO between the asynchronous clock domains.
+ *
+ * The input is appended to the history, and the output samples are generated as far as the input allows.
+ * The latency is taps / 2 input samples. The ratio is up to taps / 2.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ */
+class PolyphaseResampler {
+ public:
+    /**
+     * @brief Number of the floats of the storage.
+     * @param taps Number of the taps of a phase.
+     * @param max_input Maximum number of the input samples per Process().
+     */
+    static constexpr unsigned int StorageSize(unsigned int taps, unsigned int max_input) {
+        return 2 * (taps + max_input);    // History and input of the two channels.
+    }
+
+    /**
+     * @brief Constructor.
+     * @param filter Coefficients. Referred, not copied.
+     * @param max_input Maximum number of the input samples per Process().
+     * @param storage Memory of StorageSize(filter.taps, max_input) floats. Not owned.
+     * @details
+     * The ratio is 1.
+     */
+    PolyphaseResampler(const PolyphaseFilter &filter, unsigned int max_input, float *storage)
+            : filter_(filter),
+              capacity_(filter.taps + max_input),
+              left_(storage),
+              right_(storage + filter.taps + max_input),
+              step_integer_(1),
+              step_fraction_(0),
+              denominator_(1),
+              inverse_denominator_(1.0f) {
+        MURASAKI_ASSERT(filter.taps >= 2 && (filter.taps & 1) == 0)
+        MURASAKI_ASSERT(nullptr != storage)
+        Reset();
+    }
+
+    /**
+     * @brief Set the fixed ratio.
+     * @param input_rate Input sampling frequency [Hz].
+     * @param output_rate Output sampling frequency [Hz].
+     */
+    void SetRatio(unsigned int input_rate, unsigned int output_rate) {
+        const unsigned int gcd = GreatestCommonDivisor(input_rate, output_rate);
+        SetStep(input_rate / gcd, output_rate / gcd);
+    }
+
+    /**
+     * @brief Set the adaptive ratio.
+     * @param ratio Input samples per output sample. Up to taps / 2.
+     * @details
+     * The phase is kept. Then, the ratio can be changed between the blocks without discontinuity.
+     */
+    void SetAdaptiveRatio(float ratio) {
+        const uint32_t denominator = 1u << 20;
+        SetStep(static_cast<uint32_t>(ratio * denominator + 0.5f), denominator);
+    }
+
+    /**
+     * @brief Clear the history.
+     */
+    void Reset() {
+        // The history of taps / 2 - 1 zeros. Then, the first output is at the first input sample.
+        for (unsigned int i = 0; i < capacity_; i++) {
+            left_[i] = 0.0f;
+            right_[i] = 0.0f;
+        }
+        fill_ = filter_.taps / 2 - 1;
+        index_ = filter_.taps / 2 - 1;
+        fraction_ = 0;
+    }
+
+    /**
+     * @brief Maximum number of the output samples of Process().
+     * @param input Number of the input samples.
+     */
+    unsigned int MaxOutput(unsigned int input) const {
+        return static_cast<unsigned int>(static_cast<uint64_t>(input) * denominator_
+                / (static_cast<uint64_t>(step_integer_) * denominator_ + step_fraction_)) + 2;
+    }
+
+    /**
+     * @brief Convert a block.
+     * @param input Input samples. Up to max_input of the constructor.
+     * @param left Receives the output samples of the left channel. MaxOutput() samples at most.
+     * @param right Receives the output samples of the right channel.
+     * @return Number of the output samples.
+     */
+    AUDIO_ITCM_KERNEL(resampler_process) unsigned int Process(const StereoBlock<float> &input, float *left, float *right) {
+        const unsigned int taps = filter_.taps;
+        const unsigned int half = taps / 2;
+        const unsigned int length = input.Length();
+        MURASAKI_ASSERT(fill_ + length <= capacity_)
+
+        for (unsigned int i = 0; i < length; i++) {
+            left_[fill_ + i] = input.left[i];
+            right_[fill_ + i] = input.right[i];
+        }
+        fill_ += length;
+
+        // Output at index_ + fraction_ / denominator_ needs the inputs up to index_ + half.
+        unsigned int count = 0;
+        while (index_ + half < fill_) {
+            const uint32_t scaled = fraction_ * filter_.phases;
+            const uint32_t phase = scaled / denominator_;
+            const float weight = static_cast<float>(scaled - phase * denominator_) * inverse_denominator_;
+            const float *const h0 = filter_.coefficients + phase * taps;
+            const float *const h1 = h0 + taps;
+            const float *const l = left_ + index_ + 1 - half;
+            const float *const r = right_ + index_ + 1 - half;
+
+            float yl = 0.0f, yr = 0.0f;
+            for (unsigned int k = 0; k < taps; k++) {
+                const float h = h0[k] + weight * (h1[k] - h0[k]);
+                yl += h * l[k];
+                yr += h * r[k];
+            }
+            left[count] = yl;
+            right[count] = yr;
+            count++;
+
+            index_ += step_integer_;
+            fraction_ += step_fraction_;
+            if (fraction_ >= denominator_) {
+                fraction_ -= denominator_;
+                index_++;
+            }
+        }
+
+        // Discard the inputs older than the next output needs.
+        const unsigned int first = index_ + 1 - half;
+        for (unsigned int i = first; i < fill_; i++) {
+            left_[i - first] = left_[i];
+            right_[i - first] = right_[i];
+        }
+        fill_ -= first;
+        index_ -= first;
+        return count;
+    }
+
+ private:
+    // Step of numerator / denominator input samples per output sample.
+    void SetStep(uint32_t numerator, uint32_t denominator) {
+        MURASAKI_ASSERT(numerator != 0 && numerator <= (filter_.taps / 2) * denominator)
+        MURASAKI_ASSERT(static_cast<uint64_t>(denominator) * filter_.phases <= UINT32_MAX)
+        fraction_ = static_cast<uint32_t>(static_cast<uint64_t>(fraction_) * denominator / denominator_);
+        step_integer_ = numerator / denominator;
+        step_fraction_ = numerator % denominator;
+        denominator_ = denominator;
+        inverse_denominator_ = 1.0f / denominator;
+    }
+
+    const PolyphaseFilter filter_;
+    const unsigned int capacity_;
+    float *const left_;        // capacity_ samples.
+    float *const right_;       // capacity_ samples.
+    unsigned int fill_;        // Number of the samples in the buffer.
+    unsigned int index_;       // Integer part of the position of the next output.
+    uint32_t fraction_;        // Fraction part of the position, as the numerator.
+    uint32_t step_integer_;
+    uint32_t step_fraction_;
+    uint32_t denominator_;
+    float inverse_denominator_;
+};
+
+/**
+ * @brief Processing at another rate than the CODEC.
+ * @details
+ * The received block is converted to the processing rate by ToProcessingRate(). Then, the
+ * processing stages run on the returned block. At last, FromProcessingRate() converts it back
+ * to the CODEC rate into the original block.
+ *
+ * The ratio is fixed. The number of the samples at the processing rate changes block by block.
+ * Then, the stages must accept any block length. The converted output is kept in a FIFO, and
+ * the block length samples are taken from it. The FIFO is filled by zeros of Latency() samples at
+ * first, to absorb the delay of the two filters and the change of the number of the samples.
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ */
+class ResamplingStage {
+ public:
+    /**
+     * @brief Maximum number of the samples at the processing rate per block.
+     */
+    static constexpr unsigned int ProcessingLength(unsigned int max_block, unsigned int codec_rate, unsigned int processing_rate) {
+        return static_cast<unsigned int>((static_cast<uint64_t>(max_block) * processing_rate + codec_rate - 1) / codec_rate) + 2;
+    }
+
+    /**
+     * @brief Number of the floats of the storage.
+     * @param to_processing Filter from the CODEC rate to the processing rate.
+     * @param to_codec Filter from the processing rate to the CODEC rate.
+     * @param max_block Maximum block length at the CODEC rate.
+     * @param codec_rate Sampling frequency of the CODEC [Hz].
+     * @param processing_rate Sampling frequency of the processing [Hz].
+     */
+    static constexpr unsigned int StorageSize(const PolyphaseFilter &to_processing,
+                                              const PolyphaseFilter &to_codec,
+                                              unsigned int max_block,
+                                              unsigned int codec_rate,
+                                              unsigned int processing_rate) {
+        return PolyphaseResampler::StorageSize(to_processing.taps, max_block)
+        + PolyphaseResampler::StorageSize(to_codec.taps, ProcessingLength(max_block, codec_rate, processing_rate))
+        + 2 * ProcessingLength(max_block, codec_rate, processing_rate)                         // Processing block.
+        + 2 * FifoCapacity(to_processing, to_codec, max_block, codec_rate, processing_rate);   // FIFO.
+    }
+
+    /**
+     * @brief Constructor.
+     * @param to_processing Filter from the CODEC rate to the processing rate. PolyphaseTable(codec_rate, processing_rate).
+     * @param to_codec Filter from the processing rate to the CODEC rate. PolyphaseTable(processing_rate, codec_rate).
+     * @param max_block Maximum block length at the CODEC rate.
+     * @param codec_rate Sampling frequency of the CODEC [Hz].
+     * @param processing_rate Sampling frequency of the processing [Hz]. From the half to the double of codec_rate.
+     * @param storage Memory of StorageSize(to_processing, to_codec, max_block, codec_rate, processing_rate) floats. Not owned.
+     */
+    ResamplingStage(const PolyphaseFilter &to_processing,
+                    const PolyphaseFilter &to_codec,
+                    unsigned int max_block,
+                    unsigned int codec_rate,
+                    unsigned int processing_rate,
+                    float *storage)
+            : processing_length_(ProcessingLength(max_block, codec_rate, processing_rate)),
+              fifo_capacity_(FifoCapacity(to_processing, to_codec, max_block, codec_rate, processing_rate)),
+              to_processing_(to_processing, max_block, storage),
+              to_codec_(to_codec, processing_length_, storage + PolyphaseResampler::StorageSize(to_processing.taps, max_block)),
+              processing_left_(storage + PolyphaseResampler::StorageSize(to_processing.taps, max_block)
+                      + PolyphaseResampler::StorageSize(to_codec.taps, processing_length_)),
+              processing_right_(processing_left_ + processing_length_),
+              fifo_left_(processing_right_ + processing_length_),
+              fifo_right_(fifo_left_ + fifo_capacity_),
+              latency_(Latency(to_processing, to_codec, codec_rate, processing_rate)),
+              underruns_(0) {
+        MURASAKI_ASSERT(2 * processing_rate >= codec_rate && processing_rate <= 2 * codec_rate)
+        to_processing_.SetRatio(codec_rate, processing_rate);
+        to_codec_.SetRatio(processing_rate, codec_rate);
+        Reset();
+    }
+
+    /**
+     * @brief Clear the state.
+     */
+    void Reset() {
+        to_processing_.Reset();
+        to_codec_.Reset();
+        for (unsigned int i = 0; i < latency_; i++) {
+            fifo_left_[i] = 0.0f;
+            fifo_right_[i] = 0.0f;
+        }
+        fifo_fill_ = latency_;
+    }
+
+    /**
+     * @brief Convert the received block to the processing rate.
+     * @param block Received block at the CODEC rate.
+     * @return Block at the processing rate. Valid until the next call.
+     */
+    StereoBlock<float> ToProcessingRate(const StereoBlock<float> &block) {
+        const unsigned int count = to_processing_.Process(block, processing_left_, processing_right_);
+        StereoBlock<float> processing;
+        processing.left = ChannelSpan<float>(processing_left_, count);
+        processing.right = ChannelSpan<float>(processing_right_, count);
+        return processing;
+    }
+
+    /**
+     * @brief Convert the processed block back to the CODEC rate.
+     * @param processing Block returned by ToProcessingRate(), after the processing.
+     * @param block Block given to ToProcessingRate(). Receives the output.
+     */
+    void FromProcessingRate(const StereoBlock<float> &processing, const StereoBlock<float> &block) {
+        fifo_fill_ += to_codec_.Process(processing, fifo_left_ + fifo_fill_, fifo_right_ + fifo_fill_);
+        MURASAKI_ASSERT(fifo_fill_ <= fifo_capacity_)
+
+        const unsigned int length = block.Length();
+        if (fifo_fill_ < length) {
+            // Not expected by the design. Fill the shortage by zero, and keep the latency.
+            underruns_++;
+            for (; fifo_fill_ < length; fifo_fill_++) {
+                fifo_left_[fifo_fill_] = 0.0f;
+                fifo_right_[fifo_fill_] = 0.0f;
+            }
+        }
+        for (unsigned int i = 0; i < length; i++) {
+            block.left[i] = fifo_left_[i];
+            block.right[i] = fifo_right_[i];
+        }
+        for (unsigned int i = length; i < fifo_fill_; i++) {
+            fifo_left_[i - length] = fifo_left_[i];
+            fifo_right_[i - length] = fifo_right_[i];
+        }
+        fifo_fill_ -= length;
+    }
+
+    /**
+     * @return Latency of the FIFO in the samples at the CODEC rate. The total latency of the conversion.
+     */
+    unsigned int Latency() const {
+        return latency_;
+    }
+
+    /**
+     * @return Number of the blocks which the FIFO didn't have enough samples. 0 is expected.
+     */
+    unsigned int Underruns() const {
+        return underruns_;
+    }
+
+ private:
+    // Change of the number of the samples by the fraction of the position.
+    static const unsigned int kFifoMargin = 4;
+
+    // Delay of the two filters at the CODEC rate, and the margin.
+    static constexpr unsigned int Latency(const PolyphaseFilter &to_processing,
+                                          const PolyphaseFilter &to_codec,
+                                          unsigned int codec_rate,
+                                          unsigned int processing_rate) {
+        return to_processing.taps / 2 + (to_codec.taps / 2 * codec_rate + processing_rate - 1) / processing_rate + kFifoMargin / 2;
+    }
+
+    static constexpr unsigned int FifoCapacity(const PolyphaseFilter &to_processing,
+                                               const PolyphaseFilter &to_codec,
+                                               unsigned int max_block,
+                                               unsigned int codec_rate,
+                                               unsigned int processing_rate) {
+        return max_block + Latency(to_processing, to_codec, codec_rate, processing_rate) + kFifoMargin;
+    }
+
+    const unsigned int processing_length_;
+    const unsigned int fifo_capacity_;
+    PolyphaseResampler to_processing_;
+    PolyphaseResampler to_codec_;
+    float *const processing_left_;     // processing_length_ samples.
+    float *const processing_right_;    // processing_length_ samples.
+    float *const fifo_left_;           // fifo_capacity_ samples.
+    float *const fifo_right_;          // fifo_capacity_ samples.
+    const unsigned int latency_;
+    unsigned int fifo_fill_;
+    unsigned int underruns_;
+};
+
+} /* namespace audio */
+
+#endif /* RESAMPLER_HPP_ */
@@ -0,0 +1,144 @@
+/**
+ * @file samplerate.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Run time selection of the sampling frequency.
+ */
+
+#ifndef SAMPLERATE_HPP_
+#define SAMPLERATE_HPP_
+
+#include <stdint.h>
+
+namespace audio {
+
+const unsigned int kSampleRate44k = 44100;     ///< CD rate.
+const unsigned int kSampleRate48k = 48000;     ///< Default rate.
+const unsigned int kSampleRate96k = 96000;     ///< High rate. Half latency per sample, double CPU load.
+
+/**
+ * @brief Current sampling frequency and the request to change it.
+ * @details
+ * The ADAU1361 is the clock master of the audio port, and generates the bit clock and the frame
+ * clock by its own PLL from the master clock. Then, the sampling frequency is changed by
+ * re-programming the CODEC only. The SAI and I2S of the MCU are the slave, and their clock
+ * configuration is not affected.
+ *
+ * The control side calls Request() at any time. The audio task checks IsChangeRequested() at
+ * the block boundary. If requested, the audio task stops the audio, calls Apply(), re-programs the
+ * CODEC, and restarts the audio. Then, it records the time of the switch by SetSwitchTime().
+ *
+ * Request() and Apply() are single word accesses, as like audio::BlockLength. The switch time is
+ * written by the audio task only. The control task reads it after it sees the new Switches().
+ */
+class SampleRate {
+ public:
+    /**
+     * @param rate Initial sampling frequency [Hz]. Must satisfy IsValid().
+     * @param is_switchable false to reject any change. For the processing fixed to the rate.
+     */
+    explicit SampleRate(unsigned int rate, bool is_switchable = true)
+            : current_(IsValid(rate) ? rate : kSampleRate48k),
+              request_(current_),
+              is_switchable_(is_switchable),
+              switches_(0),
+              switch_time_(0),
+              max_switch_time_(0) {
+    }
+
+    /**
+     * @brief Check whether the rate is supported.
+     * @param rate Sampling frequency [Hz].
+     * @return true if the rate is 44.1kHz, 48kHz or 96kHz. The ADAU1361 doesn't support 192kHz.
+     */
+    static bool IsValid(unsigned int rate) {
+        return rate == kSampleRate44k || rate == kSampleRate48k || rate == kSampleRate96k;
+    }
+
+    /**
+     * @return Sampling frequency currently in use [Hz].
+     */
+    unsigned int Get() const {
+        return current_;
+    }
+
+    /**
+     * @brief Request to change the sampling frequency.
+     * @param rate New sampling frequency [Hz].
+     * @return false if the rate is not valid, or the rate is not switchable. The request is ignored.
+     * @details
+     * Called from the control task. The change takes effect at the next block boundary
+     * of the audio task.
+     */
+    bool Request(unsigned int rate) {
+        if (!IsValid(rate) || (!is_switchable_ && rate != current_))
+            return false;
+        request_ = rate;
+        return true;
+    }
+
+    /**
+     * @return true if the requested rate differs from the current one.
+     */
+    bool IsChangeRequested() const {
+        return request_ != current_;
+    }
+
+    /**
+     * @brief Adopt the requested rate.
+     * @return New sampling frequency [Hz].
+     * @details
+     * Called from the audio task while the audio is stopped.
+     */
+    unsigned int Apply() {
+        current_ = request_;
+        return current_;
+    }
+
+    /**
+     * @brief Record the time of the switch.
+     * @param cycles Cycles from the stop of the old audio to the restart by the new rate.
+     * @details
+     * Called from the audio task after Apply().
+     */
+    void SetSwitchTime(uint32_t cycles) {
+        switch_time_ = cycles;
+        if (cycles > max_switch_time_)
+            max_switch_time_ = cycles;
+        switches_ = switches_ + 1;
+    }
+
+    /**
+     * @return Number of the switches done.
+     */
+    unsigned int Switches() const {
+        return switches_;
+    }
+
+    /**
+     * @return Cycles of the last switch.
+     */
+    uint32_t SwitchTime() const {
+        return switch_time_;
+    }
+
+    /**
+     * @return Cycles of the longest switch.
+     */
+    uint32_t MaxSwitchTime() const {
+        return max_switch_time_;
+    }
+
+ private:
+    volatile unsigned int current_;
+    volatile unsigned int request_;
+    const bool is_switchable_;
+    volatile unsigned int switches_;
+    volatile uint32_t switch_time_;
+    volatile uint32_t max_switch_time_;
+};
+
+} /* namespace audio */
+
+#endif /* SAMPLERATE_HPP_ */
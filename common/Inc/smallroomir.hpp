@@ -0,0 +1,542 @@
+/**
+ * @file smallroomir.hpp
+ *
+ * @brief Impulse response spectra for audio::PartitionedConvolver.
+ * @details
+ * Generated by host-sim/tools/irspectrum.cpp. Do not edit.
+ * @li Source : Synthesized room, RT60 0.300000 S at 48000 Hz
+ * @li Taps : 2048
+ * @li Partition size : 128
+ */
+
+#ifndef SMALLROOMIR_HPP_
+#define SMALLROOMIR_HPP_
+
+#include "partitionedconvolver.hpp"
+
+namespace audio {
+
+const float kSmallRoomIrBins[] = {
+        0.00279678148, 0, 0.00486714346, 0.000474666274, 0.00331796706, -0.00075952668, 0.00407857029, 0.000763667747,
+        0.00400032569, -0.000541479443, 0.00379922474, 0.00026229152, 0.00381170702, -0.000119919292, 0.00425641006, 0.000230350168,
+        0.0034446416, -0.000571066397, 0.00420054654, 0.000992216868, 0.00406254129, -0.00129130564, 0.00314116944, 0.00131044758,
+        0.00524656335, -0.00100585166, 0.00219383743, 0.000456998067, 0.00570796337, 0.000183052733, 0.00227275607, -0.000764056633,
+        0.00520627759, 0.00119869877, 0.00300801243, -0.00147715583, 0.00438805716, 0.00163579732, 0.0038524908, -0.00170636852,
+        0.00350462832, 0.00168111012, 0.00477950694, -0.00151646743, 0.00260867784, 0.00117197423, 0.00547886174, -0.000657762634,
+        0.00229993695, 5.78629551e-05, 0.00527716009, 0.000489393598, 0.00297611253, -0.000846680545, 0.0043268525, 0.000939475605,
+        0.00391139789, -0.000790134887, 0.00366194174, 0.000504974741, 0.0041898787, -0.000221201568, 0.00371279172, 4.25151811e-05,
+        0.00398797216, 2.56722706e-06, 0.00387110165, 4.02271908e-05, 0.00398643641, -8.96044803e-05, 0.00372380763, 7.96105232e-05,
+        0.00418605469, 7.35292997e-06, 0.00358105917, -0.000142108518, 0.00421761675, 0.000278986408, 0.00364216627, -0.000391353329,
+        0.00411787396, 0.000487166428, 0.00375149678, -0.000594161043, 0.00396690425, 0.000726006925, 0.00401835889, -0.000855199585,
+        0.00353330187, 0.00091573305, 0.00457797898, -0.000839645509, 0.00299804471, 0.000607722672, 0.00488668215, -0.000281356974,
+        0.00305815041, -1.05256331e-05, 0.00447897054, 0.000130677974, 0.00360140437, -1.09956018e-05, 0.00412262231, -0.00029538275,
+        0.0034975796, 0.000622230116, 0.004751937, -0.000763037824, 0.00255320431, 0.000576293212, 0.0055979304, -6.90768356e-05,
+        0.00223210221, -0.000588770956, 0.00517173298, 0.00113417045, 0.00329217315, -0.00133433868, 0.00389763038, 0.00110377616,
+        0.00424020598, -0.000553857943, 0.00367994234, -5.37805026e-05, 0.00365778501, 0.000430197775, 0.00475919619, -0.000398527249,
+        0.00261259521, -2.02537049e-05, 0.00527152885, 0.00061929092, 0.00285492721, -0.00111063139, 0.00443643425, 0.00127075065,
+        0.00382308755, -0.0010538405, 0.00385646755, 0.000615912839, 0.00370077929, -0.000237456115, 0.00462051295, 0.000182886841,
+        0.00271332753, -0.000565898779, 0.00524824159, 0.0012860666, 0.00291747577, -0.00206655869, 0.00407846645, 0.00257399492,
+        0.00477390317, -0.00256368564, 0.00211823173, 0.00198423304, 0.00618856167, -0.000997403287, 0.00170810102, -9.02626634e-05,
+        0.00549274217, 0.000948971487, 0.00323783886, -0.00134596601, 0.00364803104, 0.00121697725, 0.00483434275, -0.000667615561,
+        0.0027159485, -8.51771911e-05, 0.00494362647, 0.000799778616, 0.00332470867, -0.00128835521, 0.00390397687, 0.00146196526,
+        0.00444621453, -0.00133529166, 0.00299954112, 0.000999768381, 0.00495620817, -0.000581472064, 0.00291877263, 0.000199479677,
+        0.00469351001, 6.48254718e-05, 0.00336821191, -0.000182596326, 0.00422499003, 0.000175549838, 0.00373163447, -9.90886329e-05,
+        0.00401302939, 1.56185197e-05, 0.00382711156, 3.32462587e-05, 0.00394734554, -4.48107603e-05, 0.00394887198, 5.50464611e-05,
+        0.00373770157, -0.000118345226, 0.00419623032, 0.000275429193, 0.00357040414, -0.000524931005, 0.00415172754, 0.000814228435,
+        0.00390389585, -0.0010565056, 0.00355490902, 0.00116741669, 0.00463477243, -0.00110340898, 0.00287258578, 0.000881591812,
+        0.00510964403, -0.000570113189, 0.00267655449, 0.000253974227, 0.00505968276, 4.83216718e-06, 0.00287348568, -0.000190388819,
+        0.00481216004, 0.000326255977, 0.00313471467, -0.000444130157, 0.00450604968, 0.000548445154, 0.00353824254, -0.000601463369,
+        0.00400422327, 0.000542126596, 0.00403801026, -0.000331073359, 0.00369306747, -4.24589962e-06, 0.00397291547, 0.000354924239,
+        0.00420655496, -0.000563275535, 0.00313712889, 0.000493836706, 0.00504821399, -0.000109635337, 0.00268379413, -0.000487577228,
+        0.00481622759, 0.0010804648, 0.00364537048, -0.00141950184, 0.00338830613, 0.0013317744, 0.00505252136, -0.000804283656,
+        0.00251965434, 0, 0.000425869715, 0, 0.00176445663, -0.000480438932, -0.000578247942, -0.000320992083,
+        0.00121207186, 0.000497795118, -7.68237514e-05, 0.00100011425, 0.00395935588, 0.00118233636, 0.00217255973, -0.00239680521,
+        0.00196947367, -0.00214582914, -0.00110763754, -0.00261816615, 0.00155915634, 0.000111049332, -0.000318218779, -0.00487163849,
+        -0.00378082134, 0.00102303794, 0.00242867973, 0.00112757087, 0.000214415486, -0.00296505378, -0.00117489276, -0.000119929144,
+        0.000864068745, -0.00128553237, -0.00134391198, -0.00154122128, -0.000444816309, -0.000767975696, -0.00145883276, -0.000904159853,
+        -0.000243130926, -0.000710477063, -0.0025791463, -0.00183237437, -0.00288533815, 0.00130867714, -0.0010747253, 0.00205001631,
+        0.000625833985, 0.000877695333, -0.00156619307, -4.91084938e-05, -0.000549393939, 0.00276856124, 0.00156112702, 0.00136580889,
+        0.00164679822, -0.000200180802, -0.000183495547, -0.001412082, -0.0014541077, 0.000289249932, -0.000578346779, 0.00179487909,
+        0.00120969978, 0.00141651439, 0.00114320521, 0.00053409359, 0.0013560619, -0.000402636768, -9.21141473e-05, 0.000160022522,
+        0.00183876045, -0.000170429004, -0.000834792736, -0.000840021763, 0.0015128071, 0.00114880374, 0.000462876225, -0.00135803327,
+        0.00168759201, 0.000332597585, 3.00961547e-05, -0.00401156116, -0.00366789382, 0.00105996337, 0.00172256795, 0.00253611174,
+        0.00214048801, -0.00159123866, -0.00109054334, -0.0014532872, -0.000154367561, 0.000214529689, -0.00133153005, 9.32405237e-06,
+        0.00117441779, 0.00300893956, 0.0036084028, -0.000987828244, 0.00137881818, -0.00255180919, -0.000339830789, -0.00278514414,
+        -0.00114772818, -0.00199092738, -0.00315141934, -0.00100689963, -0.00089635537, 0.00204036478, -0.00082497031, -0.000119811157,
+        0.000123030157, 0.00285863504, 0.00210560509, -0.000160305644, 0.00214533089, -0.00018217793, -0.0003893557, -0.00483446335,
+        -0.00440704031, 0.00263805501, 0.00298299105, 0.00135506422, -0.000991606852, 0.000384631334, 0.00347415102, 0.00168711529,
+        0.00218234048, -0.00172821281, 0.00296088564, -0.00236891769, -0.000869793468, -0.00442229118, -0.000966346939, -0.0013266101,
+        -0.00153159071, -0.00234208442, -0.00130838109, -0.000469230057, -0.00230246317, -0.00156519399, -0.00156850624, 0.00277999789,
+        0.00256979396, -0.000982875004, -0.00180476182, -0.00163418637, 0.000502998475, -0.000560542918, -0.00298894523, -0.00227014581,
+        -0.00144241785, 0.00280310819, 0.00111962995, -0.00102004781, -0.00203724601, -0.000204863492, -0.000127162799, 0.0013245591,
+        0.00156848831, -0.000393691938, -0.00146333547, -0.00340373279, -0.00410987763, 0.00202824082, 0.00171622715, 0.00230752025,
+        0.000332843192, -0.00132562197, -0.00148028671, -0.000354264281, -0.00115699507, 0.00154907303, 0.000367203844, 0.000701202487,
+        -0.000434060115, 0.00188263494, 0.00304937991, 0.000192332547, -0.00172500545, -0.00133403309, 0.0017687903, 0.00334559102,
+        0.00261592446, -0.00254635653, 6.76407071e-05, 0.000442332559, 0.00332067953, -0.00258730585, -0.00165427709, -0.00314829079,
+        -5.50360419e-05, -0.00111908326, -0.00159357185, -0.00251748646, -0.00208207034, -0.000775705907, -0.00253460906, 0.000242003705,
+        -0.000249677862, 0.00174188183, 0.000453244429, -0.000252265017, 0.000294660451, -0.000865701761, -0.00202022772, -0.00155615073,
+        -0.00158759207, 0.0019484174, 0.000821834954, 0.000550944591, 7.60166731e-05, -8.49810895e-05, 1.89737184e-05, 0.000165068021,
+        0.0014165655, -0.000271949277, -0.000782185351, -0.00224347692, -0.000325675705, 0.000963950646, 0.000716017268, -0.00264218682,
+        -0.00258964812, -0.000583970686, -0.000996642746, -0.00033499772, -0.0017088654, 0.00176305894, 0.00200911192, -0.000115828938,
+        -0.00193706353, -0.000814129016, 0.00130682543, 0.0016418763, 0.0010319096, -0.00211410085, -0.00030553696, -0.00114538264,
+        2.53541511e-05, -0.00203612959, -0.00174146297, -0.0028196671, -0.00380819058, -0.000864416244, -0.00220589805, 0.00132398005,
+        -0.00120765879, 0.0006494564, -0.00127225567, 0.000568311603, -0.00148183957, 0.000810963742, -0.00141661789, 0.00183155038,
+        0.000779033755, 0.00320722256, 0.00375790289, 0, 0.00159556139, 0, -0.00141754979, -0.000362353545,
+        0.00135778892, 0.00161531265, 0.00125099509, -0.000970737194, 0.000528769568, -0.00132126641, -0.00105544087, -0.000553773891,
+        0.000813413644, -0.000686229207, -0.00278265844, -0.0014897224, -0.0009069597, 0.0029587287, 0.00128606486, 0.000136704301,
+        -0.000345581968, -0.000157227536, -0.000495180662, 0.000539555331, -0.000300880405, 0.000502662151, -0.000964460836, 0.00233055977,
+        0.00363300601, 0.00226752507, 0.00166911166, -0.00250920746, -0.000275915139, 8.13432271e-05, 0.00158621813, -0.000554460566,
+        0.000146616658, -0.00301615614, -0.00430835504, -0.000740074902, -0.00086574076, 0.00343671092, -0.000436828821, 0.00121051096,
+        0.00125335599, 0.00385824917, 0.00287675555, -0.000153970614, 0.000872356526, 0.00102113571, 0.0027276536, -0.000120310317,
+        0.0012066433, -0.000873550307, 0.000872888719, -0.000405669212, 0.00212383689, -0.000180161558, 0.000800358015, -0.00310422992,
+        -0.00148900505, -7.22905388e-05, 0.000674712937, -9.04623885e-05, 0.000194110282, 0.0004336118, 0.00190876634, -0.000788226607,
+        -9.81287158e-05, -0.00169274723, -0.000739055162, -0.000601378968, 0.000356300618, 0.000856614672, 0.00126726145, -0.00199018326,
+        -0.00238764379, -0.000397798838, 0.000733365363, 0.00177146541, 0.00159414066, -0.000128279848, 0.00150274485, -0.00179684791,
+        -0.00125319348, -0.00181112206, -0.000696610659, 0.000212007668, 4.29608917e-05, 0.000120868543, 0.000583895366, -0.00072394259,
+        -0.000659459853, -0.00067436893, 8.70464137e-05, -0.000635975099, -0.00144315732, -0.000664116349, -0.000765287783, 0.000298965431,
+        -0.00170714851, 0.00113642192, 0.00143181975, 0.00233520893, 0.00127138768, -0.000324328605, 0.00175992236, -0.000388591608,
+        -0.000853068952, -0.00243054633, -0.000786566292, 0.00139398477, 0.000380837882, -0.000982382684, -0.000696635863, 0.00140277715,
+        0.00169948617, -0.000736198854, -0.000847411924, -0.000259390159, 0.000535692554, -0.00082457182, -0.00229136366, 0.00081502815,
+        0.00256022718, 0.00194275682, 0.000465701538, -0.00225333543, -0.000387561304, 0.00040750808, 0.000217561959, -0.00045648485,
+        0.000515423133, -4.28531785e-05, -0.000598867016, -0.00141597178, -0.000784042466, 0.00106019306, 0.000461479503, -0.000404221762,
+        -0.000638699392, 0.000447823317, 5.63059584e-05, 0.000245079398, 0.000572489807, 0.0015731937, 0.00255893753, -0.00166268239,
+        -0.00211222516, -0.0019218598, -0.000918266189, 0.00114028458, -0.000277217419, 0.000973474933, 0.00174059183, 0.000674746756,
+        -0.000102118647, -0.00214895443, -0.00205117417, 0.000848425669, 0.000552820333, 0.00176111457, 0.00117820199, 0.000496385212,
+        0.00128583447, -0.000430721382, -0.000119460572, -0.00131633098, -0.000832552731, -9.0475718e-05, -0.00149701978, 0.000111703193,
+        -0.0007555958, 0.00369106024, 0.00387292006, 0.00136036007, 0.00107816432, -0.000887483999, 0.00200581294, -4.44604084e-05,
+        0.000662501378, -0.00126303139, 0.00150287012, -0.000341778039, 0.000383533246, -0.00170618994, 0.0012922918, -0.000520092319,
+        -7.08524021e-05, -0.00336024538, -0.00200003362, -0.000287989911, -0.000456259178, -0.000315867364, -0.000564897433, 0.000882790191,
+        0.0014246651, -0.000521694426, -0.00074976834, -0.00124052982, -8.80287262e-05, 0.000315842102, 0.000632285606, -0.00104380399,
+        -0.00105712819, -0.00115755165, -0.000382647617, 1.0000309e-05, -0.00118067185, -0.000937349279, -0.00043807074, 0.00186364795,
+        0.00189145608, -0.00201126165, -0.00359702972, -0.00109477411, 0.000514689949, 0.00230294792, -0.000441703945, -0.00191491167,
+        -0.0015865349, 0.00169498799, 0.000368943554, -0.000402125355, -0.00180789165, 0.00211733393, 0.00364812464, 0.00097923982,
+        -0.000569325406, -0.00311255548, -0.000978042721, 0.00023498619, -0.00141736795, -0.0010052541, -0.00102790177, 0.00115821557,
+        -0.00156780984, -0.00106688472, -0.0033153398, 0.002935105, 0.000336584839, 0.00341633498, 0.00107359025, 0.00318008894,
+        0.00329502276, 0.00176010723, 0.00296549383, -0.00106568844, -0.000918492209, -0.00220060605, -0.000718032534, 0.00308720651,
+        0.00318456115, -0.000225104915, -0.000340323546, 0.000133388981, 0.00233701849, 0, 0.0023928904, 0,
+        0.00082422432, -0.00151803915, -8.51870573e-05, -0.000678999175, 1.51756103e-06, -0.000317512458, 3.88767221e-05, -0.000123670645,
+        0.00031682878, -0.000336043769, -0.00077588635, -0.000219609996, 0.000784623204, 0.0011581115, 0.000167315549, -0.00150023622,
+        -0.000846108829, 0.00192720932, 0.00230912608, -0.000369581627, -0.000471686886, 0.000167540915, 0.00223521283, -0.000583726913,
+        -0.00116474507, -0.000777545385, 0.00201315316, 0.000687185442, 0.000741333119, -0.00177106459, 0.00125141814, -0.00240028719,
+        -0.00386305945, -0.00270603364, -0.00092047482, 0.00272252876, -0.000208867656, -0.00109762826, -0.000952426984, 0.00170312368,
+        0.000674145995, 0.000268396805, 0.00126538915, 0.000557614607, 0.000102177262, -0.00298603554, -0.00319446204, 0.000948601868,
+        0.00102520001, 0.00211653509, 0.00178883772, -0.00070781057, -0.000963224273, -0.0024358884, -0.00191137521, 0.000831897312,
+        -0.00069934706, -0.000767098449, -0.00316552934, 0.00207122648, 0.00114734739, 0.00227769651, -0.00110697979, 0.00113491097,
+        0.00191674801, 0.00295484252, 0.00134757499, -0.000699532975, 0.000316710968, 0.000896228768, 0.000525147538, 1.53073343e-05,
+        0.000547450734, 0.00124689378, 0.000935365097, -0.000585438567, -0.00108018448, 0.00139610819, 0.00218826672, 0.00231594965,
+        0.00286647864, -0.000206344004, 0.00149758405, -0.00189623423, -0.000485639175, -0.000455860281, 0.00179267093, -0.000296595565,
+        -0.000760649622, -0.00275070313, -0.00246246532, 0.00113765174, 0.00072615809, 0.00207270356, 0.00147798134, 0.000376412645,
+        0.000586083974, -0.000460848911, 3.35176592e-05, 0.000719283998, 0.00171447417, 0.000324944704, 0.000242851966, -0.000663383806,
+        0.00141364592, 0.00075346441, 0.00113497803, -0.00223973067, -0.00135357212, -0.000301952823, -6.94843329e-05, 5.03302435e-05,
+        -0.000817241962, 0.00122874789, 0.00152056362, 0.00122564565, 0.000832775957, 0.000394093047, 0.00187772489, 0.00064540701,
+        0.00207972387, -0.000495462446, 0.00139722391, -0.00179487152, -0.000120380719, -0.000167832128, 0.00301059708, -0.000541495625,
+        0.00104698609, -0.00389114697, -0.00171654753, -0.00299970014, -0.00283212098, -0.000303826091, -0.000514354906, 0.00105422351,
+        0.000465182238, 0.000529280573, 0.00126791454, -0.00192212407, -0.00283961068, -0.00123656471, 0.000332494965, 0.000957701472,
+        -0.00208393973, -0.00177911436, -0.00156397978, 0.00288031925, 0.000980549259, 0.000243548478, -0.000861145498, 0.000944555039,
+        0.00134075165, 0.00117863819, 0.000813277788, -0.0014304684, -0.0021871645, -0.000552715093, -0.00160016189, 0.00249253563,
+        0.00158336584, 0.00353809982, 0.00351733202, -0.000812675047, -0.00122815627, 2.72899633e-05, 0.00387491542, 0.00155724993,
+        0.000549505814, -0.00355239701, 0.000153733476, 0.000626910711, 0.000431511318, -0.00205114274, -8.93346732e-05, 0.0004037373,
+        0.000484593911, -0.00207589031, -0.00120980025, -0.00028811986, -0.000748158083, -0.000826533767, -0.000767271791, 0.000994093018,
+        2.66549905e-05, -0.000904724991, -0.00136367464, 0.000947164954, 0.000507697463, -7.46966107e-05, -0.00165222958, 0.000216589397,
+        -0.000424058177, 0.00213373266, 0.00172819279, 0.00139495288, 0.000819224399, -0.000799399917, 0.000442722812, 0.000486159232,
+        0.000492961204, -0.00144438539, -0.0018761477, 0.000501760107, 0.00107798818, 0.00214052852, 0.002313426, -0.00173398713,
+        -0.00312693138, -0.00153946877, 0.000341988285, 0.00320042064, 0.00035915419, -0.00164668483, -0.000853595731, 0.00231209234,
+        0.00101295765, -0.00100923399, -0.00158366025, 0.00206262129, 0.00165201258, 0.000315076788, -0.00113728596, 0.00186951086,
+        0.0030050152, 0.00133074867, 0.000430832093, -0.000299165957, 0.0016300499, 0.00073621684, 0.00165997434, -0.000175419002,
+        0.00164326711, -0.00201389519, -0.00164270867, -0.00142047857, -0.00104976341, 0.000920474995, 0.000339290913, 0.00181413605,
+        0.00158562942, 0.000264498056, 0.00125495368, 0.000342855608, 0.00108694052, -0.0021048924, -0.00184981478, 0.000275705417,
+        0.000372182141, 0.000700039323, 1.55800699e-05, 0.00207986124, 0.0030280028, -0.000354461023, -0.000726474333, 0,
+        0.00582700968, 0, 0.00161833293, -0.00439325348, -0.00121160643, -0.000586155627, 0.00180102733, -0.00123567495,
+        -0.00142456265, -0.00242766226, -0.00107956736, 0.000430497428, 0.000239121087, 0.000387278647, 0.0014144755, -0.000641825551,
+        0.000231815968, -0.00213179551, -0.00103109179, -0.00227628415, -0.00303480844, -0.000264068425, 0.000319602434, 0.0016771456,
+        0.000414734532, -0.00182070653, -0.00165829051, -0.000652349554, -0.000711185741, -0.000413039728, -0.00207766867, -0.000773972541,
+        -0.00205948949, 0.00194678316, 0.00104208291, 0.00125378778, -0.000390253321, -0.000465545192, 0.000296407321, 0.000686118845,
+        -8.44016904e-05, -0.00173848006, -0.00269501517, 0.000468245154, 0.000558749191, 0.00186732167, 5.22736809e-05, -0.000932097668,
+        -0.000806286582, 0.000747036072, 8.48834752e-05, -0.000221699884, -0.000558103435, 0.000524808071, 1.33369758e-05, -0.000690722605,
+        -0.00150035415, 0.000868529198, 0.00112777995, 0.000218440196, -0.0011705393, -0.00118541112, -0.00177122257, 0.000344602857,
+        -0.00103000808, 0.00200919737, 0.000377952354, 0.000182889809, -0.00150242401, 0.00241069077, 0.00343120471, 0.000707638159,
+        -0.00163979304, -0.00138774817, 0.00118446909, 0.00149994111, -0.00132671103, -0.00114850863, 0.00100770872, 0.00262902002,
+        0.00080537505, -0.00223810063, -0.00148741656, 0.00065333501, -0.000677010859, 0.000657719094, 0.00103825564, 0.00221561291,
+        0.00118982699, -0.00137957174, -0.000301320222, 0.000543600705, -0.000154655194, -0.00155069365, -0.00276710629, 0.00235539279,
+        0.00272333808, 0.00283653312, 0.00176945236, -0.000876788516, 0.00047522111, 9.4917079e-05, 0.00127336464, -9.7646669e-05,
+        0.000317752478, -0.000338316488, 0.0013512444, 0.000483350712, 0.00120523211, -0.00079437223, 0.00177396846, -0.00031711912,
+        0.00131258531, -0.00242709811, 0.000310779375, -0.00156156952, -7.77265523e-05, -0.00258234842, -0.00129306689, -0.00120125851,
+        -0.000625597779, -0.000635989767, 0.000738673378, -0.00103467144, -0.00166749256, -0.00328526041, -0.00209772168, 0.000614405028,
+        -0.000518480199, -0.00197054958, -0.00316628674, 8.10660422e-05, -0.00135850185, 1.25080114e-05, -0.00235786801, 0.00169670256,
+        -3.25336878e-05, 0.000351141032, -0.00283510517, 0.00238903519, 0.00307446672, 0.00256163185, -0.000636470329, -0.00141097116,
+        0.000886065129, 0.00273642247, 0.00194221339, -0.00140633248, 0.000422429759, 1.4300982e-05, 0.000831423327, -0.00262626773,
+        -0.00280128303, 8.97889549e-05, 0.00153217174, 0.000780339877, -0.00131036912, -0.00164470926, 9.36567085e-06, 0.00151925604,
+        -9.44765052e-05, -0.00153813977, -0.00109145022, 0.00201899325, 0.00281318626, -0.000343177584, -0.000460563606, -0.00198260439,
+        -0.000262176269, -0.000642438477, -0.000911410141, -0.000750845007, -0.000125919265, 0.000164641358, 0.000315007521, -0.00105801946,
+        -0.000881716376, -0.00155800511, -0.00166463386, -0.000733818335, -0.00174197718, -0.000149686821, -0.00176436733, 0.000776917324,
+        -0.0010273573, 0.00157192477, 0.000480038114, 0.0016877387, 0.000711295754, 0.000467410311, 0.00151623203, 0.000935990771,
+        0.00213373359, -0.00218037493, -0.000909493596, -0.00212093233, -0.000732490153, -0.00178166036, -0.0028507479, -0.00105512491,
+        -0.00171514275, 0.00110791624, -0.000723629259, 0.00101419876, 0.00031871727, 0.000146461447, -0.00160189858, -0.000477514026,
+        -0.000665371947, 0.0021950393, 0.00181809382, 0.0001789089, -4.01447469e-05, -0.00181064312, -0.00189579884, -0.000986138126,
+        -0.00228219992, 0.00123596122, 0.000602468499, 0.00215326273, 0.000743236684, -0.00116723159, -0.00232098345, 0.000194092456,
+        -0.000223485054, 0.00259837159, 0.00176038372, 0.001094557, 0.00122214435, -0.000519218273, 0.000673310715, -0.000426910352,
+        0.000697753159, -0.00139290304, -0.0010867361, -0.00157611619, -0.0020621703, 0.000148964071, -0.000207376026, 0.00239748601,
+        0.00270437566, -0.000172753353, -0.000308643095, -0.00256061298, -0.00159847341, 0.000281453191, 0.00119461888, 0.00044328114,
+        9.65349609e-05, -0.00237896619, -0.00155587518, -0.000275982253, 0.000376939948, -0.00108070206, -0.00211057672, -0.00202202075,
+        -0.00295532052, 0, 0.000289301097, 0, -0.000130744695, 0.000422390061, 0.00150614535, 0.000874097983,
+        0.00145666848, -0.00125296449, 0.000367870205, -0.0008073473, 0.000466914324, -0.00167936459, -0.00148282293, -0.00052362337,
+        0.00117167167, 0.000303763838, -0.000833779981, -0.00300462241, -0.00345473457, 0.00185547885, 0.00300953444, 0.00299569732,
+        0.00282257842, -0.00351668103, -0.0021525058, -0.00273878104, -0.00171467243, -0.000794950523, -0.00318364915, -5.79995103e-05,
+        -0.00120585668, 0.00305149145, 0.000544280338, 0.00108005595, 0.000284368114, 0.00233069132, 0.00351624889, 0.000535243424,
+        0.00106542883, -0.00248920335, -0.000459850184, -0.000672008377, 0.00101253914, -0.000903095934, -0.00104849669, -0.00276440731,
+        -0.00274184928, 0.000706808059, 0.00059745257, 0.00118346827, 0.000463845237, -0.000641684514, -0.000590869749, -0.00177157519,
+        -0.00331940316, 0.000522053102, 0.000304082525, 0.0029056943, 0.000960642181, 0.000459807634, 0.00142360805, 0.000270301825,
+        -0.000233020226, -0.00148343644, -0.000401717029, 0.00137203548, 0.00177735987, -0.000663520652, -0.000844465452, -0.00142538454,
+        -0.00120164687, 0.00043851044, -0.000419762975, 0.00145640527, 0.00148538209, 0.00204671267, 0.00334961992, -0.000605899608,
+        0.000554373313, -0.00217337324, 0.000980891171, -0.000644812593, 0.000293844263, -0.00234200014, -0.000225633848, -0.000424459809,
+        0.00124840462, -0.00185560493, -0.000484288321, -0.00289007416, -0.00203711726, -0.00212290953, -0.00192084373, -0.00082239788,
+        -0.00268627377, -0.000111335074, -6.66710548e-07, 0.00196308549, 0.000208007637, -0.00196247874, -0.00175209169, 0.000367837987,
+        -0.000386994507, -0.00110012479, -0.00263604918, 0.000945693231, 0.000201850198, 0.00138803245, 0.000418092823, 0.00137236575,
+        0.00223148451, -0.00124100596, -0.00133353123, -0.00136344251, 0.000401334779, -0.000388151762, -0.00102532504, -0.00126191659,
+        -0.000897595659, -0.000796441338, -0.00194057799, 0.000801952847, 0.00153269921, 0.000367429457, -0.000999569311, -0.0015103654,
+        2.19212743e-05, -0.000401138328, -0.00196690182, -0.000994639238, 0.000198163849, 0.000631593459, -0.0014364199, -0.00143727206,
+        -8.52218363e-05, 0.000490652979, -0.00242030784, -0.00218294188, -0.00168122491, 0.00347035495, 0.00216146465, -0.0011089585,
+        -0.00208641915, -0.000836124178, -2.31747981e-06, 0.000155578717, -0.00130558235, -0.00126195455, -0.00176443835, 0.000359036494,
+        -0.000685634674, -0.00023968902, -0.00288798939, 1.27458479e-05, -0.000405755418, 0.00267336331, 7.858139e-05, -0.0012641981,
+        -0.00303001748, 0.00111421617, -5.09638921e-05, 0.002282548, 0.000101003679, 0.000652203395, -0.000700150849, 0.000608721923,
+        -0.000539684435, 0.00166832516, 0.000454096182, 0.00156103738, 0.00128996721, 0.00144129968, 0.00214740448, -0.000263578753,
+        0.000552817713, -0.00202200678, -0.00182831532, -0.000340402621, 0.00113208592, 0.00104464695, -0.000358908088, -0.00249508722,
+        -0.00174432248, 0.000790018123, -0.000528463512, -0.00070981367, -0.00189583306, 0.00184768857, 0.00139292399, 0.000464357377,
+        -0.00118473265, -5.71828568e-05, 0.000231014725, 0.000664264546, -0.000735249138, 0.0003515766, 5.76403691e-05, 0.000403206941,
+        -0.00139073678, 0.00128124841, 0.00169429579, 0.00224485015, 0.00140207948, -3.00314277e-05, 0.00206205063, -0.000271591707,
+        0.000197801768, -0.00212423643, -0.000146455161, -0.0004521425, -0.000841681787, -0.00139391725, -0.000795596337, 0.000946620014,
+        0.000477110792, -0.00073946442, -0.000975167961, 0.00023608905, 0.000663331535, -0.00028159772, -0.00127894245, -0.000512057857,
+        -8.02183931e-05, 0.00105633226, 0.000457973074, 0.000250807032, 0.00133412494, -0.000278379768, -3.4074299e-05, -0.00207543233,
+        -0.00117853319, -0.000783864933, -0.00160180428, -0.000354071264, -0.000344709726, 0.00173092796, 0.00135406572, -0.00102587941,
+        -0.00121776876, -0.000810772763, 2.75800412e-05, -0.000602361863, -0.0021305047, -0.000929404283, -0.000979678938, 0.0016277727,
+        0.000462571625, -2.42346432e-05, -0.000858168467, -0.000446488033, -0.00100823212, 0.000454997411, -0.000695310533, 0.000826749252,
+        0.000217345165, 0.00151877978, 0.00174610643, 0, -0.00430099759, 0, 0.000805054675, 0.00191795104,
+        -0.00190281635, -0.000304364483, 0.000506113109, 0.00220738491, -0.00050327857, 9.89353866e-05, 0.00162208581, 0.00193471252,
+        0.000749591505, -0.00190670637, -0.000534818624, 0.000449713843, 0.00010998096, -0.000305604161, 0.000946610875, 0.000272899255,
+        -0.000475332869, -0.00272222748, -0.00238523539, 0.00111411698, 0.000401786703, -7.78998219e-05, -0.00195908849, 0.000689265027,
+        0.000509242411, 0.00133424683, -0.000561859517, 0.000885426067, 0.00198559975, 0.000961835729, -0.000999800628, -0.00172079215,
+        -0.000407888903, 0.00312980125, 0.00270333234, -0.000758363516, -0.000838984794, 7.85472803e-05, 0.00195948826, 2.81626417e-05,
+        -0.0006162051, -0.000541408721, 0.00249927957, 0.000452357752, -0.000169713632, -0.003478067, -0.00151278009, 0.000824910006,
+        0.00165424682, -0.000703487836, -0.00105189136, -0.00249464251, -0.00234053354, 0.000519041903, 0.000623524305, 0.00072193722,
+        -0.00111140707, -0.000726256694, 0.00023891317, 0.00160123059, 0.000977259013, -0.00127495197, -0.000914740143, -0.000668852415,
+        -0.000963200873, -1.61279459e-05, 0.000278168067, 0.000705828657, -0.000573870318, -0.00134899595, -0.0011782595, 0.00163488416,
+        0.0012227844, -0.000351375667, -0.0011809587, 0.000151477478, 0.000927918125, 0.000300261978, -0.00101448712, -0.000509155856,
+        0.000242565409, 0.00148689677, 0.0013929595, -0.000409018307, -0.000145766215, -0.00135436119, -0.00120709999, 0.000107906148,
+        0.000354835211, 0.000649504655, -8.56214901e-05, -0.000488522812, -0.000548825425, 0.000527236029, 0.000243846618, 0.000872379809,
+        0.00112167699, 0.000901601161, 0.00205573929, -0.000539350789, 0.00060102815, -0.0017049422, 0.000290400814, -0.000998803647,
+        -0.000262611662, -0.00199079281, -0.00190997438, -0.000465541088, -0.000520163681, 0.000992848421, 0.000632148236, 0.000806578726,
+        0.00178754923, -0.000352992443, 0.000543415255, -0.00209796242, -0.000889523537, -0.000829267898, 0.000490148552, -6.75954798e-05,
+        0.00103673455, -0.00149044429, 4.78129368e-06, -0.00265565328, -0.00190089969, -0.00240736012, -0.00260908459, -0.000792294508,
+        -0.00214040652, 0.00116009428, 0.0011207466, 0.00102055084, -0.000192756503, -0.00241099531, -0.0019372612, -0.000228196033,
+        -0.000996502698, -0.000521201175, -0.00142249954, 0.000682806596, 0.000182321965, -0.000479386246, -0.00185566698, -0.000711462402,
+        -0.00152465829, 0.000443611178, -0.00126384129, 0.00141059957, 0.000856051513, 0.00046685274, -0.00140070543, -0.000991777284,
+        -0.00153639575, 0.00151207228, 0.000254033832, 0.0013735987, 0.000431624823, 1.3084762e-05, -0.00115285022, 0.000336271769,
+        0.000429501641, 0.00230754213, 0.00263035623, -0.000307083537, -0.000631919887, -0.00220074132, -0.000969371526, 0.0015160949,
+        0.0023455678, -0.000699277618, -0.00150221656, -0.00228870241, -0.00128876697, 0.000704751583, -0.00074849301, 0.000313524099,
+        0.000161633827, 0.00159677234, 0.00161766389, -0.000520367117, -0.000817433291, -0.00101308082, 5.6996796e-05, 0.00121014297,
+        0.00182311528, -0.000773488078, -0.000230724632, -0.00195500115, -0.00123769848, -0.000750595005, -0.000297412538, 0.000607289548,
+        0.000797275861, -0.00154474936, -0.00267596636, -0.000980941113, -0.000390960427, 0.00225499691, 0.00165268942, -5.54794678e-05,
+        0.000471780077, -0.00147027592, -0.000474009837, -0.000823539624, 0.000109785222, -0.00141772337, -0.00203838805, -0.00104256824,
+        -0.000416523893, 0.000435695663, -0.0012612401, -0.000722371915, -0.000717959832, 0.00119197252, 0.00048761256, 0.000434621965,
+        0.00122893113, -0.000794621068, -0.00145984651, -0.00167568831, -0.000106070831, 0.00122411549, 0.000618020014, -0.00142920762,
+        -0.000194035223, -0.000606910384, -0.000672624912, -0.00188690692, -0.00105441501, 0.000143909288, -0.000283352798, -0.00145567267,
+        -0.00129833096, 8.30910867e-05, 0.000198794995, -0.00107730064, -0.00104919099, -0.00116034178, -0.00172963017, -0.0016352305,
+        -0.00215184456, 0.00108615635, 0.000499763177, -0.000506664685, -0.0014814873, -0.00110763754, -0.00186718127, -0.000882209511,
+        -0.00157078996, 0.00147460611, 0.00052116462, -0.00195253221, -0.00451170467, 0, 0.00211988902, 0,
+        -0.00188479142, -0.00129012985, -0.000398234028, 0.00164677156, 0.000278877211, 0.0012686241, 0.00240532169, -0.00015633658,
+        -0.00139975455, -0.0013666302, 0.000918062986, 0.00204927288, 0.00133273366, -0.00139307627, 0.000367333007, -0.000616616802,
+        -0.000949026318, -0.00175442954, -0.00129301334, 0.00154864625, 0.00138081936, 0.000283469912, -4.60306474e-05, -0.00074869307,
+        -0.000434019807, 0.00028131518, 0.000851821096, 0.000351820054, 5.86477108e-06, -0.000733211054, 0.00050858967, 0.00049606082,
+        0.000750758685, -0.00125133025, -9.30787064e-05, -0.000750644016, -0.000498108682, -0.00162451644, -0.00137722946, -0.000350332411,
+        -0.00152088911, -0.000970488065, -0.00281161629, 0.00157250557, -0.000311495271, 0.00214939774, 3.6614947e-05, 0.00242020958,
+        0.00212798826, 0.000978406868, 0.000145113969, 0.000414545997, 0.00196209247, 0.000739948882, -7.58390524e-06, -0.000378860947,
+        0.0023562545, 0.00149575516, 0.00143818499, -0.0027855183, -0.000629772665, 0.000533330836, 0.00215598964, -0.00103564642,
+        -7.07535073e-05, -0.00158840849, 0.000166007347, -0.00209183479, -0.00267328694, -0.000906360685, -0.000236279884, 0.00102410652,
+        -0.00113013806, -0.000465764344, -0.000376643788, 0.00209444342, 0.00173081306, -3.70835187e-05, -0.000328992726, -0.000864545931,
+        -0.000173995242, 0.000602959539, 0.000700646429, -0.000130327462, -9.89177497e-05, -0.0001597472, 0.000838810054, -0.00014359763,
+        -0.000472603133, -0.00149815972, -0.00145296147, 0.000720769574, 0.000606178888, 0.000941687729, 0.000131791574, 8.13496008e-05,
+        0.00111313269, 0.000758702517, 0.000996459858, -0.00184551487, -0.00176044973, -0.000156997557, 0.000878559717, 0.000889232964,
+        -0.000251641904, -0.000968250213, -0.000386590022, 0.000933973584, 0.000624271634, 0.00013902341, 0.000122809666, 0.00040294652,
+        0.00100973214, 0.000395903364, 0.000988545129, -0.000418989221, 0.000608717673, -0.00071951776, -0.000200020135, -0.000693383103,
+        0.000123798338, 0.000722282974, 0.00159464567, -0.000473853259, 7.7089062e-06, -0.000973044022, 0.000623365922, -1.25819934e-05,
+        0.00102493574, -0.000645763299, 0.00113324728, -0.00151095912, -0.000128924788, -0.00188510644, -0.000474512781, -0.00167588657,
+        -0.00158881291, -0.00042181852, 0.00118419202, -6.6988956e-05, -0.000885517104, -0.00312595977, -0.00265981397, 5.4988428e-05,
+        -0.000778879272, 0.000846412499, 0.000404192717, 0.000428078638, -0.000251214398, -0.00129535375, -0.00159194949, 0.000230799138,
+        -0.000172896078, 0.00112715003, 0.00107853126, 0.000428888714, 0.000730197295, -0.00109535246, -2.27010896e-05, -0.000949696056,
+        -0.000277496409, -0.00130962743, -0.00105785846, -0.00112522289, -0.0016705275, -0.000446791644, -0.00132620847, 0.000661290134,
+        -0.000447185419, 0.00137936231, 0.00175169494, 0.000381371356, 0.000101752172, -0.0019569553, -0.000495261047, -0.000886580267,
+        -0.0017926984, -0.00173179572, -0.0020197893, 0.00113751646, -0.000475188222, 0.000176054687, -0.0010604494, 0.000984849525,
+        0.000264020171, 0.000530268357, 0.000278999913, -0.000220955524, -0.00144053774, -0.00158003927, -0.00253408286, 0.00213787169,
+        0.00112166617, 0.00139232934, -0.000384214334, 0.000334332348, 0.000675415504, 0.000517222856, -0.000589581789, -0.000367009605,
+        -0.000616304693, 0.000893781194, -8.051435e-05, 0.00112150947, 0.000708610052, 0.00107408641, 0.00132674398, 0.00057030574,
+        0.00151885441, -0.00128793588, -0.00141194102, -0.00156437198, -0.00107340841, 0.00140037399, 0.00063608191, 0.000203286036,
+        -0.00110300223, 0.000980623765, 0.00242354604, 0.00202276022, 0.00134587788, -0.00210738671, 8.68841453e-05, 0.000501395203,
+        0.00141322357, -0.0019017891, -0.00129498285, -0.00046772926, 0.000478489907, -0.000535261177, -0.000729406311, 0.000544171606,
+        0.00231575244, -0.000875999627, -0.00152576203, -0.00178503094, 0.00138242345, 4.87774378e-06, -0.00148840062, -0.00377583737,
+        -0.00263387477, 0.000996627961, -0.000280054577, -0.000502557436, -0.00207058527, 0.000352774805, -0.00041895418, 0.00118073099,
+        5.567068e-06, 0.000453542976, -0.000397637516, -4.59144358e-05, -0.000380547543, 0.00113927491, 0.00135780638, 0,
+        -0.000595108839, 0, 0.000563298934, 0.000544797804, 0.000116933807, 0.000917257508, 0.00197436893, 0.000846625655,
+        0.00164964888, 1.57211907e-05, 0.00243527722, -0.00149876985, -0.000688609609, -0.00129588705, 0.00193619693, 0.000175937632,
+        0.000105155457, -0.00250984682, 6.43688982e-05, 0.000245880219, 0.000887476257, -0.00172565412, -0.000626575842, -0.000628414331,
+        0.00108592329, -0.000639311795, -1.0484946e-05, -0.00272541656, -0.00229260325, -0.0010418715, -0.000619535742, 8.74615216e-05,
+        -0.00145464845, -0.000730856613, -0.0015122816, 0.00086219993, -0.00070757186, 0.00128760212, 0.000293771387, 0.00148650864,
+        0.00152584363, 0.00103536434, 0.00168052595, -0.00187880814, -0.00218099169, -0.000966954918, -1.08951936e-05, 0.000848019961,
+        -0.00215313025, 0.000359570724, 0.00133234658, 0.00434577232, 0.00350699085, -0.000938583398, 0.00065924105, -0.000522500719,
+        0.00156771264, -0.00118083623, 2.40964291e-05, -0.00105684949, 0.000784824195, -0.000969327521, -0.000482427189, -0.00155548926,
+        -0.000485903583, 5.18276065e-05, 0.00103688496, -0.000994483125, -0.00115253474, -0.00227429136, -0.00198424282, -4.53918474e-05,
+        -0.00106169702, 0.000408820953, -0.000910960836, 0.000756350229, -0.000307111535, 0.00127527025, 0.00101525686, 0.000809831021,
+        0.000391187321, -0.000527073164, -0.000136520452, 0.000262505957, 0.000691379304, 0.000144823105, 0.000300455547, -0.00110012188,
+        -0.00157461618, 1.76344765e-05, 0.00070153398, 0.0017868951, 0.00160843635, -0.00096493715, -0.000759468181, -0.00120748533,
+        -0.000499868416, 0.00091382995, 0.0015108618, -0.000579059822, -0.00129470276, -0.00154714228, -0.000778465241, 0.000816842949,
+        -0.000205793986, 0.000413700647, 0.00109792186, 0.000225953379, -0.000755728513, -0.00157321058, -0.000498930982, 0.00100339844,
+        -0.000121616788, -0.00142848259, -0.00238691946, 0.00102966209, 0.000590757874, 0.00178609078, 0.000644721615, 1.96931942e-05,
+        -0.000394496252, -4.20624856e-05, -7.63515127e-05, 0.000864565896, 0.000258833228, 0.000166740181, -0.000153287663, 0.000353796728,
+        -0.000286947383, 0.000639006845, 0.000483043783, 0.00086659065, -0.000407573127, 0.000540596026, 0.00131575926, 0.002174519,
+        0.00165787421, -0.000643410138, 0.000901723804, 0.000654637464, 0.0015832081, -0.00158628053, -0.00101513194, -0.000380178739,
+        0.000349739683, 0.000564182876, 0.00103331893, 0.000695132185, 0.00158216932, -0.00148345099, -0.00108018331, -0.000931465533,
+        -0.000164532205, 0.000510244805, 0.000537894201, 0.000403416867, 0.0003517156, -0.000538787106, 0.000260455883, 0.000750604668,
+        0.00105128798, -0.00117193453, -0.00102217076, 0.000632247305, 0.00211878936, -3.68469628e-05, -0.000914876873, -0.0012206774,
+        0.000467810314, 0.00115954131, 0.00107439596, -0.000190675026, 0.00141125347, -0.000862941612, -0.000636069744, -0.00167748262,
+        -0.000516435946, 0.000670760288, 0.000801522983, 0.000117933436, 0.000819843437, -0.000306386966, 0.000749826315, -0.000760701485,
+        0.000471693143, -0.00105598569, -1.59703195e-05, -0.00113419071, -0.00059538841, -0.000936745317, -0.000373189279, 0.000313201279,
+        0.000919400947, -0.000860171276, -0.00108714099, -0.00106912653, -9.69934044e-05, 0.000509369595, 0.000425444217, -0.000644816202,
+        -0.000211643346, -0.000582715729, 0.000197984307, -0.000322750449, 0.000104798935, -0.00117124687, -0.000305091904, -0.000770056387,
+        -0.000653108291, -0.00197816384, -0.0026537464, 8.73111712e-05, -0.000246113574, 0.000659384765, -0.00116717629, 0.00044143491,
+        0.000384980231, 0.000296555721, -0.00182398153, 0.00072048622, 0.00256026676, 0.00242123753, 0.00159132539, -0.00307707232,
+        -0.00124450319, -0.00117069145, -0.00100120227, -0.000961696322, -0.00117816799, -0.000440427393, -0.00237536756, 9.73616261e-06,
+        -0.000255484832, 0.00215257471, -0.000301775057, -0.000703818863, -0.00118171214, 0.00168975501, 0.000166832819, 0.000493804808,
+        -0.000320665888, 0.00186908292, 0.00164360378, 0.000790872378, 0.0016564097, -0.000236508029, -0.000360083417, -0.00282583339,
+        -0.00287667383, 0.00162083982, 0.00126694865, 0.00137893646, -0.000144769059, 0.000895067526, 0.00179483497, 0.000501282979,
+        0.000366167864, 0, 0.00169768301, 0, 0.000137395225, -0.000356672739, 0.00150498166, 0.000343860243,
+        0.000814420346, -0.00115892908, 7.88489124e-05, -0.000289357413, 0.000917813566, 0.000551646925, 0.002252609, -0.00147889415,
+        -0.00089548924, -0.00212470535, -0.000264686794, 3.15929065e-05, -0.000364067033, -0.000536604261, 0.000373999006, 0.000614552409,
+        0.00110060186, -0.000773647334, 0.000273293786, -0.00126694073, -0.000499500078, -0.00104170013, -0.000521649781, -0.000646978559,
+        -0.00104133622, 1.47378305e-05, 0.000440465257, 0.00045489319, -0.000355630269, -0.000811853097, -0.000464412966, 0.000758217066,
+        0.000683567487, 0.000339367049, 0.000909217692, -0.000210191007, 0.000540867215, -0.00106398133, -0.000211397622, -0.0012516072,
+        -0.00171295239, -0.000593827222, -0.00068975694, 0.00202514417, 0.00207128562, 0.000872032717, 0.00135619752, -0.00138280774,
+        -0.000137890951, -0.00095354009, 0.00042333029, -0.000468240352, 0.000250712124, -0.000801865244, 0.000646308647, -0.00127436058,
+        -0.00122335588, -0.00173336535, -0.000596785394, 0.000237844564, -0.000567835406, -0.0011821799, -0.00111575658, 0.000794207328,
+        0.000697515788, -0.000348352885, -0.00107297697, -0.000251707388, 0.000339179591, 0.00084043009, 0.000968594104, -5.54574945e-05,
+        0.0013778042, -0.00133669726, -0.000584025984, -0.00223405007, -0.00103910686, -0.00115962187, -0.00218009856, -0.000748044695,
+        -0.000627386267, 0.00166825473, 0.000381837424, -0.00100874482, -0.00152060401, 0.000859316555, 0.00160140358, 0.00030741957,
+        -0.000522400136, -0.00121009513, 0.000308793853, -3.27680755e-05, -0.000452004897, -0.00147468853, -0.00103891524, -0.000181234442,
+        -0.000598681043, -0.000131460314, -0.00056801911, 4.90893581e-05, -0.000158531504, 0.000632048235, 0.00138837285, -0.000749132945,
+        -0.00139698957, -0.00204989943, -0.0010447494, 0.00087731774, 0.000572342891, -0.000990002649, -0.00187081564, -0.00144982198,
+        -0.0017954635, 0.0012167868, 0.000658478064, -7.84790609e-06, -0.00225561531, -0.000908028393, -0.00109202997, 0.00211685919,
+        -0.000114549126, 0.000915501383, 0.00102523749, 0.001571659, 0.00103708217, -0.00118728518, -0.000523270166, -0.000203553995,
+        -0.0007147945, -0.000359383237, 8.97091813e-05, 0.00191147963, 0.00201872201, -0.00156237744, -0.00212626695, -0.000445627258,
+        0.0015566576, 0.00146823865, 0.00127843185, -0.00216717692, -0.000944982341, -0.00197147066, -0.0017732908, -0.000530194491,
+        -0.000543937145, -4.2953674e-05, -0.00156202563, -0.000443291385, -0.000591001764, 0.0011165936, -0.000319814717, -0.000331984833,
+        -0.000622823194, 0.000946592656, 0.000665301923, -0.000310999749, -0.000813203747, -0.000540331821, -0.000988122891, -6.21017243e-05,
+        -0.000677002245, 0.00152958406, 0.00151175226, -0.000418606214, -0.00175983529, -0.000616590027, 0.000579733518, 0.00115997077,
+        -0.00076250924, -0.000708329317, 0.00066182611, 0.00155892945, 0.000591900549, -0.0019267454, -0.00153885805, 0.000506485696,
+        0.00054339692, 0.000413927308, 0.000323764252, 7.94316729e-05, 0.000717594579, -0.000815250096, -0.000283426314, -0.00121950521,
+        -0.00130403659, -0.000678016979, -0.000151206434, 0.00064745592, -0.000328924682, -0.00127341144, -0.00109918369, 0.000819360022,
+        0.000692400034, -0.00050614198, -0.00053486845, -0.000370091293, -4.12263325e-05, -0.00171795744, -0.00313998875, -0.000184207456,
+        4.57918504e-05, 0.00178294617, -0.000210714119, -0.000554316794, -0.000304218498, 0.00044577822, -0.000222740025, -0.00104196405,
+        -0.00204209238, 0.000111507165, -0.000282763853, 0.00131490896, -0.00024752444, -1.57824397e-05, -0.000263846683, 0.000645628257,
+        -0.000369792862, -0.000226413977, -0.000353585754, 0.00122580281, 0.000986106461, -0.00057323731, -0.00109895226, -0.000228744844,
+        0.000395895971, 0.000286713708, -9.47436201e-05, -0.000814767554, -0.000668636581, -0.00147689017, -0.00314574642, -0.000519903551,
+        -0.00194148149, 0.00226870831, -0.000391340698, 0.00183464924, -9.09845403e-05, 0.00187271344, 0.00136963173, 0.00188428315,
+        0.00187413266, -0.000694505288, -0.000978624681, -0.00086027151, -0.000681944424, 0.00136492448, 0.000929876929, 0.00141182484,
+        0.00141138816, -4.36548144e-05, 0.000385714986, 0, -0.000380975776, 0, -0.000334108539, 0.000316670019,
+        0.000368934503, -9.98397591e-05, -0.000414660259, -0.000619080907, -0.000393927097, -0.000262662797, -0.000901768974, -0.000696066418,
+        -0.00156311318, 0.000230579724, -0.000874848687, 0.00075184158, -0.00121687271, 0.000722071098, -0.00032293814, 0.00200039172,
+        0.000531613827, 0.000498704962, -0.000293797028, 0.00133293157, 0.0013688223, 0.000419016054, -0.000500873779, -9.71684349e-05,
+        0.000302966975, 0.000831724377, -0.000230150166, 0.000460193609, 0.0004611513, 0.00107289455, 5.36018051e-05, 0.00108550116,
+        0.00231407629, 0.00194634567, 0.00267259777, -0.00152675086, 0.000219112117, -0.00143007783, 0.000335879333, -0.000773054082,
+        7.63752614e-05, -0.00107493554, -0.000737520226, -0.000822159229, -0.000709710061, 0.000230989768, -5.19453897e-05, 0.000346283632,
+        0.000187970989, 0.000632386655, 0.0018460654, 5.93284203e-05, 0.000495714252, -0.0028233896, -0.00229215459, -0.000663586834,
+        -0.000278416061, 0.000477148424, -0.000749293133, -0.000456883339, -0.00120315235, 0.000243227871, -0.000780329923, 0.00153269176,
+        0.00100186048, 0.000557094696, -0.000552352692, 0.000113768619, 0.000722469413, 0.000756331661, -0.000174059503, -0.000388887245,
+        -0.000137744122, 0.000553669932, -0.000273300218, 0.000732193002, 0.00113392482, 0.00064759684, -0.000676003809, -0.000192632142,
+        0.00108787161, 0.00214762962, 0.00141195976, -0.000946612738, 0.000199952003, 0.00124955876, 0.00318598561, -0.00050662749,
+        0.000117613003, -0.00274092564, -0.00084849156, -0.000175964349, 0.000288272393, -0.00063901511, -0.000842500245, 0.000312558259,
+        0.00174412457, -2.0562351e-05, -0.00112388027, -0.00177304191, -0.000167365157, 0.00136012025, 0.000275527767, -0.000388433546,
+        0.00122740248, 0.0010500825, 0.00110806338, -0.00238336856, -0.000979677308, -0.000111246773, 0.000270760793, -0.00103603874,
+        -0.000958581688, 0.000393791415, 0.000576504972, -0.000432100263, -0.000791834143, 0.000450371823, 0.00102696905, 0.000231160491,
+        0.000299547159, 0.000185672121, 0.00160586182, -0.000673122704, -0.000106230131, -0.00106487877, 0.000473139808, -0.000634893775,
+        -7.58881797e-05, -0.000287998584, 0.0015229932, -0.000778027927, 6.71126181e-05, -0.0019467473, 0.000108806678, -0.00168308069,
+        -0.00131842308, -0.0019341982, -0.00118008442, -0.000946268498, -0.00217881985, -0.00075460074, -0.00127067487, 0.00128511433,
+        0.000262896705, 0.000360623788, -0.000262045127, -0.000377499673, -0.000479095033, 0.00019746722, 0.000225437543, -7.0265145e-05,
+        -2.09022546e-05, -0.000240911671, 0.000377444521, -0.00101454742, -0.00131805707, -0.000988957705, -0.000437218754, 1.29477921e-05,
+        -0.00122936035, -0.000780730275, -0.00107494718, 0.000913081516, -4.51256201e-05, 0.000313701021, -5.17738517e-05, 0.000270352466,
+        0.000110536988, -0.000595860824, -0.00124204275, -0.000369097368, -0.000672896393, 0.00104251108, 0.000420065568, 0.000610350282,
+        0.000885214424, -9.53490817e-05, -0.00021865638, -0.00187192787, -0.00246365694, 0.000607585476, 0.000862955465, 0.00174486265,
+        0.000506572658, -0.000384084502, 0.00074277533, 0.00013074954, 0.000272002799, -0.00127397815, -0.000391930225, -0.000276151753,
+        0.000294808735, -0.000795388245, -0.000755795685, -0.00143228564, -0.00181068515, -5.9899292e-05, -1.70209678e-05, 0.000661538681,
+        -0.000706402352, -0.000994661357, -0.00159612193, 0.000793044106, 0.000211288338, 0.00134752458, 0.00105421653, -0.000480153656,
+        -0.00142419012, -0.000798769819, 9.42505867e-05, 0.00154316053, 0.000503664603, -0.00107139163, -0.000696314382, 0.000374764088,
+        8.23341543e-05, -0.000687735446, -0.00105005549, 0.000849504024, 0.00123621337, 7.90716149e-06, -0.00038775563, -0.000646787288,
+        0.000208106459, -0.000880394364, -0.00195641932, -0.000282901339, 0.000487085723, 0.00106896949, -0.000792391016, -0.000882828142,
+        -2.41357775e-05, 0.00171189324, 0.00157093117, -0.00107341446, -0.000745297002, -0.00132412021, -0.00108677766, -0.00073465606,
+        -0.00142628839, 0.000611360068, 0.000451494096, 0.000671937712, -0.000112574693, -0.0010660179, -0.00169872981, 4.82783944e-05,
+        0.00013638087, 0.00146669557, 0.000679699238, -0.00106979173, -0.00170565385, 0, -1.46326493e-05, 0,
+        -0.000877785496, 0.000340210187, 0.00054124766, 0.000649410533, -1.37845636e-05, 0.000304792891, 0.00139755942, -0.000122043391,
+        -0.000876293925, -0.00108831644, 0.000712627429, 0.00125234446, 0.00122943544, -0.00234937039, -0.00267834892, -0.0015014644,
+        -0.00193084427, 0.0021821172, 0.00154230511, 0.0017141127, 0.000867956493, -0.000574557693, 0.000662933977, -0.000248440891,
+        -0.000161203672, -0.00112304057, -0.000334532117, 8.60565633e-05, -0.000249515288, -0.000482289179, -0.000309492403, 0.000544392504,
+        0.000636447512, 0.000212882747, 0.00149022078, -0.000614746648, -0.000309226685, -0.00291908556, -0.00225076685, -0.000435266178,
+        -0.00112163951, -1.38794421e-05, -0.00104420958, 0.00113203609, 0.00067474047, -1.18261669e-05, -0.000949495763, -0.000293491408,
+        0.000162538025, 0.000380885205, -0.000202066745, -0.000958087738, -0.00137549883, -0.000465474324, -0.00100057281, 0.000701217854,
+        -7.53858767e-05, 8.97824066e-06, -0.00117891177, -0.000599301304, -0.00209473958, 0.000759420625, -0.000403558981, 0.00209957408,
+        0.000213990395, 0.000429193024, -0.000265736482, 0.00117350358, 0.000416775962, 5.42448834e-06, -0.000912738265, 0.00110046891,
+        0.00139816781, 0.000869119482, 7.89682817e-05, -0.000650684, -1.10942055e-05, -0.000194946595, -0.00109989871, -0.000489865139,
+        -0.00106724026, 0.00100907125, -0.000199347545, 0.000846297713, -0.000483297103, 0.000638130005, -0.000197129586, 0.00108589022,
+        -0.000514399493, 0.000469169318, -0.000762179203, 0.00244085561, 0.00173418783, 0.0018881599, 0.00147147162, 0.00101949158,
+        0.00231388072, -0.000421749952, -0.000150405918, -0.000904140586, 0.000700050441, 0.000397083088, 0.000252384052, -0.000457583403,
+        0.000496257446, 0.000150031643, 0.000222741655, -0.000561913359, -0.000368550478, 1.59792107e-05, 0.000445488462, 0.0009436002,
+        0.00137196039, -0.00118575385, -0.00169812748, -0.000467523059, 0.000757464324, 0.00100692711, -0.000402106263, -0.000559947279,
+        0.000616800971, 0.00058784819, -0.000936575234, -0.000934188778, -0.000265510636, 0.00206176541, 0.00112843467, 0.000275115337,
+        0.00149282976, 0.000626827648, 0.00124630996, -0.0024004397, -0.00185806095, -0.00101998379, -0.00132601196, 0.000745928439,
+        0.000447807077, 0.00183654181, 0.00115214742, -0.000911985291, -0.00108114001, 0.000481254188, 0.00124372495, 0.000530229532,
+        -0.000116689189, -0.000346945628, 0.00110237347, 0.000143127021, -0.00038297128, -0.0017461736, -0.00119946757, 0.000711188652,
+        0.000311174925, -0.000110145527, -0.0011981409, 0.000387542881, 0.000472357671, 0.00101325719, -0.000297855237, 0.000148362422,
+        0.000528446108, 0.00117730326, 0.000666192325, -0.000140219112, 0.000222961651, 0.000237108296, 0.000331432821, 0.000272002653,
+        0.00107466173, -0.000161289092, -0.000686215644, -0.00117850408, -0.000846792071, 0.00119882636, 0.00056863192, 0.00104088825,
+        0.00151091721, 0.000387616339, 8.53029051e-05, -0.00108707754, 0.000129963737, 0.000909938011, 0.000646725181, -0.000607286231,
+        0.000175839727, 0.000796648907, 0.00127739983, -0.000795595872, -0.000170629442, -0.000126760089, 0.000853536651, -0.000763543881,
+        -0.000777187, -0.000480026443, 0.000157362781, 0.000394867267, 0.000776890665, 5.00289025e-06, 0.000276937877, -0.00157032371,
+        -0.0015676074, 7.61475385e-05, 0.000346959045, 0.000923775195, 0.000916615594, 7.82133138e-05, 0.000346752757, -0.00160880457,
+        -0.0015147794, 0.000307984097, 0.00100568205, -1.79506023e-05, -0.00161039212, -0.000604060828, 0.000455007306, 0.00178382569,
+        0.000954109244, -0.000985572115, -0.000797300774, -0.000557477877, -0.000932594587, 0.000377642835, -0.000277292886, 0.00109994062,
+        0.000360571663, 0.00124000176, 0.00175763434, 0.000765397388, 0.00126254302, -0.00106582907, 0.000281308137, -0.000753060332,
+        0.000228204881, -0.000927780929, -0.000320018153, -0.000836245366, -0.000717971358, -0.000915965706, -0.00184752862, 0.000286372495,
+        0.000151235785, 0.00191048847, 0.00116947899, -0.000315916259, -0.000190848543, -0.000422824756, -0.000545544317, -0.000546277734,
+        -0.00143083418, 0.00132818322, 0.00163367088, 0.00171695673, 0.00113569177, -0.00107777514, -0.000646189321, 0,
+        0.000898012309, 0, 0.000352902018, -0.000240016554, 0.000665057625, -0.000989415916, -0.00112685107, -0.000478144008,
+        0.000131057983, 0.000272912032, -0.000568302057, 0.000206756595, 0.00110172119, 0.000465186604, 0.000172080589, -0.00116591423,
+        -0.000493284897, -0.00062966207, -0.000986107858, 0.000392214599, 0.000972652109, -4.16336115e-05, -0.00170903967, -0.000945233216,
+        0.000101083424, 0.00218277238, 0.0014008421, -0.000964480394, -0.000729368126, -0.00091561646, -0.00115579041, -3.79369012e-05,
+        -0.000444403093, 0.00102150149, 0.000296331302, 0.000428515603, 0.000293709803, -0.000245070958, -0.0012345385, -8.11323698e-05,
+        0.000124034588, 0.00178480963, 0.000948907225, -2.50565354e-05, 0.000410666631, 9.81230405e-05, 6.556054e-05, -0.000887508795,
+        -0.00123950304, 0.000323943852, -0.000286686583, 0.00135895819, 0.00092479412, 0.00146293116, 0.00165738421, -1.69517298e-05,
+        0.000429576059, -0.000754246663, -0.00018885982, 0.000109706132, 0.00056079647, 0.000583382091, 0.000888626906, 0.000190839142,
+        0.00110700878, -0.00027542602, 0.000510276528, -0.000384395826, 0.00125971891, -0.000447633764, 0.000151289787, -0.00125517254,
+        0.000568436109, -0.000333024451, -0.00011395452, -0.00126757356, 0.000593356439, 0.000253747829, 0.000728483661, -0.00243845466,
+        -0.00166313909, -0.000643810839, 0.000203680451, -0.000348413072, -0.000668771216, -0.00076530932, -0.000201694551, -0.000597823469,
+        -0.00104708027, -0.000907880894, -0.00139876548, 0.000100023302, -0.000546008872, 0.000977779739, 0.000282477617, 0.00010510291,
+        -0.00036354817, 3.24878201e-05, -0.000263102178, 0.000187235826, -8.73349491e-05, 0.000973100774, 0.00138215139, 0.000243191695,
+        0.000710959313, -0.000690214278, 0.000842527079, -0.00113045296, -0.000519972004, -0.00173174846, -0.000975462957, -0.000820420624,
+        -0.00136406231, -0.000612860895, -0.00157430489, 0.000682885468, 6.25609537e-05, 0.001681061, 0.00161724165, -0.000386254396,
+        -0.000950190879, -0.00141892978, -0.00063173048, 0.000854201848, 0.000185967539, -0.000308285758, -0.000403784186, 0.000612948788,
+        0.0013024162, -0.000179121969, -0.000194544336, -0.00145408756, -0.000764609082, -0.000677285134, -0.00132073497, -7.55419023e-06,
+        0.000279673259, 0.00100088189, 0.000324274763, -0.00134675205, -0.00173904956, 3.4658995e-05, 0.000243653369, 0.00103468378,
+        0.00028472289, -0.000445231068, -0.000259526365, -4.41994634e-05, 0.000312725548, -0.000280557433, -0.000521164329, -0.000891185366,
+        -0.000724112382, 0.000439563184, 0.000788351404, -0.000334304175, -0.000913568656, -0.00144795666, -0.00118311541, 0.000315000594,
+        -0.000214153115, -0.000158406183, -0.000876118895, -0.000410220528, -0.00116393738, 1.9557192e-05, -0.000861494336, 0.00051073858,
+        -0.00113766245, 0.000123779406, -0.0012530596, 0.0020337454, 0.00145965081, 0.00127769308, 0.000179828698, -0.000190574952,
+        0.000847999821, 0.000150337524, -0.000663624262, -0.0012144905, -0.000708158652, 0.0011180921, 0.00050619815, -0.000369462796,
+        -0.00098018162, 0.00015891486, 0.00015591002, 0.000365198677, -0.000839010987, -0.000103131926, -0.000463122677, 0.00128401327,
+        0.000585267087, 0.000606260379, 6.12497388e-05, 0.000359213795, 0.000642003433, 0.000606531918, 0.000859747292, -0.000329467526,
+        -9.1343376e-05, -0.000991265872, -0.00118509738, 0.000241385613, 0.000381294143, 0.000888236682, -5.273227e-05, -3.05703143e-05,
+        0.000530248974, 0.00061964622, 5.33289131e-06, -0.000493147527, 0.000210248982, 0.00096013851, 0.000864333997, -0.000558480446,
+        4.93780244e-05, 0.000259411347, 0.00106754468, -0.000697406475, -0.000367750326, -0.000864406407, -0.00029608779, -0.00028665486,
+        -1.91074068e-05, -1.90939172e-05, -0.00044526835, -0.000716148526, -0.000384679646, 0.00135718612, 0.00203847513, -0.000895448553,
+        -0.00132773211, -0.00147088221, 7.2977331e-05, 0.000429186213, -9.4987452e-05, -0.00116390432, -0.00105902355, -0.000771760766,
+        -0.00163371384, 0.000585413945, 0.000778286601, 0.00103537831, -0.000175224646, -0.00136775954, -0.00137285946, 0.000318619423,
+        -0.000549935852, 0.000730381289, 0.000328676164, 0.00106233789, 0.000666335749, -0.000502675888, -0.000546435243, 3.72783688e-06,
+        0.000288152107, 0, -0.0017278028, 0, 0.000261095411, 0.000638178375, -0.0010693717, 7.26646831e-05,
+        0.000733907451, 0.00105472212, -0.000437026611, -0.00112297782, -0.00121027511, 0.00125576614, 0.0005936753, 0.00128774438,
+        0.0012006039, 0.000286379538, 0.000300561631, -0.000543514383, 0.000500117196, 0.000231882499, 0.000739647425, -0.0011342396,
+        -0.000864119502, -0.00121377409, -0.00151097483, 7.42711563e-05, -0.000444783072, 0.00118875538, 0.000472263055, 0.000384013721,
+        0.000159932009, -0.000192498497, -0.000401558937, -0.000216952176, -0.000303434383, 0.000315035868, -4.0035753e-05, -0.000120210811,
+        -0.000796913519, -0.00032117081, -0.00126650441, 0.000776529429, -7.70693878e-05, 0.00112359505, -0.000605834881, 0.000617279438,
+        0.000139340118, 0.00188499852, 0.00104044587, 0.000436361646, 0.000184940902, 0.000552708516, 0.000621831277, 5.1310737e-05,
+        -0.000884813082, 0.000463791541, 0.000612308679, 0.00204156525, 0.00146186771, 0.000403916813, 0.000846372684, 0.000582546461,
+        0.00170478108, -0.000180471921, 0.000243119139, -0.000953256851, -3.14946228e-05, 0.000117396034, 8.00356065e-05, 0.000360931386,
+        0.00105348916, 0.000830341538, 0.00126657647, -0.000857670093, -0.000282934168, -0.000412060646, 0.00043483742, 0.000410277658,
+        0.000945231062, 5.83492365e-05, 0.00105918047, -0.000867163879, -0.000130066881, -0.000925070024, 0.000226261909, -0.000450624444,
+        -0.000386645814, -0.00078080449, 2.6441412e-06, -0.000201856688, -0.000873676443, -0.00115221739, -0.00146180857, 0.000948784931,
+        8.76719714e-05, 0.000907705165, 0.000366773602, 0.000894868397, 0.000790258753, -0.000377387449, -0.000534181541, 0.000195510191,
+        0.000642213854, 0.000202148745, -0.000390429399, -0.00016389144, 0.000112531008, 0.000332251017, -0.000541253248, 0.000234113948,
+        4.22631856e-05, 0.00115496165, 0.000666984241, 0.00121760427, 0.00212145108, 0.000304835674, 0.000683220918, -0.00142334157,
+        -2.74924678e-05, -0.000444853096, -0.000241483765, -0.000500544556, -0.000139381824, 0.000233275117, 0.000319775892, -0.000173425389,
+        -0.00019594864, -0.000776962028, -0.00151060964, 0.000167573773, -3.80446509e-05, 0.0014912386, 0.000257654407, 0.000345528388,
+        6.21735235e-05, 0.000891093747, 0.000725887483, 0.00084126211, 0.00110709039, -0.000137020805, -0.000510837825, -3.76427779e-05,
+        0.00110882393, 0.00107374415, 0.000217367226, -0.000842975685, 0.000421752076, 0.00127039268, 0.00107752136, -0.0012253935,
+        -0.00111135468, 0.000765061122, 0.00176193623, 0.000588235212, -1.45238009e-05, -0.000889427669, 0.000169993466, 0.000430445914,
+        0.000140839722, -0.0001962643, -6.13220618e-06, 0.000646061497, 0.000717754418, 8.35461542e-05, -0.000555663253, 0.000303036184,
+        0.00106592441, 0.00196156418, 0.00230825786, -0.000693957729, -0.00040455503, -0.000800853362, 0.00074199494, 0.00131124747,
+        0.00215524365, -0.000685011619, 0.000144642021, -0.00135500892, 2.41068774e-05, -0.000436634757, -0.000548572687, 9.49590467e-05,
+        0.00115129666, 0.00104539073, 0.0011082968, -0.000808051613, 0.000936313067, -0.000245977135, 0.000208516314, -0.00151675974,
+        3.50251939e-05, 0.000747638464, 0.00174773764, -0.00153543509, -0.0011204948, -0.00118028186, 8.33454833e-05, -0.000175705194,
+        -0.000557030085, -0.000180151692, 0.000736203918, 0.000168142258, 0.000143539917, -0.00111198728, -0.000658929872, -0.000438177085,
+        -0.000230853475, 0.000298346451, 0.00016234949, -0.000407469255, -0.000692267786, 0.000319663552, 0.000830901728, 0.000455710804,
+        0.000131718116, -0.000545641989, 0.000228639226, 0.000221562164, 0.000859229651, -0.000468758604, -0.000206142984, -0.00153868366,
+        -0.00170427177, 0.000304075249, 0.000718982657, 0.00141779706, 0.00127702951, -0.000541095331, 0.000310243922, -0.00132925715,
+        -0.000853570236, -0.000843436283, -0.000505047909, -0.000427264691, -0.00154629524, -0.000221711118, -0.000761760632, 0.00135833886,
+        0.000156210881, 0.00100520288, 0.000948361878, 0.00055194, 2.36023916e-05, -0.000680104829, -0.000685606792, 0.000734789879,
+        0.00050325389, 0.00133793149, 0.00209941668, 0.000312185264, 0.000361876067, -0.0019464381, -0.000635003729, 0.000459442206,
+        0.000796732726, -0.000944252592, -0.0016343462, 0, -0.000563311914, 0, -0.000749730738, 0.000799225585,
+        0.000988159678, 0.00091270695, 0.00047143249, -0.000483970041, 0.00035301561, 3.71229835e-05, 0.000148828723, -0.000754173612,
+        -0.000770933751, 2.27019773e-05, 6.42654195e-05, 0.00100471266, 0.00139080547, 0.00012203143, 0.000287673465, -0.00118702347,
+        -0.000226000368, -0.00027417572, -8.6880289e-05, -0.000584060675, -0.000331170333, -0.000314851088, -0.000810943893, -0.000727299484,
+        -0.00141779019, 0.000888865441, 0.000289526826, 0.000991481356, -6.36569166e-05, 0.000250356446, -0.000223944488, 0.000691528898,
+        0.000540715642, 0.00133766967, 0.00163222326, -0.000169808554, -4.49327927e-05, -0.000612244708, 0.000522243266, -3.96418909e-06,
+        -0.000112500275, -0.000675690535, -0.000302652275, -2.39058281e-05, -0.000374333642, 0.00028441922, 0.000374835625, 0.00024016478,
+        -0.000545651477, 0.000115429473, 0.000795261585, 0.00097498158, 0.000426798884, -0.000654685311, 0.000269798678, 6.18929043e-05,
+        -0.000576093618, -0.000935730175, -0.00092270493, 0.00144194672, 0.00101549714, 0.000835068058, 0.000970806112, 0.000234825289,
+        0.000612831209, -0.000781510782, -7.22140539e-05, -6.29968708e-05, 2.01796647e-05, -0.000333120523, 0.000163782272, 0.000386951549,
+        -0.000105537823, -0.000833131606, -0.000633011863, 0.00135129062, 0.00143770757, -0.000219763315, -0.00067041209, -6.87382999e-05,
+        0.000591407181, 0.000500830065, 0.000472787302, 0.000427376101, 0.00110598793, -0.000789331854, -0.000601997541, 0.000119972654,
+        0.00163429731, -0.000493179657, -0.00151050207, -0.0013922659, -0.000236987136, 0.00142697163, 0.000708834617, 0.000113472197,
+        0.000714461785, -0.000507349148, -0.000873583485, -0.000462920289, 0.000439823722, 0.000898501778, 0.00033784681, -0.000550561701,
+        8.44634196e-05, 0.000103285522, 7.26345097e-05, -0.000241804315, 2.41800444e-06, 3.8864091e-06, -6.50404254e-05, 0.00043471856,
+        0.00116582238, -0.000114753129, -0.000634068041, -0.000609054347, 0.00112450146, 0.00104420085, 0.00120935403, -0.00188910251,
+        -0.000585106493, -0.0013803615, -0.00129653839, -0.00128002721, -0.00179985329, 0.00041286886, -0.000787009718, 0.000949495879,
+        -4.50105872e-05, 0.0010616181, 0.000308853283, 0.000402476464, 0.000132131623, 0.00025737437, 0.000190709747, 0.000404757913,
+        0.000649031484, -0.000399500073, -0.00111264898, -0.000207318808, 0.000535273342, 0.00117053953, 0.000239648609, -0.000748997671,
+        -0.00032697001, 0.000237807079, -0.000480500807, 3.74781375e-05, 0.000270881108, 0.000976503536, 0.000179290364, -0.000391926151,
+        0.000213101099, 0.000613251119, 2.35256739e-05, -0.0010664626, -0.00121079758, 0.000943671446, 0.000803748844, 0.000594092766,
+        0.000184859266, -0.00025162939, -0.000626200112, -0.0006179763, -0.0012346009, 0.00127132563, 0.000900783169, 0.000925472181,
+        -0.000231698985, -0.000193554341, -0.000440918229, 0.000856936444, 0.000116495648, 0.0009434612, 0.000483686395, 0.000942530576,
+        0.000658375095, -1.99274509e-05, -0.000878498191, 0.00100160344, 0.00239927229, 0.00162691961, 0.000274270977, -0.0023242631,
+        -0.00116211281, 0.00155355386, 0.000694552204, -6.60609512e-05, -0.000783968309, 0.00194794324, 0.00234519434, 0.000774647691,
+        7.87320023e-05, 8.46924377e-05, 0.00150973559, 0.000626629801, 0.000494519889, -0.000118515571, 0.00111584074, 0.000228114426,
+        0.000317849597, 0.000181939686, 0.00189018389, 0.000636493089, 0.00154653401, -0.00135302648, 0.000256893545, -0.00143014803,
+        -0.000709508022, -0.000409598899, 0.000605532259, 0.000289878109, 0.000290274271, -0.000862564892, -0.000244271418, -0.000377181277,
+        -0.000471378473, 6.10983116e-05, 0.000550502096, 0.000407251558, -0.000247646909, -0.000933932839, -0.00097535504, 0.00129138306,
+        0.00166993251, 0.00087449979, 0.000592947123, -0.000952707138, -0.000157888033, -0.000402233447, -0.000868619129, 0.000224840303,
+        0.000536799955, 0.00147768669, 0.0009109081, -3.47467721e-05, 0.000942937797, 0.000517285429, 0.000714859518, -0.00118653465,
+        -0.000542087597, 0.000887479691, 0.00208976562, 6.96205534e-05, 0.000392389222, -0.00126574922, 0.000252281403, -0.000947209366,
+        -0.000993538415, -0.000628052396, -0.000193853892, 0.000592804514, 0.000349754526, 0, -0.00090484129, 0,
+        0.000841213914, 0.00077231013, 0.000543836039, -0.000191291154, 0.00121222122, -0.0004514225, -0.000484042655, -0.0015029083,
+        -0.000335461897, 0.000598453102, 0.0009221246, -0.000822101138, -0.000816643762, -0.00137467613, -0.0014038732, 2.82312976e-05,
+        -0.000669044151, 0.000673261471, -0.000174757937, 0.00109978102, 0.00145903288, 0.000171516032, -0.00055421493, -0.00153862115,
+        -0.00098363182, 0.000824776071, 0.000119262317, 5.24929492e-05, -0.000471905281, 0.000639473496, 0.000521767419, 0.000185385288,
+        -0.00045346556, 4.79945447e-06, -6.10230491e-05, 0.000676281867, 0.000279462489, 0.000592674129, 0.000591100135, 0.000215835375,
+        0.000237436121, 0.000161611446, 0.000770674495, 0.000179236988, 0.000493698113, -0.000587922055, 2.71981262e-05, -0.000313036144,
+        0.000189268903, -0.000500598049, -0.00079770328, -0.000476797024, -0.00020108957, 0.00106843689, 0.00116756023, -0.000416301977,
+        -0.00077363092, -0.000915554643, -0.000454771041, 0.00060053484, 0.000391955371, 6.27604604e-05, -0.000161297387, -0.000776967616,
+        -0.00149173767, 0.000313165307, 0.000555084203, 0.00158665283, 0.000827999786, -0.000905044319, -0.00101533637, -0.000120601922,
+        -8.35092942e-05, 0.000479282055, -0.000395193871, 7.69537e-05, -0.000540985842, 0.000669012428, 0.00010296001, 0.00104794069,
+        0.000487470475, 0.000295119913, -0.000184810226, 0.000460570707, 0.000307220966, 0.000662767212, 8.18814588e-05, 0.000804463751,
+        0.001202279, 0.000831374025, 0.000620694133, -0.000328526483, 0.00049822405, 0.000372002047, 0.000483251148, -0.000404071761,
+        -0.000235852276, 0.000368292182, 0.000459612784, 0.000685536943, 0.000868436007, 0.00064689311, 0.0010908437, -2.97974839e-05,
+        0.000796398614, 0.000194710505, 0.00150584476, -0.000394059112, 0.000493522093, -0.00102649548, 0.000273565383, -0.000357048877,
+        0.000527310942, -0.000288912066, 0.000919588201, -0.000579790154, 0.000440103118, -0.00149347587, -0.000702646677, -0.00109956786,
+        -0.000609198702, -0.000419880962, -0.000982828205, -0.000170102241, -0.000311806652, 0.00104628922, 0.000711003609, 6.40440703e-06,
+        -0.000255419029, 3.94746894e-05, 0.000616427511, 0.000473453867, 0.000605473469, -0.000300121959, 0.000552032434, -0.000266545918,
+        0.000477708818, -0.000924081483, -0.000652206654, -0.000853311212, -0.000469071965, 0.000370964786, 0.00017265066, -3.05531285e-05,
+        6.30934956e-05, 0.000363156549, 0.000927710847, -0.000498813228, -0.000559129636, -0.000707086641, 7.21334945e-05, 0.000111111927,
+        -0.000367388537, -0.000243222137, 0.000401026278, 0.00051728508, 0.000439965894, -0.000675916963, 0.00011087161, -0.000475234585,
+        -0.000820614689, -0.00110431854, -0.00127849297, 0.00117068051, 0.000796569046, 0.000756129739, 0.000154430876, 0.000528361532,
+        0.00173727318, 0.0003836049, 0.000843744143, -0.0013994372, 0.000337017525, -0.000888582726, -0.00042567437, -0.00161598413,
+        -0.00120250438, -5.80463384e-05, -0.000256385392, 8.02857539e-05, -0.000101998958, 0.000433909037, 0.000621773768, -0.000571966637,
+        -0.000663207902, -0.000302072847, 0.000515433552, -0.000207869918, -0.000777593232, -0.000822214526, -3.47952518e-05, 0.000197182206,
+        -0.000660008285, -0.000897987164, -0.000757582253, 0.000639148639, 3.58966645e-06, -0.000202574302, -0.000783753232, 0.000285228656,
+        0.000233548169, 0.000610055984, 0.000292054727, -0.00053950859, -0.00103593525, -0.000168240062, -2.59303051e-05, 0.000786895864,
+        -0.000185137149, -5.68178948e-05, 0.000273988378, 0.000621039886, -3.06751172e-05, -0.000736059854, -0.000599138322, 0.000583825749,
+        -0.000134537535, -1.15580624e-05, -7.32698827e-05, 0.00145221967, 0.0018603619, -0.000674332143, -0.0010749792, -0.00120268564,
+        -0.000611616299, 0.000251270452, -0.000921483268, 0.000595789403, 0.000532986422, 0.000985779683, -3.13380151e-05, -0.000107772299,
+        4.15071845e-05, 0.000815561041, 0.000781762996, 0.00047696149, 0.00100287376, -0.000718378986, -0.00124705792, -0.000809720135,
+        -0.000147228682, 0.00173494965, 0.00135721359, -0.000272596313, -0.000239038374, -0.000483532756, -0.000161350355, -3.10697942e-05,
+        -0.000400256307, 0.000587275776, 0.000969326939, 0.000708047242, 0.000601989741, -0.000844994211, -0.000668378023, 0,
+};
+
+constexpr IrSpectrum kSmallRoomIr = { 128, 16, kSmallRoomIrBins };
+
+} /* namespace audio */
+
+#endif /* SMALLROOMIR_HPP_ */
@@ -0,0 +1,257 @@
+/**
+ * @file smoothing.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Per sample ramp of the parameters, to change them without the zipper noise.
+ */
+
+#ifndef SMOOTHING_HPP_
+#define SMOOTHING_HPP_
+
+#include "audioprocessor.hpp"
+#include "fastmath.hpp"
+#include "murasaki.hpp"
+#include "tcm.hpp"
+
+namespace audio {
+
+/**
+ * @brief Shape of the ramp.
+ */
+enum RampShape {
+    krsLinear,         ///< Same step per sample. For the mix and the pan.
+    krsExponential     ///< Same ratio per sample. That is, linear in dB. For the gain.
+};
+
+/**
+ * @brief Magnitude of the smallest value of the exponential ramp. -100dB.
+ */
+const float kExponentialRampFloor = 1e-5f;
+
+/**
+ * @brief Value moving to the target by the given number of the samples.
+ * @details
+ * A parameter changed at the block boundary changes the waveform stepwise. The step is heard as the
+ * click, and the repeated steps by the knob as the zipper noise. The Ramp moves the parameter sample
+ * by sample from the current value to the target.
+ *
+ * Generate() computes the values of up to kChunk samples. Each value is computed from the value at
+ * the top of the chunk independently. That is, the linear ramp is value + step * (i + 1), and the
+ * exponential ramp is value * ratio^(i + 1) by the table computed by SetTarget(). Then, the loop has no
+ * dependency between the samples, and the stage applies the values by another loop without dependency.
+ * The compiler vectorizes both loops.
+ *
+ * While IsActive() is false, the stage uses Value() as a constant, and the ramp costs nothing.
+ * At the end of the ramp, the value is exactly the target.
+ *
+ * SetTarget() uses FastLog2() and FastExp2() instead of the math library. Then, it can be called
+ * from the audio task at the block boundary.
+ */
+class Ramp {
+ public:
+    /**
+     * @brief Maximum number of the samples computed by a Generate().
+     */
+    static const unsigned int kChunk = 16;
+
+    /**
+     * @param value Initial value. The ramp is not active.
+     */
+    explicit Ramp(float value = 1.0f)
+            : value_(value),
+              target_(value),
+              step_(0.0f),
+              remaining_(0),
+              shape_(krsLinear) {
+    }
+
+    /**
+     * @brief Start the ramp from the current value.
+     * @param target Value at the end of the ramp.
+     * @param length Number of the samples of the ramp. 0 to jump at once.
+     * @param shape Shape of the ramp.
+     * @details
+     * The exponential ramp needs the same sign for the current value and the target. Between them,
+     * the value smaller than kExponentialRampFloor in magnitude is moved to kExponentialRampFloor.
+     * The ramp ends at the given target, even if it is 0.
+     */
+    void SetTarget(float target, unsigned int length, RampShape shape = krsLinear) {
+        target_ = target;
+        shape_ = shape;
+        remaining_ = length;
+        if (0 == length || target == value_) {
+            Jump(target);
+            return;
+        }
+
+        if (krsLinear == shape) {
+            step_ = (target - value_) / length;
+        } else {
+            const float from = Floor(value_);
+            const float to = Floor(target);
+            MURASAKI_ASSERT((from > 0.0f) == (to > 0.0f))
+            value_ = from;
+            // log2 of the ratio per sample.
+            step_ = (FastLog2(Abs(to)) - FastLog2(Abs(from))) / length;
+            for (unsigned int i = 0; i < kChunk; i++)
+                power_[i] = FastExp2(step_ * (i + 1));
+        }
+    }
+
+    /**
+     * @brief Set the value at once, without the ramp.
+     */
+    void Jump(float value) {
+        value_ = target_ = value;
+        remaining_ = 0;
+    }
+
+    /**
+     * @return true while the value is moving.
+     */
+    bool IsActive() const {
+        return 0 != remaining_;
+    }
+
+    /**
+     * @return Current value. The value of the last sample generated.
+     */
+    float Value() const {
+        return value_;
+    }
+
+    /**
+     * @return Value at the end of the ramp.
+     */
+    float Target() const {
+        return target_;
+    }
+
+    /**
+     * @brief Compute the values of the next samples, and advance the ramp.
+     * @param values Receives the count values.
+     * @param count Number of the samples. 1 to kChunk.
+     * @details
+     * The samples after the end of the ramp get the target.
+     */
+    void Generate(float *values, unsigned int count) {
+        MURASAKI_ASSERT(0 < count && count <= kChunk)
+        const unsigned int ramp = (count < remaining_) ? count : remaining_;
+        const float value = value_;
+        const float step = step_;
+
+        if (krsLinear == shape_)
+            for (unsigned int i = 0; i < ramp; i++)
+                values[i] = value + step * (i + 1);
+        else
+            for (unsigned int i = 0; i < ramp; i++)
+                values[i] = value * power_[i];
+        for (unsigned int i = ramp; i < count; i++)
+            values[i] = target_;
+
+        remaining_ -= ramp;
+        value_ = (0 == remaining_) ? target_ : values[ramp - 1];
+    }
+
+ private:
+    static float Abs(float x) {
+        return (x < 0.0f) ? -x : x;
+    }
+    static float Floor(float x) {
+        if (Abs(x) >= kExponentialRampFloor)
+            return x;
+        return (x < 0.0f) ? -kExponentialRampFloor : kExponentialRampFloor;
+    }
+
+    float value_;
+    float target_;
+    float step_;        // Step per sample. log2 of the ratio for the exponential ramp.
+    unsigned int remaining_;
+    RampShape shape_;
+    float power_[kChunk];    // ratio^(i + 1) of the exponential ramp.
+};
+
+/**
+ * @brief Stereo gain stage with the click-free change.
+ * @details
+ * Both channels get the same gain. SetGain() and SetLevel() start the ramp of the given length.
+ * The block is processed by the chunks of Ramp::kChunk samples. The gains of a chunk are generated
+ * by the ramp, and then multiplied to the samples by a loop without dependency.
+ *
+ * While the ramp is not active, the unity gain returns immediately, and other gain is a plain
+ * multiplication. Then, the stage can be placed anywhere in the chain, to fade the output of any stage.
+ *
+ * The setters are called from the audio task between the blocks.
+ */
+class SmoothedGain final : public FloatProcessor {
+ public:
+    /**
+     * @param ramp_length Number of the samples to move to the new gain.
+     * @param shape Shape of the ramp. krsExponential moves linearly in dB.
+     * @details
+     * The initial gain is 1.
+     */
+    explicit SmoothedGain(unsigned int ramp_length, RampShape shape = krsExponential)
+            : ramp_(1.0f),
+              ramp_length_(ramp_length),
+              shape_(shape) {
+    }
+
+    /**
+     * @brief Start moving to the new gain.
+     * @param gain Linear gain.
+     */
+    void SetGain(float gain) {
+        ramp_.SetTarget(gain, ramp_length_, shape_);
+    }
+
+    /**
+     * @brief Start moving to the new level.
+     * @param level Gain [dB].
+     */
+    void SetLevel(float level) {
+        SetGain(FastExp2(level / kDecibelPerLog2));
+    }
+
+    /**
+     * @return true while the gain is moving.
+     */
+    bool IsActive() const {
+        return ramp_.IsActive();
+    }
+
+    AUDIO_ITCM_KERNEL(smoothed_gain_process) virtual void Process(const StereoBlock<float> &block) {
+        const unsigned int length = block.Length();
+
+        if (!ramp_.IsActive()) {
+            const float gain = ramp_.Value();
+            if (1.0f == gain)
+                return;
+            for (unsigned int i = 0; i < length; i++) {
+                block.left[i] *= gain;
+                block.right[i] *= gain;
+            }
+            return;
+        }
+
+        float gains[Ramp::kChunk];
+        for (unsigned int top = 0; top < length; top += Ramp::kChunk) {
+            const unsigned int count = (length - top < Ramp::kChunk) ? length - top : Ramp::kChunk;
+            ramp_.Generate(gains, count);
+            for (unsigned int i = 0; i < count; i++) {
+                block.left[top + i] *= gains[i];
+                block.right[top + i] *= gains[i];
+            }
+        }
+    }
+
+ private:
+    Ramp ramp_;
+    const unsigned int ramp_length_;
+    const RampShape shape_;
+};
+
+} /* namespace audio */
+
+#endif /* SMOOTHING_HPP_ */
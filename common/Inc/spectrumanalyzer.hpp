@@ -0,0 +1,158 @@
+/**
+ * @file spectrumanalyzer.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Spectrum analysis of the audio, for the background task.
+ */
+
+#ifndef SPECTRUMANALYZER_HPP_
+#define SPECTRUMANALYZER_HPP_
+
+#include <math.h>
+
+#include "audioprocessor.hpp"
+#include "doublebuffer.hpp"
+#include "fastmath.hpp"
+#include "fft.hpp"
+#include "murasaki.hpp"
+
+namespace audio {
+
+/**
+ * @brief Result of a frame of the audio::SpectrumAnalyzer.
+ */
+struct SpectrumResult {
+    unsigned int frames;    ///< Number of the frames analyzed. 0 before the first frame.
+    unsigned int peak_bin;  ///< Bin of the largest power. Frequency is peak_bin x fs / size.
+    float peak_level;       ///< Level of the sine at the peak bin [dBFS].
+    float rms_level;        ///< RMS of the frame [dBFS].
+};
+
+/**
+ * @brief Spectrum of the mid (L + R) / 2 signal by the Hann windowed real FFT.
+ * @details
+ * The samples are collected into a frame of size samples. When the frame is filled, it is windowed
+ * and transformed by audio::RealFft, and the peak of the power spectrum and the RMS level are published.
+ * The frames are not overlapped.
+ *
+ * The block is not modified. The stage is heavy at the end of the frame. Then, run it in the
+ * background task by audio::BackgroundStage with kbmTap.
+ *
+ * The result is handed to the reader by audio::DoubleBuffer. Read() is called from a task other than
+ * the task of Process().
+ *
+ * The memory is given by the caller. StorageSize() gives the number of the floats.
+ */
+class SpectrumAnalyzer final : public FloatProcessor {
+ public:
+    /**
+     * @brief Number of the floats of the storage.
+     * @param size Number of the samples of a frame.
+     */
+    static constexpr unsigned int StorageSize(unsigned int size) {
+        return 3 * size;    // Frame, FFT work area and window.
+    }
+
+    /**
+     * @param size Number of the samples of a frame. Power of 2, 4 to kMaxFftSize.
+     * @param storage Memory of StorageSize(size) floats. Not owned.
+     * @details
+     * The window is computed by the math library. Create it before the audio starts.
+     */
+    SpectrumAnalyzer(unsigned int size, float *storage)
+            : size_(size),
+              fft_(size),
+              frame_(storage),
+              work_(storage + size),
+              window_(storage + 2 * size),
+              fill_(0),
+              frames_(0),
+              results_(SpectrumResult(), SpectrumResult()) {
+        MURASAKI_ASSERT(nullptr != storage)
+        float sum = 0.0f;
+        for (unsigned int i = 0; i < size; i++) {
+            window_[i] = 0.5f - 0.5f * cosf(2.0f * 3.14159265f * i / size);
+            sum += window_[i];
+        }
+        // A full scale sine gives |X| = sum / 2 at the peak.
+        peak_scale_ = 4.0f / (sum * sum);
+    }
+
+    virtual void Process(const StereoBlock<float> &block) {
+        const unsigned int length = block.Length();
+        for (unsigned int i = 0; i < length; i++) {
+            frame_[fill_] = 0.5f * (block.left[i] + block.right[i]);
+            if (++fill_ == size_) {
+                Analyze();
+                fill_ = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the result of the first frame after the last Read().
+     * @param result Receives the result.
+     * @return true if the result is new since the last Read().
+     * @details
+     * The frames analyzed while the result is waiting for the reader are not published.
+     */
+    bool Read(SpectrumResult *result) {
+        const bool is_new = results_.Update();
+        *result = results_.Front();
+        return is_new;
+    }
+
+ private:
+    void Analyze() {
+        float energy = 0.0f;
+        for (unsigned int i = 0; i < size_; i++) {
+            energy += frame_[i] * frame_[i];
+            work_[i] = frame_[i] * window_[i];
+        }
+        fft_.Forward(work_);
+
+        // Bins 1 to size / 2 - 1. The DC and the Nyquist bin are skipped.
+        unsigned int peak_bin = 1;
+        float peak_power = 0.0f;
+        for (unsigned int k = 1; k < size_ / 2; k++) {
+            const float power = work_[2 * k] * work_[2 * k] + work_[2 * k + 1] * work_[2 * k + 1];
+            if (power > peak_power) {
+                peak_power = power;
+                peak_bin = k;
+            }
+        }
+        frames_++;
+
+        // Skip the publish if the reader has not taken the previous result.
+        SpectrumResult *const result = results_.BeginWrite();
+        if (nullptr == result)
+            return;
+        result->frames = frames_;
+        result->peak_bin = peak_bin;
+        result->peak_level = Decibel(peak_power * peak_scale_);
+        result->rms_level = Decibel(energy / size_);
+        results_.EndWrite();
+    }
+
+    // dB of the power. -200dB for the silence.
+    static float Decibel(float power) {
+        if (power < 1e-20f)
+            return -200.0f;
+        return 0.5f * kDecibelPerLog2 * FastLog2(power);
+    }
+
+    const unsigned int size_;
+    const RealFft fft_;
+    float *const frame_;
+    float *const work_;
+    float *const window_;
+    float peak_scale_;
+    unsigned int fill_;
+    unsigned int frames_;
+    DoubleBuffer<SpectrumResult> results_;
+};
+
+} /* namespace audio */
+
+#endif /* SPECTRUMANALYZER_HPP_ */
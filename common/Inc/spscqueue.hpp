@@ -0,0 +1,77 @@
+/**
+ * @file spscqueue.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Wait-free single producer single consumer queue.
+ */
+
+#ifndef SPSCQUEUE_HPP_
+#define SPSCQUEUE_HPP_
+
+#include <atomic>
+
+namespace audio {
+
+/**
+ * @brief Queue between one producer task and one consumer task.
+ * @tparam T Type of the element. Copied in and out.
+ * @tparam N Number of the slots. Power of 2. N - 1 elements can be queued.
+ * @details
+ * The producer writes the slot and then publishes the new tail. The consumer reads the slot and
+ * then publishes the new head. Each index is written by one side only. Then, Push() and Pop()
+ * finish in a fixed number of steps without any lock. The audio task never waits for the control
+ * task, even if the control task is preempted in the middle of Push().
+ */
+template<typename T, unsigned int N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+ public:
+    SpscQueue()
+            : head_(0),
+              tail_(0) {
+    }
+
+    /**
+     * @brief Append an element.
+     * @param value Element to append. Copied.
+     * @return false if the queue is full. The element is not appended.
+     * @details
+     * Called by the producer.
+     */
+    bool Push(const T &value) {
+        const unsigned int tail = tail_.load(std::memory_order_relaxed);
+        const unsigned int next = (tail + 1) & (N - 1);
+        if (next == head_.load(std::memory_order_acquire))
+            return false;
+        slot_[tail] = value;
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest element.
+     * @param value Receives the element.
+     * @return false if the queue is empty.
+     * @details
+     * Called by the consumer.
+     */
+    bool Pop(T *value) {
+        const unsigned int head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return false;
+        *value = slot_[head];
+        head_.store((head + 1) & (N - 1), std::memory_order_release);
+        return true;
+    }
+
+ private:
+    T slot_[N];
+    std::atomic<unsigned int> head_;    // Next slot to read. Written by the consumer.
+    std::atomic<unsigned int> tail_;    // Next slot to write. Written by the producer.
+};
+
+} /* namespace audio */
+
+#endif /* SPSCQUEUE_HPP_ */
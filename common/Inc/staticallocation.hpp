@@ -0,0 +1,176 @@
+/**
+ * @file staticallocation.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Static allocation of the platform objects, audio buffers and task stacks.
+ * @details
+ * By defining AUDIO_CONFIG_STATIC_ALLOCATION as true in the platform_config.hpp, the objects
+ * created in InitPlatform() are placed in the static storage instead of the heap. Then, the
+ * memory usage of the platform is fixed at the link time, and the heap is left to the DSP buffers.
+ *
+ * The storage is placed in the named linker sections. The linker script must have these sections.
+ * @li .platform_objects : Objects created by AUDIO_NEW(). Task stacks of audio::StaticStackTask, too.
+ * @li .audio_buffers : Buffers declared with AUDIO_BUFFER_SECTION.
+ *
+ * Both sections are not initialized by the startup code. The objects are initialized by their
+ * constructors, and the buffers have to be initialized by the user.
+ *
+ * Note that the internal allocation of the murasaki class library is not affected.
+ */
+
+#ifndef STATICALLOCATION_HPP_
+#define STATICALLOCATION_HPP_
+
+#include <new>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifndef AUDIO_CONFIG_STATIC_ALLOCATION
+#define AUDIO_CONFIG_STATIC_ALLOCATION false
+#endif
+
+/**
+ * @brief Place the variable in the section for the platform objects.
+ */
+#define AUDIO_PLATFORM_SECTION __attribute__((section(".platform_objects")))
+
+/**
+ * @brief Place the variable in the section for the audio buffers.
+ */
+#define AUDIO_BUFFER_SECTION __attribute__((section(".audio_buffers")))
+
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+/**
+ * @brief Create an object in the static storage.
+ * @param T Type of the object.
+ * @details
+ * Used as like new operator. The arguments of the constructor follow the macro.
+ *
+ * @code
+ * murasaki::platform.led = AUDIO_NEW(murasaki::BitOut)(LD2_GPIO_Port, LD2_Pin);
+ * @endcode
+ *
+ * Each use of the macro has its own storage for one object. The object can be re-created
+ * in the storage after audio::Delete(). Then, an object re-created at run time must be created
+ * by one use of the macro, in a helper function. Another use makes another storage.
+ */
+#define AUDIO_NEW(T) \
+    new ([]() -> void * { \
+        static uint8_t storage[sizeof(T)] __attribute__((aligned(alignof(T)))) AUDIO_PLATFORM_SECTION; \
+        return storage; \
+    }()) T
+#else
+#define AUDIO_NEW(T) new T
+#endif
+
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+/**
+ * @brief Assert that the object is allocated.
+ * @details
+ * AUDIO_NEW() never fails with the static allocation. Then, nothing is checked.
+ */
+#define AUDIO_ASSERT_ALLOCATED(object)
+#else
+#define AUDIO_ASSERT_ALLOCATED(object) MURASAKI_ASSERT(nullptr != (object))
+#endif
+
+namespace audio {
+
+/**
+ * @brief Destroy the object created by AUDIO_NEW().
+ * @param object Object to destroy.
+ */
+template<typename T>
+void Delete(T *object) {
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+    object->~T();
+#else
+    delete object;
+#endif
+}
+
+/**
+ * @brief Task of FreeRTOS created with the static stack.
+ * @details
+ * The stack and the task control block are given by the derived class. Then, no heap is used
+ * to create the task. The task function has the same signature as murasaki::SimpleTask.
+ *
+ * configSUPPORT_STATIC_ALLOCATION of FreeRTOSConfig.h must be 1.
+ */
+class StaticTask {
+ public:
+    /**
+     * @brief Create the task.
+     * @details
+     * The task function is called with the parameter given to the constructor.
+     */
+    void Start() {
+        task_ = xTaskCreateStatic(
+                                  &Launch,
+                                  name_,
+                                  stack_depth_,
+                                  this,
+                                  priority_,
+                                  stack_,
+                                  &tcb_);
+    }
+
+ protected:
+    StaticTask(const char *task_name, UBaseType_t task_priority, const void *task_parameter, void (*task_body_func)(const void*),
+               StackType_t *stack, uint32_t stack_depth)
+            : name_(task_name),
+              priority_(task_priority),
+              parameter_(task_parameter),
+              body_(task_body_func),
+              stack_(stack),
+              stack_depth_(stack_depth),
+              task_(nullptr) {
+    }
+
+ private:
+    static void Launch(void *ptr) {
+        StaticTask *const task = static_cast<StaticTask*>(ptr);
+        task->body_(task->parameter_);
+        vTaskDelete(nullptr);
+    }
+
+    const char *const name_;
+    const UBaseType_t priority_;
+    const void *const parameter_;
+    void (*const body_)(const void*);
+    StackType_t *const stack_;
+    const uint32_t stack_depth_;
+    StaticTask_t tcb_;
+    TaskHandle_t task_;
+};
+
+/**
+ * @brief StaticTask with its own stack.
+ * @tparam StackDepth Stack size in words, as like the murasaki::SimpleTask.
+ * @details
+ * The stack is a member. Then, the stack is placed in the .platform_objects section by AUDIO_NEW().
+ *
+ * @code
+ * murasaki::platform.audio_task = AUDIO_NEW(audio::StaticStackTask<256>)(
+ *                                                                     "Audio Task",
+ *                                                                     murasaki::ktpRealtime,
+ *                                                                     nullptr,
+ *                                                                     &TaskBodyFunction);
+ * @endcode
+ */
+template<unsigned int StackDepth>
+class StaticStackTask : public StaticTask {
+ public:
+    StaticStackTask(const char *task_name, UBaseType_t task_priority, const void *task_parameter, void (*task_body_func)(const void*))
+            : StaticTask(task_name, task_priority, task_parameter, task_body_func, stack_, StackDepth) {
+    }
+ private:
+    StackType_t stack_[StackDepth];
+};
+
+} /* namespace audio */
+
+#endif /* STATICALLOCATION_HPP_ */
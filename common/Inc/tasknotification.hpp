@@ -0,0 +1,91 @@
+/**
+ * @file tasknotification.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Wake up of a task by the direct to task notification of FreeRTOS.
+ * @details
+ * The task notification needs no kernel object. The notifier increments the notification value
+ * of the task, and the task takes it. Then, it can be given from an interrupt, without the
+ * semaphore of murasaki::Synchronizer.
+ *
+ * An interrupt which calls GiveFromIsr() must not have a priority higher than
+ * configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY of FreeRTOSConfig.h. That is, its priority value
+ * must be equal or greater than the limit.
+ */
+
+#ifndef TASKNOTIFICATION_HPP_
+#define TASKNOTIFICATION_HPP_
+
+#include <atomic>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+namespace audio {
+
+/**
+ * @brief Wake up of a task, by the task itself or by an interrupt.
+ * @details
+ * The waiting task calls Attach() once, and then Wait() for each wake up. The notifications
+ * given before Attach() are lost. The notifications given while the task is running are merged.
+ * Then, Wait() returns once for them, as like a binary semaphore.
+ */
+class TaskNotification final {
+ public:
+    TaskNotification()
+            : task_(nullptr) {
+    }
+
+    /**
+     * @brief Make the calling task the target of the notification.
+     */
+    void Attach() {
+        task_.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+    }
+
+    /**
+     * @brief Wait for a notification. Called by the attached task.
+     */
+    void Wait() {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    /**
+     * @brief Discard the notifications given so far. Called by the attached task.
+     */
+    void Clear() {
+        ulTaskNotifyTake(pdTRUE, 0);
+    }
+
+    /**
+     * @brief Wake up the attached task. Called by a task.
+     */
+    void Give() {
+        const TaskHandle_t task = task_.load(std::memory_order_acquire);
+        if (nullptr != task)
+            xTaskNotifyGive(task);
+    }
+
+    /**
+     * @brief Wake up the attached task. Called by an interrupt.
+     * @details
+     * If the attached task has a higher priority than the interrupted task, the context is switched
+     * at the end of the interrupt.
+     */
+    void GiveFromIsr() {
+        const TaskHandle_t task = task_.load(std::memory_order_acquire);
+        if (nullptr == task)
+            return;
+        BaseType_t is_woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &is_woken);
+        portYIELD_FROM_ISR(is_woken);
+    }
+
+ private:
+    std::atomic<TaskHandle_t> task_;
+};
+
+} /* namespace audio */
+
+#endif /* TASKNOTIFICATION_HPP_ */
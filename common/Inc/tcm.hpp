@@ -0,0 +1,103 @@
+/**
+ * @file tcm.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Placement of the code and data in the Tightly Coupled Memory of the Cortex-M7.
+ * @details
+ * By defining AUDIO_CONFIG_USE_TCM as true in the platform_config.hpp, the hot code is placed
+ * in the ITCM. Both ITCM and DTCM are zero wait state memory, and not cached. Then, the processing
+ * kernels run without the wait of the flash accelerator and the cache misses, and the DMA
+ * buffers in the DTCM don't need the cache maintenance. See dmacoherency.hpp for the placement
+ * of the DMA buffers.
+ *
+ * The ITCM has the audio task, the block processing and the kernels of the stages. The HAL, the
+ * FreeRTOS and the murasaki library called from them are still in the flash.
+ *
+ * The linker script must have following sections.
+ * @li .itcm_text : Code in the ITCM. Copied from the flash by CopyItcmCode().
+ *     The symbols _sitcm_text, _eitcm_text and _siitcm_text give the range and the load address.
+ * @li .dtcm_bss : Data in the DTCM. Not initialized by the startup.
+ *
+ * On the other processors, and on the host, the macros have no effect.
+ */
+
+#ifndef TCM_HPP_
+#define TCM_HPP_
+
+#include <stdint.h>
+
+#ifndef AUDIO_CONFIG_USE_TCM
+#define AUDIO_CONFIG_USE_TCM false
+#endif
+
+#if AUDIO_CONFIG_USE_TCM && defined(__arm__)
+#include "main.h"   // For __DSB() and __ISB() of CMSIS.
+
+/**
+ * @brief Place the function in the ITCM.
+ * @details
+ * Give this attribute to the declaration of the function.
+ * @code
+ * void Process(float *data, unsigned int length) AUDIO_ITCM_CODE;
+ * @endcode
+ */
+#define AUDIO_ITCM_CODE __attribute__((section(".itcm_text"), noinline))
+/**
+ * @brief Place the inline function in the ITCM.
+ * @details
+ * Give this attribute to the member functions defined in the class. GCC places each inline function
+ * in its own COMDAT group, which can't share a section with the other functions. Then, each function
+ * needs its own section name. The linker script collects them by .itcm_text*.
+ * @code
+ * AUDIO_ITCM_KERNEL(biquad_process) virtual void Process(const StereoBlock<float> &block) {
+ * @endcode
+ * The attribute of the member function of a class template is ignored. Such a function is inlined
+ * into its caller in the ITCM by AUDIO_ITCM_INLINE.
+ */
+#define AUDIO_ITCM_KERNEL(name) __attribute__((section(".itcm_text." #name), noinline))
+/**
+ * @brief Inline the function into its caller, to run it in the ITCM.
+ */
+#define AUDIO_ITCM_INLINE __attribute__((always_inline))
+/**
+ * @brief Place the variable in the DTCM. The variable is not initialized by the startup.
+ */
+#define AUDIO_DTCM_BSS __attribute__((section(".dtcm_bss")))
+
+// Symbols defined by the linker script.
+extern "C" {
+extern uint32_t _sitcm_text;    // Start of the code in the ITCM.
+extern uint32_t _eitcm_text;    // End of the code in the ITCM.
+extern uint32_t _siitcm_text;   // Start of the code in the flash.
+}
+#else
+#define AUDIO_ITCM_CODE
+#define AUDIO_ITCM_KERNEL(name)
+#define AUDIO_ITCM_INLINE
+#define AUDIO_DTCM_BSS
+#endif
+
+namespace audio {
+
+/**
+ * @brief Copy the code of the .itcm_text section from the flash to the ITCM.
+ * @details
+ * Must be called before any function with AUDIO_ITCM_CODE is called. Call at the beginning of
+ * InitPlatform().
+ */
+inline void CopyItcmCode() {
+#if AUDIO_CONFIG_USE_TCM && defined(__arm__)
+    const uint32_t *source = &_siitcm_text;
+    for (uint32_t *destination = &_sitcm_text; destination < &_eitcm_text; destination++)
+        *destination = *source++;
+
+    // Make sure the copied code is visible to the instruction fetch.
+    __DSB();
+    __ISB();
+#endif
+}
+
+} /* namespace audio */
+
+#endif /* TCM_HPP_ */
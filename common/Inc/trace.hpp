@@ -0,0 +1,200 @@
+/**
+ * @file trace.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Binary event trace with the format strings resolved on the host.
+ * @details
+ * AUDIO_TRACE() records the ID of the format string, the cycle counter and up to kTraceArgs
+ * integer arguments into a ring in the RAM. There is no formatting on the target. The ring is dumped
+ * by the debugger, and the host tool tracedecode formats the records by the format strings in the ELF file.
+ *
+ * The format strings are placed in the section trace_formats. The ID is the offset of the string
+ * in the section. The linker script of the target has the section as INFO, at the address 0.
+ * Then, the strings are kept in the ELF file, but not loaded to the flash.
+ *
+ * @code
+ *   trace_formats 0 (INFO) :
+ *   {
+ *     __start_trace_formats = .;
+ *     KEEP(*(trace_formats))
+ *   }
+ * @endcode
+ *
+ * On the host, the GNU linker provides __start_trace_formats for the orphan section.
+ */
+
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+// Define as true to record the events of the audio processing by AUDIO_TRACE().
+#ifndef AUDIO_CONFIG_TRACE
+#define AUDIO_CONFIG_TRACE false
+#endif
+
+// Start of the section trace_formats. Defined by the linker.
+extern "C" const char __start_trace_formats[];
+
+/**
+ * @brief ID of a format string of the trace.
+ * @param format String literal. Placed in the section trace_formats.
+ * @details
+ * The ID is fixed at the link time. Use in a non-template function. GCC doesn't keep the section
+ * attribute in a template instantiation.
+ */
+#define AUDIO_TRACE_ID(format) \
+    ([]() -> uint32_t { \
+        static const char string[] __attribute__((section("trace_formats"), used)) = format; \
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(string) - reinterpret_cast<uintptr_t>(__start_trace_formats)); \
+    }())
+
+#if AUDIO_CONFIG_TRACE
+/**
+ * @brief Record an event to the audio::TraceBuffer.
+ * @param trace Pointer to the audio::TraceBuffer.
+ * @param format Format as like printf. String literal. %d, %i, %u, %x, %X, %o and %c are supported.
+ * @details
+ * The arguments are checked against the format by the compiler, as like printf. They are recorded
+ * as 32bit integers. Then, use the l modifier for the 32bit long on the target. Nothing is done
+ * if AUDIO_CONFIG_TRACE is false.
+ *
+ * @code
+ * AUDIO_TRACE(murasaki::platform.trace, "Block %u : %lu cycles", length, cycles);
+ * @endcode
+ */
+#define AUDIO_TRACE(trace, format, ...) \
+    do { \
+        if (false) \
+            audio::CheckTraceFormat(format, ##__VA_ARGS__); \
+        (trace)->Record(AUDIO_TRACE_ID(format), ##__VA_ARGS__); \
+    } while (false)
+#else
+#define AUDIO_TRACE(trace, format, ...) \
+    do { \
+    } while (false)
+#endif
+
+namespace audio {
+
+/**
+ * @brief Maximum number of the arguments of a trace record.
+ */
+const unsigned int kTraceArgs = 3;
+
+/**
+ * @brief A record of the trace. The layout is the format of the dump for the decoder.
+ * @details
+ * All fields are 32bit little endian words.
+ */
+struct TraceRecord {
+    uint32_t sequence;          ///< Order of the record from 1. 0 while being written, or never written.
+    uint32_t id;                ///< ID of the format string. Offset in the section trace_formats.
+    uint32_t timestamp;         ///< Cycle counter at the record.
+    uint32_t args[kTraceArgs];  ///< Arguments. Unused ones are 0.
+};
+
+/**
+ * @brief Check the arguments against the format at the compile time. Never called.
+ */
+inline void CheckTraceFormat(const char *format, ...) __attribute__((format(printf, 1, 2)));
+inline void CheckTraceFormat(const char*, ...) {
+}
+
+/**
+ * @brief Ring of the trace records, overwriting the oldest record.
+ * @tparam N Number of the records. Power of 2.
+ * @details
+ * Record() reserves a record by an atomic increment, and writes it. Any task and interrupt can record
+ * in a fixed number of steps, without any lock. The ring keeps the latest N records, as like a flight
+ * recorder. The records are read by the debugger through Records(), usually while the core is halted.
+ * A record being written has the sequence 0. The decoder skips it. If a writer is preempted while the
+ * others record the length of the ring, its record overwrites a newer one. Make the ring long enough for
+ * the events between the halts of the debugger.
+ *
+ * The timestamp is taken by the clock function given to the constructor.
+ */
+template<unsigned int N>
+class TraceBuffer {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+ public:
+    /**
+     * @param clock Function returning the cycle counter. murasaki::GetCycleCounter() on the target.
+     */
+    explicit TraceBuffer(unsigned int (*clock)())
+            : clock_(clock),
+              head_(0) {
+        for (unsigned int i = 0; i < N; i++)
+            record_[i] = TraceRecord();
+    }
+
+    /**
+     * @brief Record an event. Usually called through AUDIO_TRACE().
+     * @param id ID of the format string by AUDIO_TRACE_ID().
+     * @param args Up to kTraceArgs integers.
+     */
+    template<typename ... Args>
+    void Record(uint32_t id, Args ... args) {
+        static_assert(sizeof...(Args) <= kTraceArgs, "Too many arguments of the trace");
+        const uint32_t values[kTraceArgs + 1] = { ToTraceArg(args)... };    // +1 for the record without argument.
+
+        const uint32_t index = head_.fetch_add(1, std::memory_order_relaxed);
+        TraceRecord &record = record_[index & (N - 1)];
+        record.sequence = 0;
+        std::atomic_signal_fence(std::memory_order_release);
+        record.id = id;
+        record.timestamp = clock_();
+        for (unsigned int i = 0; i < kTraceArgs; i++)
+            record.args[i] = values[i];
+        std::atomic_signal_fence(std::memory_order_release);
+        record.sequence = index + 1;
+    }
+
+    /**
+     * @return The ring of Length() records. Not in order. Sort by the sequence.
+     */
+    const TraceRecord* Records() const {
+        return record_;
+    }
+
+    /**
+     * @return Number of the records in the ring.
+     */
+    static constexpr unsigned int Length() {
+        return N;
+    }
+
+ private:
+    template<typename T>
+    static uint32_t ToTraceArg(T value) {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Integer argument only");
+        return static_cast<uint32_t>(value);
+    }
+
+    TraceRecord record_[N];
+    unsigned int (*const clock_)();
+    std::atomic<uint32_t> head_;
+};
+
+/**
+ * @brief Number of the records of audio::AudioTrace.
+ */
+const unsigned int kAudioTraceLength = 256;
+
+/**
+ * @brief Trace of the audio processing. Dumped by the debugger.
+ */
+class AudioTrace final : public TraceBuffer<kAudioTraceLength> {
+ public:
+    explicit AudioTrace(unsigned int (*clock)())
+            : TraceBuffer<kAudioTraceLength>(clock) {
+    }
+};
+
+} /* namespace audio */
+
+#endif /* TRACE_HPP_ */
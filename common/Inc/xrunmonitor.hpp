@@ -0,0 +1,150 @@
+/**
+ * @file xrunmonitor.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Detection of the audio buffer underrun and overrun.
+ */
+
+#ifndef XRUNMONITOR_HPP_
+#define XRUNMONITOR_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+namespace audio {
+
+/**
+ * @brief Counter of the blocks missed by the audio task.
+ * @details
+ * The audio DMA runs in the circular mode. Each half transfer interrupt hands a block to the audio task.
+ * If the audio task is late, the DMA does not wait. The TX DMA transmits the stale block again, and
+ * the RX DMA overwrites the block not yet read. Both are silent.
+ *
+ * This class compares the number of the DMA transfers against the number of the blocks consumed
+ * by the audio task. The DMA interrupts call NotifyTxTransfer() and NotifyRxTransfer() at each half and
+ * full transfer. The audio task calls Check() once a block, after the block exchange.
+ *
+ * In the normal operation, the difference between the transfers and the consumed blocks is
+ * constant. It is taken as the baseline at the first Check() after Restart(). If the difference
+ * grows, the DMA has run ahead of the audio task. The increase is the number of the missed blocks.
+ * murasaki::DuplexAudio::TransmitAndReceive() returns after both of the TX and RX transfer of a block.
+ * Then, the difference doesn't jitter in the normal operation.
+ *
+ * The counters are accumulated since the boot, over the Restart().
+ */
+class XrunMonitor {
+ public:
+    XrunMonitor()
+            : tx_transfers_(0),
+              rx_transfers_(0),
+              missed_tx_(0),
+              missed_rx_(0),
+              xrun_events_(0),
+              consumed_(0),
+              tx_baseline_(0),
+              rx_baseline_(0),
+              is_started_(false) {
+    }
+
+    /**
+     * @brief Count a TX DMA transfer of a block.
+     * @details
+     * Called from the DMA half and full transfer interrupt of the TX.
+     */
+    void NotifyTxTransfer() {
+        tx_transfers_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Count a RX DMA transfer of a block.
+     * @details
+     * Called from the DMA half and full transfer interrupt of the RX.
+     */
+    void NotifyRxTransfer() {
+        rx_transfers_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Forget the baseline.
+     * @details
+     * Called from the audio task when the audio is restarted. The next Check() takes the new baseline.
+     */
+    void Restart() {
+        is_started_ = false;
+    }
+
+    /**
+     * @brief Account a block consumed by the audio task.
+     * @return true if blocks were missed since the last check.
+     * @details
+     * Called from the audio task after each block exchange.
+     */
+    bool Check() {
+        consumed_++;
+        const int32_t tx_balance = static_cast<int32_t>(tx_transfers_.load(std::memory_order_relaxed) - consumed_);
+        const int32_t rx_balance = static_cast<int32_t>(rx_transfers_.load(std::memory_order_relaxed) - consumed_);
+
+        if (!is_started_) {
+            tx_baseline_ = tx_balance;
+            rx_baseline_ = rx_balance;
+            is_started_ = true;
+            return false;
+        }
+
+        // Count the growth of the balance, and take it as the new baseline.
+        const bool is_tx_missed = Account(tx_balance, &tx_baseline_, &missed_tx_);
+        const bool is_rx_missed = Account(rx_balance, &rx_baseline_, &missed_rx_);
+        const bool is_missed = is_tx_missed || is_rx_missed;
+        if (is_missed)
+            xrun_events_.store(xrun_events_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return is_missed;
+    }
+
+    /**
+     * @return Number of the TX blocks transmitted again because the audio task was late. Underrun.
+     */
+    uint32_t GetMissedTxBlocks() const {
+        return missed_tx_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Number of the RX blocks overwritten before the audio task read them. Overrun.
+     */
+    uint32_t GetMissedRxBlocks() const {
+        return missed_rx_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Number of the checks which found the missed blocks.
+     */
+    uint32_t GetXrunEvents() const {
+        return xrun_events_.load(std::memory_order_relaxed);
+    }
+
+ private:
+    static bool Account(int32_t balance, int32_t *baseline, std::atomic<uint32_t> *missed) {
+        if (balance <= *baseline)
+            return false;
+        missed->store(missed->load(std::memory_order_relaxed) + (balance - *baseline), std::memory_order_relaxed);
+        *baseline = balance;
+        return true;
+    }
+
+    // Updated by the DMA interrupts.
+    std::atomic<uint32_t> tx_transfers_;
+    std::atomic<uint32_t> rx_transfers_;
+    // Updated by the audio task, read by the other tasks.
+    std::atomic<uint32_t> missed_tx_;
+    std::atomic<uint32_t> missed_rx_;
+    std::atomic<uint32_t> xrun_events_;
+    // Owned by the audio task.
+    uint32_t consumed_;
+    int32_t tx_baseline_;
+    int32_t rx_baseline_;
+    bool is_started_;
+};
+
+} /* namespace audio */
+
+#endif /* XRUNMONITOR_HPP_ */
@@ -0,0 +1,1666 @@
+/**
+ * @file audioplatform.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Implementation of the murasaki platform shared among the boards.
+ * @details
+ * InitPlatform(), ExecPlatform(), the audio task and the analysis task of all boards. This file is
+ * compiled in the project of each board, with the board.hpp in the Core/Inc of the project. The
+ * board.hpp defines the struct Board. This file refers the peripherals only through the struct Board.
+ * Then, a change of the audio path is done once for all boards.
+ *
+ * The struct Board has the following static members. All of them are resolved at the compile time,
+ * and inlined. There is no virtual call and no run time selection.
+ * @li AudioPortAdapter : Type of the murasaki audio port adapter. murasaki::SaiPortAdapter or murasaki::I2sPortAdapter.
+ * @li TxPort(), RxPort() : Peripheral handles given to the AudioPortAdapter.
+ * @li TxDma(), RxDma() : DMA handles of the TX and RX port.
+ * @li StopAudioPort() : Stop the DMA of both ports.
+ * @li ConsoleUart() : UART of the console.
+ * @li CodecI2c() : I2C master to control the CODEC.
+ * @li StatusLed0Port(), StatusLed0Pin(), StatusLed1Port(), StatusLed1Pin() : Status LEDs on the audio board.
+ * @li IsUserButtonPressed() : Read the user button.
+ *
+ * With AUDIO_CONFIG_INTERRUPT_AUDIO or AUDIO_CONFIG_Q31_PROCESSING, the platform runs the circular DMA by itself,
+ * and the following are needed in addition.
+ * @li kDmaWordOrder : audio::DmaWordOrder of the DMA buffer.
+ * @li StartAudioDma(tx, rx, words) : Start the circular DMA of both ports. The interrupt is disabled by the caller.
+ * @li TxDmaIrq(), RxDmaIrq() : IRQ numbers of the DMA of both ports. Their priority is checked at the start.
+ *
+ * The functions are ordinary functions, not the members of a class template of the board. GCC doesn't
+ * keep the section attribute of a template instantiation. Then, AUDIO_ITCM_CODE and the static
+ * buffers in the sections have to be in the non-template functions.
+ */
+
+// Include the definition created by CubeIDE.
+#include <murasaki_platform.hpp>
+#include "main.h"
+
+// Include the murasaki class library.
+#include "murasaki.hpp"
+
+// The peripherals of the board, by the struct Board.
+#include "board.hpp"
+
+// Include the audio processing helpers shared among the boards.
+#include "blockexchanger.hpp"
+#include "blocklength.hpp"
+#include "samplerate.hpp"
+#include "loadmeter.hpp"
+#include "latencymeter.hpp"
+#include "xrunmonitor.hpp"
+#include "logring.hpp"
+#include "trace.hpp"
+#include "interruptaudio.hpp"
+#include "q31blockexchanger.hpp"
+#include "q31gain.hpp"
+#include "staticallocation.hpp"
+#include "tasknotification.hpp"
+#include "tcm.hpp"
+#include "dmacoherency.hpp"
+#include "biquad.hpp"
+#include "biquadq31.hpp"
+#include "fir.hpp"
+#include "partitionedconvolver.hpp"
+#include "dynamics.hpp"
+#include "parameterqueue.hpp"
+#include "smoothing.hpp"
+#include "pipeline.hpp"
+#include "backgroundstage.hpp"
+#include "spectrumanalyzer.hpp"
+#include "resampler.hpp"
+#if AUDIO_CONFIG_CONVOLUTION
+#include "smallroomir.hpp"
+#endif
+
+#include <atomic>
+
+// Include the prototype  of functions of this file.
+
+/* -------------------- PLATFORM Macros -------------------------- */
+#define CODEC_I2C_DEVICE_ADDR 0x38
+#define AUDIO_CHANNEL_LEN 128   // Default length. Can be changed at run time.
+#define AUDIO_SAMPLE_RATE 48000   // Default rate. Can be changed at run time.
+#define AUDIO_TASK_STACK_DEPTH 256
+#define AUDIO_FIR_TAPS 63         // Taps of the FIR filter after the equalizer.
+#define AUDIO_FIR_CUTOFF 20000    // Cutoff frequency of the FIR low pass filter [Hz].
+#define AUDIO_DYNAMICS_LOOKAHEAD (AUDIO_CHANNEL_LEN / 2)  // Lookahead of the limiter [samples].
+#define AUDIO_LONG_PUSH_COUNT 20  // Polls of the user button to be a long push. 1 second.
+#define AUDIO_SMOOTHING_LENGTH 256 // Ramp of the parameter changes [samples]. 5.3mS at 48kHz.
+#define AUDIO_ANALYSIS_TASK_STACK_DEPTH 256
+#define AUDIO_ANALYSIS_SIZE 1024  // Samples of a frame of the spectrum analysis. 21mS at 48kHz.
+#define AUDIO_BACKGROUND_SLOTS 4  // Blocks in the FIFO between the audio task and the analysis task.
+// The platform runs the circular DMA by itself, instead of murasaki::DuplexAudio.
+#define AUDIO_CIRCULAR_DMA (AUDIO_CONFIG_INTERRUPT_AUDIO || AUDIO_CONFIG_Q31_PROCESSING)
+/* -------------------- PLATFORM Type and classes -------------------------- */
+
+/**
+ * @brief Processing chain of the audio task.
+ * @details
+ * Equalizer, FIR filter, convolution with the room (if configured), compressor and limiter,
+ * and the output volume. The stages are called by their types, without the virtual dispatch.
+ *
+ * By AUDIO_CONFIG_BACKGROUND_CONVOLUTION, the convolution is run by the analysis task, and the chain
+ * takes its result one block later.
+ */
+#if AUDIO_CONFIG_CONVOLUTION
+#if AUDIO_CONFIG_BACKGROUND_CONVOLUTION
+typedef audio::BackgroundStage ConvolutionStage;
+#else
+typedef audio::PartitionedConvolver ConvolutionStage;
+#endif
+typedef audio::StaticChain<audio::BiquadCascade, audio::FirFilter, ConvolutionStage, audio::DynamicsProcessor,
+        audio::SmoothedGain> ProcessingChain;
+#else
+typedef audio::StaticChain<audio::BiquadCascade, audio::FirFilter, audio::DynamicsProcessor, audio::SmoothedGain> ProcessingChain;
+#endif
+
+#if AUDIO_CONFIG_Q31_PROCESSING
+/**
+ * @brief Processing chain of the Q31 processing.
+ * @details
+ * Equalizer and the output volume, in Q31. Replaces the ProcessingChain by AUDIO_CONFIG_Q31_PROCESSING.
+ */
+typedef audio::Q31StaticChain<audio::BiquadCascadeQ31, audio::Q31Gain> ProcessingChainQ31;
+#endif
+
+/**
+ * @brief Parameters of the audio task, changed through the murasaki::platform.parameters.
+ */
+enum ParameterId {
+    kpiCompressorThreshold,     ///< [dBFS]
+    kpiCompressorRatio,         ///< 1 or more.
+    kpiCompressorAttack,        ///< [S]
+    kpiCompressorRelease,       ///< [S]
+    kpiCompressorMakeup,        ///< [dB]
+    kpiLimiterCeiling,          ///< [dBFS]
+    kpiLimiterRelease,          ///< [S]
+    kpiOutputLevel,             ///< [dB] After the limiter. 0 or less keeps the ceiling.
+    kpiNumParameters
+};
+
+/* -------------------- PLATFORM Variables-------------------------- */
+
+#if AUDIO_CONFIG_RESAMPLING
+// Coefficients of the sample rate conversion. Computed by the compiler, and placed in the flash.
+static constexpr audio::ResamplerTable<AUDIO_SAMPLE_RATE, AUDIO_CONFIG_PROCESSING_RATE> kToProcessingRate(
+                                                                                                         AUDIO_SAMPLE_RATE,
+                                                                                                         AUDIO_CONFIG_PROCESSING_RATE);
+static constexpr audio::ResamplerTable<AUDIO_CONFIG_PROCESSING_RATE, AUDIO_SAMPLE_RATE> kToCodecRate(
+                                                                                                    AUDIO_CONFIG_PROCESSING_RATE,
+                                                                                                    AUDIO_SAMPLE_RATE);
+#endif
+
+/* -------------------- PLATFORM Prototypes ------------------------- */
+
+#if ! AUDIO_CONFIG_INTERRUPT_AUDIO
+void TaskBodyFunction(const void *ptr) AUDIO_ITCM_CODE;
+#endif
+#if AUDIO_CONFIG_Q31_PROCESSING
+static void ProcessBlockQ31(const audio::StereoBlock<audio::q31_t> &block) AUDIO_ITCM_CODE;
+#else
+static void ProcessBlock(const audio::StereoBlock<float> &block) AUDIO_ITCM_CODE;
+#endif
+#if AUDIO_CONFIG_ANALYSIS
+void AnalysisTaskBodyFunction(const void *ptr);
+static void PrintAnalysisStatistics();
+#endif
+static void CheckUserButton();
+static void RequestNextBlockLength();
+static void RequestNextSampleRate();
+static murasaki::AudioCodecStrategy* CreateCodec(unsigned int fs);
+#if ! AUDIO_CIRCULAR_DMA
+static murasaki::DuplexAudio* CreateDuplexAudio(unsigned int length);
+#endif
+static void StartCodec();
+static void ChangeSampleRate();
+static void CheckSampleRateSwitch();
+static unsigned int ProcessingRate();
+static void PrintLoadStatistics();
+#if ! AUDIO_CIRCULAR_DMA
+static void HookAudioDma();
+static void InstallXrunHooks(DMA_HandleTypeDef *tx_dma, DMA_HandleTypeDef *rx_dma);
+#endif
+static void PrintXrunStatistics();
+static void PrintLog();
+#if AUDIO_CONFIG_TRACE
+static void PrintTraceLocation();
+#endif
+static void PrintLatencyStatistics();
+#if AUDIO_CIRCULAR_DMA
+static void StartCircularAudio();
+static void CheckAudioDmaPriority();
+static void InstallCircularDmaHooks(DMA_HandleTypeDef *tx_dma, DMA_HandleTypeDef *rx_dma);
+#endif
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+static void CheckInterruptAudioChange();
+#endif
+static void SetEqualizer();
+static void SetFirFilter();
+static void SetDynamics();
+static bool SetParameter(ParameterId id, float value);
+static void ApplyParameters();
+#if AUDIO_CONFIG_COHERENCY_BENCHMARK
+static void RunCoherencyBenchmark();
+#endif
+
+/* -------------------- PLATFORM Implementation ------------------------- */
+
+void InitPlatform()
+{
+    // Copy the hot code to the ITCM, before the audio task runs.
+    audio::CopyItcmCode();
+
+    // Make the .nocache_bss section non-cacheable, before the DMA buffers are allocated.
+    audio::ConfigureNonCacheableRegion();
+
+#if ! MURASAKI_CONFIG_NOCYCCNT
+    // Start the cycle counter to measure the cycle in MURASAKI_SYSLOG.
+    murasaki::InitCycleCounter();
+#endif
+    // UART device setting for console interface.
+    // On Nucleo, the port connected to the USB port of ST-Link is
+    // referred here.
+    murasaki::platform.uart_console = AUDIO_NEW(murasaki::DebuggerUart)(Board::ConsoleUart());
+#if ! AUDIO_CONFIG_STATIC_ALLOCATION
+    while (nullptr == murasaki::platform.uart_console)
+        ;  // stop here on the memory allocation failure.
+#endif
+
+    // UART is used for logging port.
+    // At least one logger is needed to run the debugger class.
+    murasaki::platform.logger = AUDIO_NEW(murasaki::UartLogger)(murasaki::platform.uart_console);
+#if ! AUDIO_CONFIG_STATIC_ALLOCATION
+    while (nullptr == murasaki::platform.logger)
+        ;  // stop here on the memory allocation failure.
+#endif
+
+    // Setting the debugger
+    murasaki::debugger = AUDIO_NEW(murasaki::Debugger)(murasaki::platform.logger);
+#if ! AUDIO_CONFIG_STATIC_ALLOCATION
+    while (nullptr == murasaki::debugger)
+        ;  // stop here on the memory allocation failure.
+#endif
+
+    // Set the debugger as AutoRePrint mode, for the easy operation.
+    murasaki::debugger->AutoRePrint();  // type any key to show history.
+
+    // Status LED registration.
+    // The port and pin names are defined by CubeIDE.
+    murasaki::platform.led = AUDIO_NEW(murasaki::BitOut)(LD2_GPIO_Port, LD2_Pin);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.led)
+
+    murasaki::platform.led_st0 = AUDIO_NEW(murasaki::BitOut)(Board::StatusLed0Port(), Board::StatusLed0Pin());
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.led_st0)
+    murasaki::platform.led_st1 = AUDIO_NEW(murasaki::BitOut)(Board::StatusLed1Port(), Board::StatusLed1Pin());
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.led_st1)
+
+    // Create an I2C master controller.
+    murasaki::platform.i2c_master = AUDIO_NEW(murasaki::I2cMaster)(Board::CodecI2c());
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.i2c_master)
+
+    // Select the sampling frequency.
+    // While the processing runs at the converted rate, the conversion tables fix the CODEC rate.
+    murasaki::platform.sample_rate = AUDIO_NEW(audio::SampleRate)(
+                                                                  AUDIO_SAMPLE_RATE,
+                                                                  ! AUDIO_CONFIG_RESAMPLING); /* Switchable */
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.sample_rate)
+
+    // Create an ADAU1361 CODEC controller.
+    murasaki::platform.codec = CreateCodec(murasaki::platform.sample_rate->Get());
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.codec)
+
+    // Create an Audio Port. SAI or I2S, by the board.
+    murasaki::platform.audio_port = AUDIO_NEW(Board::AudioPortAdapter)(
+                                                                       Board::TxPort(), /* TX port.*/
+                                                                       Board::RxPort()); /* RX port. */
+
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.audio_port)
+
+    // Select the length of the audio block.
+    // Holding the user button at reset selects the low latency mode.
+    murasaki::platform.audio_block = AUDIO_NEW(audio::BlockLength)(
+                                                                   Board::IsUserButtonPressed() ?
+                                                                           audio::kLowLatencyBlockLength :
+                                                                           AUDIO_CHANNEL_LEN);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.audio_block)
+
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    // Process the audio in the DMA interrupt. No audio framework and no audio task.
+    // The order of the halves of a sample in the DMA buffer is given by the board.
+    // The DMA buffers are sized for the longest block. Then, the block length can be changed in place.
+    static int32_t interrupt_audio_dma[audio::InterruptAudio::DmaStorageSize(audio::kMaxBlockLength)] AUDIO_BUFFER_SECTION;
+#if AUDIO_CONFIG_Q31_PROCESSING
+    // The Q31 samples are taken from the DMA words as they are.
+    static audio::q31_t interrupt_audio_storage[audio::InterruptAudio::StorageSize(audio::kMaxBlockLength)];
+    murasaki::platform.interrupt_audio = AUDIO_NEW(audio::InterruptAudio)(
+                                                                          &ProcessBlockQ31,
+#else
+    static float interrupt_audio_storage[audio::InterruptAudio::StorageSize(audio::kMaxBlockLength)];
+    murasaki::platform.interrupt_audio = AUDIO_NEW(audio::InterruptAudio)(
+                                                                          &ProcessBlock,
+#endif
+                                                                          Board::kDmaWordOrder,
+                                                                          audio::kMaxBlockLength,
+                                                                          interrupt_audio_dma,
+                                                                          interrupt_audio_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.interrupt_audio)
+    murasaki::platform.q31_exchanger = nullptr;
+    murasaki::platform.audio = nullptr;
+#elif AUDIO_CONFIG_Q31_PROCESSING
+    // The audio task exchanges the Q31 blocks with the circular DMA, because murasaki::DuplexAudio
+    // exchanges only the float blocks. The buffers are sized for the longest block, as like above.
+    static int32_t q31_exchanger_dma[audio::InterruptAudio::DmaStorageSize(audio::kMaxBlockLength)] AUDIO_BUFFER_SECTION;
+    static audio::q31_t q31_exchanger_storage[audio::InterruptAudio::StorageSize(audio::kMaxBlockLength)];
+    murasaki::platform.q31_exchanger = AUDIO_NEW(audio::Q31BlockExchanger)(
+                                                                          Board::kDmaWordOrder,
+                                                                          audio::kMaxBlockLength,
+                                                                          q31_exchanger_dma,
+                                                                          q31_exchanger_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.q31_exchanger)
+    murasaki::platform.interrupt_audio = nullptr;
+    murasaki::platform.audio = nullptr;
+#else
+    // Create an Audio Framework
+    // For both input and output
+    murasaki::platform.audio = CreateDuplexAudio(murasaki::platform.audio_block->Get());
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.audio)
+    murasaki::platform.interrupt_audio = nullptr;
+    murasaki::platform.q31_exchanger = nullptr;
+#endif
+
+    // CPU load measurement of the audio task.
+    murasaki::platform.load_meter = AUDIO_NEW(audio::LoadMeter)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.load_meter)
+
+    // Latency from the DMA interrupt to the processing of the block.
+    murasaki::platform.latency = AUDIO_NEW(audio::LatencyMeter)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.latency)
+
+    // Detection of the blocks missed by the audio task.
+    murasaki::platform.xrun = AUDIO_NEW(audio::XrunMonitor)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.xrun)
+
+    // Log of the audio task and the interrupts. Formatted and printed by ExecPlatform().
+    murasaki::platform.log = AUDIO_NEW(audio::DebugLog)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.log)
+
+#if AUDIO_CONFIG_TRACE
+    // Binary trace of the block handling. Dumped by the debugger, and decoded on the host.
+    murasaki::platform.trace = AUDIO_NEW(audio::AudioTrace)(&murasaki::GetCycleCounter);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.trace)
+#else
+    murasaki::platform.trace = nullptr;
+#endif
+
+    // Parametric equalizer of the audio task. Pass through until SetEqualizer().
+    // The later changes move to the new coefficients sample by sample.
+    murasaki::platform.equalizer = AUDIO_NEW(audio::BiquadCascade)(AUDIO_SMOOTHING_LENGTH);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.equalizer)
+
+    // FIR filter after the equalizer. Pass through until SetFirFilter().
+    // The coefficients and the state are in the DTCM, if available.
+    static float fir_storage[audio::FirFilter::StorageSize(AUDIO_FIR_TAPS)] AUDIO_DTCM_BSS;
+    murasaki::platform.fir = AUDIO_NEW(audio::FirFilter)(AUDIO_FIR_TAPS, fir_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.fir)
+
+#if AUDIO_CONFIG_CONVOLUTION
+    // Convolution with the impulse response of a small room, after the FIR filter.
+    // The spectra of the impulse response are in the flash. The state is too big for the DTCM.
+    static_assert(audio::kSmallRoomIr.partition_size == AUDIO_CHANNEL_LEN, "Regenerate smallroomir.hpp with -b AUDIO_CHANNEL_LEN");
+    static float convolver_storage[audio::PartitionedConvolver::StorageSize(
+                                                                           audio::kSmallRoomIr.partition_size,
+                                                                           audio::kSmallRoomIr.partitions)];
+    murasaki::platform.convolver = AUDIO_NEW(audio::PartitionedConvolver)(audio::kSmallRoomIr, convolver_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.convolver)
+#else
+    murasaki::platform.convolver = nullptr;
+#endif
+
+#if AUDIO_CONFIG_BACKGROUND_CONVOLUTION
+    // The convolution is run by the analysis task. The audio task takes its result at the next block.
+    static_assert(AUDIO_CONFIG_CONVOLUTION && AUDIO_CONFIG_ANALYSIS, "The background convolution needs the convolver and the analysis task");
+    static_assert(!AUDIO_CONFIG_RESAMPLING, "The background convolution needs the fixed block length");
+    static float background_convolver_storage[audio::BackgroundStage::StorageSize(AUDIO_BACKGROUND_SLOTS, audio::kMaxBlockLength)];
+    murasaki::platform.background_convolver = AUDIO_NEW(audio::BackgroundStage)(
+                                                                                murasaki::platform.convolver,
+                                                                                audio::kbmReplace,
+                                                                                AUDIO_BACKGROUND_SLOTS,
+                                                                                audio::kMaxBlockLength,
+                                                                                background_convolver_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.background_convolver)
+#else
+    murasaki::platform.background_convolver = nullptr;
+#endif
+
+    // Parameter changes from the control task to the audio task.
+    murasaki::platform.parameters = AUDIO_NEW(audio::ParameterQueue)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.parameters)
+
+    // Compressor and limiter at the end of the processing. Pass through until SetDynamics().
+    // The delay line is in the DTCM, if available.
+    static float dynamics_storage[audio::DynamicsProcessor::StorageSize(AUDIO_DYNAMICS_LOOKAHEAD)] AUDIO_DTCM_BSS;
+    murasaki::platform.dynamics = AUDIO_NEW(audio::DynamicsProcessor)(AUDIO_DYNAMICS_LOOKAHEAD, ProcessingRate(), dynamics_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.dynamics)
+
+    // Output volume after the limiter. Unity gain until kpiOutputLevel is sent.
+    murasaki::platform.volume = AUDIO_NEW(audio::SmoothedGain)(AUDIO_SMOOTHING_LENGTH);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.volume)
+
+
+    // Chain of the stages above, in the order of the processing.
+    murasaki::platform.chain = AUDIO_NEW(ProcessingChain)(
+                                                          *murasaki::platform.equalizer,
+                                                          *murasaki::platform.fir,
+#if AUDIO_CONFIG_CONVOLUTION
+#if AUDIO_CONFIG_BACKGROUND_CONVOLUTION
+                                                          *murasaki::platform.background_convolver,
+#else
+                                                          *murasaki::platform.convolver,
+#endif
+#endif
+                                                          *murasaki::platform.dynamics,
+                                                          *murasaki::platform.volume);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.chain)
+
+#if AUDIO_CONFIG_Q31_PROCESSING
+    // Equalizer of the Q31 processing. Pass through until SetEqualizer().
+    murasaki::platform.q31_equalizer = AUDIO_NEW(audio::BiquadCascadeQ31)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.q31_equalizer)
+
+    // Output volume of the Q31 processing. Exact unity gain until kpiOutputLevel is sent.
+    murasaki::platform.q31_volume = AUDIO_NEW(audio::Q31Gain)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.q31_volume)
+
+    // Chain of the Q31 stages. Replaces the chain above.
+    murasaki::platform.q31_chain = AUDIO_NEW(ProcessingChainQ31)(
+                                                                 *murasaki::platform.q31_equalizer,
+                                                                 *murasaki::platform.q31_volume);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.q31_chain)
+#else
+    murasaki::platform.q31_equalizer = nullptr;
+    murasaki::platform.q31_volume = nullptr;
+    murasaki::platform.q31_chain = nullptr;
+#endif
+
+#if AUDIO_CONFIG_ANALYSIS
+    // Spectrum analysis of the output of the chain. Run by the analysis task.
+    static float spectrum_storage[audio::SpectrumAnalyzer::StorageSize(AUDIO_ANALYSIS_SIZE)];
+    murasaki::platform.spectrum = AUDIO_NEW(audio::SpectrumAnalyzer)(AUDIO_ANALYSIS_SIZE, spectrum_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.spectrum)
+
+    // The audio task copies its output into the FIFO. The analysis task may be late by a few blocks.
+    static float analysis_storage[audio::BackgroundStage::StorageSize(AUDIO_BACKGROUND_SLOTS, audio::kMaxBlockLength)];
+    murasaki::platform.analysis = AUDIO_NEW(audio::BackgroundStage)(
+                                                                    murasaki::platform.spectrum,
+                                                                    audio::kbmTap,
+                                                                    AUDIO_BACKGROUND_SLOTS,
+                                                                    audio::kMaxBlockLength,
+                                                                    analysis_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.analysis)
+
+    // CPU load of the analysis task, including the time preempted by the audio task.
+    murasaki::platform.analysis_meter = AUDIO_NEW(audio::LoadMeter)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.analysis_meter)
+
+    // Wake up of the analysis task by the audio task, at each block.
+    murasaki::platform.analysis_request = AUDIO_NEW(audio::TaskNotification)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.analysis_request)
+#else
+    murasaki::platform.spectrum = nullptr;
+    murasaki::platform.analysis = nullptr;
+    murasaki::platform.analysis_meter = nullptr;
+    murasaki::platform.analysis_request = nullptr;
+#endif
+
+#if AUDIO_CONFIG_RESAMPLING
+    // Sample rate conversion around the processing chain. Sized for the longest block.
+    static float resampler_storage[audio::ResamplingStage::StorageSize(
+                                                                      kToProcessingRate,
+                                                                      kToCodecRate,
+                                                                      audio::kMaxBlockLength,
+                                                                      AUDIO_SAMPLE_RATE,
+                                                                      AUDIO_CONFIG_PROCESSING_RATE)];
+    murasaki::platform.resampler = AUDIO_NEW(audio::ResamplingStage)(
+                                                                     kToProcessingRate,
+                                                                     kToCodecRate,
+                                                                     audio::kMaxBlockLength,
+                                                                     AUDIO_SAMPLE_RATE,
+                                                                     AUDIO_CONFIG_PROCESSING_RATE,
+                                                                     resampler_storage);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.resampler)
+#else
+    murasaki::platform.resampler = nullptr;
+#endif
+
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    // The audio is processed by the DMA interrupt on the main stack.
+    murasaki::platform.audio_task = nullptr;
+#else
+    // For demonstration of FreeRTOS task.
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+    // The stack is a member of the task object. Then, it is in the static storage.
+    murasaki::platform.audio_task = AUDIO_NEW(audio::StaticStackTask<AUDIO_TASK_STACK_DEPTH>)(
+                                                                                             "Audio Task",
+                                                                                             murasaki::ktpRealtime, /* Audio signal processing need higher priorirty */
+                                                                                             nullptr, /* Task parameter */
+                                                                                             &TaskBodyFunction
+                                                                                             );
+#else
+    murasaki::platform.audio_task = new murasaki::SimpleTask(
+                                                             "Audio Task",
+                                                             AUDIO_TASK_STACK_DEPTH, /* Stack size */
+                                                             murasaki::ktpRealtime, /* Audio signal processing need higher priorirty */
+                                                             nullptr, /* Stack is needed to allocate internally */
+                                                             &TaskBodyFunction
+                                                             );
+#endif
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.audio_task)
+#endif
+
+#if AUDIO_CONFIG_ANALYSIS
+    // The analysis task is lower than the audio task. Then, it runs in the idle time between the blocks.
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+    murasaki::platform.analysis_task = AUDIO_NEW(audio::StaticStackTask<AUDIO_ANALYSIS_TASK_STACK_DEPTH>)(
+                                                                                                         "Analysis Task",
+                                                                                                         murasaki::ktpHigh, /* Lower than the audio task */
+                                                                                                         nullptr, /* Task parameter */
+                                                                                                         &AnalysisTaskBodyFunction
+                                                                                                         );
+#else
+    murasaki::platform.analysis_task = new murasaki::SimpleTask(
+                                                                "Analysis Task",
+                                                                AUDIO_ANALYSIS_TASK_STACK_DEPTH, /* Stack size */
+                                                                murasaki::ktpHigh, /* Lower than the audio task */
+                                                                nullptr, /* Stack is needed to allocate internally */
+                                                                &AnalysisTaskBodyFunction
+                                                                );
+#endif
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.analysis_task)
+#else
+    murasaki::platform.analysis_task = nullptr;
+#endif
+
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    // ExecPlatform() starts the CODEC by itself.
+    murasaki::platform.codec_ready = nullptr;
+#else
+    // For synchronization between ExecPlatoform() and audio task.
+    murasaki::platform.codec_ready = AUDIO_NEW(murasaki::Synchronizer)();
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.codec_ready)
+#endif
+
+
+}
+
+void ExecPlatform()
+{
+#if AUDIO_CONFIG_COHERENCY_BENCHMARK
+    // Compare the cost of the DMA cache coherency, while the audio DMA is stopped.
+    RunCoherencyBenchmark();
+#endif
+
+    // Set the equalizer. The coefficients are computed here, not in the audio task.
+    SetEqualizer();
+
+    // Set the FIR filter. The audio task takes the coefficients at the first block.
+    SetFirFilter();
+
+    // Set the compressor and limiter. The audio task takes the parameters at the first block.
+    SetDynamics();
+
+#if AUDIO_CONFIG_Q31_PROCESSING
+    // Compare the Q31 instructions with the portable reference, before they process the audio.
+    const bool is_q31_ok = audio::SelfTestQ31();
+    murasaki::debugger->Printf("Q31 self test : %s\n", is_q31_ok ? "ok" : "FAILED");
+    MURASAKI_ASSERT(is_q31_ok)
+#endif
+
+#if AUDIO_CONFIG_ANALYSIS
+    // Start the analysis. It waits for the blocks from the audio task.
+    murasaki::platform.analysis_task->Start();
+#endif
+
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    // Start codec activity.
+    StartCodec();
+
+    // Initiate the LED on the AKSAHI 02 board
+    murasaki::platform.led_st0->Clear();
+    murasaki::platform.led_st1->Set();
+
+    // Start audio. The DMA interrupt processes the blocks from here.
+    CheckAudioDmaPriority();
+    StartCircularAudio();
+#else
+    // Start audio
+    murasaki::platform.audio_task->Start();
+
+    // Wait for the codec is ready.
+    murasaki::platform.codec_ready->Wait();
+#endif
+
+    murasaki::Sleep(30);
+
+    // unmute the input and output channels.
+    murasaki::platform.codec->Mute(
+                                   murasaki::kccLineInput,
+                                   false);                     // unmute
+    murasaki::platform.codec->Mute(
+                                   murasaki::kccHeadphoneOutput,
+                                   false);                     // unmute
+
+
+#if AUDIO_CONFIG_TRACE
+    // Tell where to dump the trace.
+    PrintTraceLocation();
+#endif
+
+    // Loop forever. Just status blinking.
+    while (true) {
+
+        // print the CPU load of the audio task since the last print.
+        PrintLoadStatistics();
+
+        // print the missed blocks, if any new.
+        PrintXrunStatistics();
+
+        // print the latency from the DMA interrupt to the processing.
+        PrintLatencyStatistics();
+
+#if AUDIO_CONFIG_ANALYSIS
+        // print the load of the analysis task and the spectrum of the output.
+        PrintAnalysisStatistics();
+#endif
+
+        // wait for a while, watching the user button and the change of the sampling frequency.
+        for (int i = 0; i < 10; i++) {
+            CheckUserButton();
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+            CheckInterruptAudioChange();
+#endif
+            CheckSampleRateSwitch();
+            PrintLog();
+            murasaki::Sleep(50);
+        }
+    }
+}
+
+/* ------------------ Audio port Functions -------------------------- */
+
+#if ! AUDIO_CIRCULAR_DMA
+/**
+ * @brief Hook the DMA interrupts of the audio port to detect the xrun.
+ * @details
+ * Called from the audio task after the first block exchange. The DMA callbacks are set by HAL
+ * when the audio framework starts the DMA at the first exchange.
+ */
+static void HookAudioDma() {
+    InstallXrunHooks(
+                     Board::TxDma(), /* TX DMA */
+                     Board::RxDma()); /* RX DMA */
+}
+#endif
+
+#if AUDIO_CIRCULAR_DMA
+/**
+ * @brief Start the circular DMA of the audio port for the audio::InterruptAudio or the audio::Q31BlockExchanger.
+ * @details
+ * Called while the DMA is stopped. From ExecPlatform() in the interrupt audio mode, and from the audio task
+ * in the Q31 processing. The pending change of the block length is applied here. The audio port is the
+ * slave of the CODEC. Then, both DMA start at the same frame.
+ *
+ * HAL sets its DMA callbacks at the start. They are replaced before any interrupt is taken.
+ * Otherwise, HAL calls the murasaki audio framework, which doesn't exist in this mode.
+ */
+static void StartCircularAudio() {
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    audio::InterruptAudio *const circular = murasaki::platform.interrupt_audio;
+#else
+    audio::Q31BlockExchanger *const circular = murasaki::platform.q31_exchanger;
+#endif
+    circular->SetLength(murasaki::platform.audio_block->Apply());
+
+    // Cycles available for a block.
+    const uint32_t budget = static_cast<uint32_t>(
+            static_cast<uint64_t>(SystemCoreClock) * circular->Length() / murasaki::platform.sample_rate->Get());
+    murasaki::platform.load_meter->SetBudget(budget);
+    murasaki::platform.latency->SetBudget(budget);
+
+    __disable_irq();
+    Board::StartAudioDma(circular->TxBuffer(), circular->RxBuffer(), circular->DmaWords());
+    InstallCircularDmaHooks(
+                            Board::TxDma(), /* TX DMA */
+                            Board::RxDma()); /* RX DMA */
+    __enable_irq();
+}
+
+/**
+ * @brief Check the priority of the audio DMA interrupts.
+ * @details
+ * Called before the audio starts. The DMA interrupts process the blocks and wake up the analysis task,
+ * or wake up the audio task in the Q31 processing, by the FreeRTOS API. Then, their priority must not be higher than
+ * configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY. That is, the priority value must be equal or greater.
+ *
+ * The interrupts with the same or lower priority are held off while a block is processed. CubeIDE
+ * gives the priority 5 to the I2C of the CODEC and the UART of the console, as like the DMA. They are
+ * delayed up to the processing time of a block. That's acceptable, because both are waited by the
+ * tasks without a deadline shorter than a block. They can't be raised over the DMA, because their
+ * callbacks call the FreeRTOS API, too.
+ */
+static void CheckAudioDmaPriority() {
+    MURASAKI_ASSERT(NVIC_GetPriority(Board::TxDmaIrq()) >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY)
+    MURASAKI_ASSERT(NVIC_GetPriority(Board::RxDmaIrq()) >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY)
+}
+#endif
+
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+
+/**
+ * @brief Apply the change of the block length and the sampling frequency.
+ * @details
+ * Called periodically from ExecPlatform(). The work of the audio task in the task mode.
+ * The audio is stopped, changed and started again.
+ */
+static void CheckInterruptAudioChange() {
+    if (!murasaki::platform.audio_block->IsChangeRequested() && !murasaki::platform.sample_rate->IsChangeRequested())
+        return;
+
+    const uint32_t switch_start = murasaki::GetCycleCounter();
+    Board::StopAudioPort();
+    const bool is_rate_changed = murasaki::platform.sample_rate->IsChangeRequested();
+    if (is_rate_changed)
+        ChangeSampleRate();
+    StartCircularAudio();
+    if (is_rate_changed)
+        murasaki::platform.sample_rate->SetSwitchTime(murasaki::GetCycleCounter() - switch_start);
+}
+#endif
+
+
+/**
+ * @brief Create the ADAU1361 CODEC controller.
+ * @param fs Sampling frequency [Hz].
+ * @details
+ * Called from InitPlatform(), and from the audio task to change the sampling frequency.
+ * The object is re-created in the same storage.
+ */
+static murasaki::AudioCodecStrategy* CreateCodec(unsigned int fs) {
+    return AUDIO_NEW(murasaki::Adau1361)(
+                                         fs, /* Fs [Hz] */
+                                         12000000, /* Master clock Xtal frequency, on the UMB-ADAU1361-A board */
+                                         murasaki::platform.i2c_master, /* I2C master port to intgerface with CODEC */
+                                         CODEC_I2C_DEVICE_ADDR); /* Address in 7 bit */
+}
+
+#if ! AUDIO_CIRCULAR_DMA
+/**
+ * @brief Create the audio framework on the audio port.
+ * @param length Number of the samples per channel of a block.
+ * @details
+ * Called from InitPlatform(), and from the audio task to change the block length.
+ * The object is re-created in the same storage.
+ */
+static murasaki::DuplexAudio* CreateDuplexAudio(unsigned int length) {
+    return AUDIO_NEW(murasaki::DuplexAudio)(
+                                            murasaki::platform.audio_port, /* Using the port created above */
+                                            length); /* Length of the each channels. For stereo, both L and R will have this length */
+}
+#endif
+
+/**
+ * @brief Start the CODEC, and set the gain.
+ * @details
+ * Start() programs the PLL of the CODEC for its sampling frequency. The CODEC is still muting.
+ */
+static void StartCodec() {
+    // Start codec activity.
+    murasaki::platform.codec->Start();
+
+    // Input and Output gain setting. Still muting.
+    murasaki::platform.codec->SetGain(
+                                      murasaki::kccLineInput,
+                                      0.0, /* dB */
+                                      0.0); /* dB */
+
+    murasaki::platform.codec->SetGain(
+                                      murasaki::kccHeadphoneOutput,
+                                      0.0, /* dB */
+                                      0.0); /* dB */
+}
+
+/**
+ * @brief Change the sampling frequency.
+ * @details
+ * Called from the audio task, or from ExecPlatform() in the interrupt audio mode, while the audio is stopped. The CODEC is the clock master of the audio
+ * port. Then, only the CODEC is re-created and started by the requested frequency. The clock
+ * configuration of the MCU is not changed.
+ *
+ * The time constants of the compressor are computed again here. The equalizer and the FIR filter
+ * are designed again by CheckSampleRateSwitch().
+ */
+static void ChangeSampleRate() {
+    const unsigned int fs = murasaki::platform.sample_rate->Apply();
+
+    audio::Delete(murasaki::platform.codec);
+    murasaki::platform.codec = CreateCodec(fs);
+    AUDIO_ASSERT_ALLOCATED(murasaki::platform.codec)
+    StartCodec();
+    murasaki::platform.codec->Mute(
+                                   murasaki::kccLineInput,
+                                   false);                     // unmute
+    murasaki::platform.codec->Mute(
+                                   murasaki::kccHeadphoneOutput,
+                                   false);                     // unmute
+
+    murasaki::platform.dynamics->SetSampleRate(ProcessingRate());
+}
+
+/**
+ * @return Sampling frequency of the processing chain [Hz].
+ */
+static unsigned int ProcessingRate() {
+#if AUDIO_CONFIG_RESAMPLING
+    return AUDIO_CONFIG_PROCESSING_RATE;
+#else
+    return murasaki::platform.sample_rate->Get();
+#endif
+}
+
+/* ------------------ User Functions -------------------------- */
+/**
+ * @brief Switch the audio block length and the sampling frequency by the user button.
+ * @details
+ * Called periodically from ExecPlatform(), every 50mS. A short push selects the next block length
+ * at the release. A long push selects the next sampling frequency after AUDIO_LONG_PUSH_COUNT polls.
+ * The audio task applies the change at the next block boundary.
+ */
+static void CheckUserButton() {
+    // Ignore the button held from the reset, until it is released.
+    static bool is_armed = false;
+    // Number of the polls while the button is pushed.
+    static unsigned int count = 0;
+
+    if (Board::IsUserButtonPressed()) {
+        if (is_armed && ++count == AUDIO_LONG_PUSH_COUNT)
+            RequestNextSampleRate();
+    }
+    else {
+        if (is_armed && count != 0 && count < AUDIO_LONG_PUSH_COUNT)
+            RequestNextBlockLength();
+        is_armed = true;
+        count = 0;
+    }
+}
+
+/**
+ * @brief Request the next block length in the order of low latency, default and high efficiency.
+ */
+static void RequestNextBlockLength() {
+    unsigned int length;
+    switch (murasaki::platform.audio_block->Get()) {
+        case audio::kLowLatencyBlockLength:
+            length = AUDIO_CHANNEL_LEN;
+            break;
+        case AUDIO_CHANNEL_LEN:
+            length = audio::kHighEfficiencyBlockLength;
+            break;
+        default:
+            length = audio::kLowLatencyBlockLength;
+            break;
+    }
+    murasaki::platform.audio_block->Request(length);
+    murasaki::debugger->Printf("Audio block length : %u samples\n", length);
+}
+
+/**
+ * @brief Request the next sampling frequency in the order of 48kHz, 96kHz and 44.1kHz.
+ */
+static void RequestNextSampleRate() {
+    unsigned int rate;
+    switch (murasaki::platform.sample_rate->Get()) {
+        case audio::kSampleRate48k:
+            rate = audio::kSampleRate96k;
+            break;
+        case audio::kSampleRate96k:
+            rate = audio::kSampleRate44k;
+            break;
+        default:
+            rate = audio::kSampleRate48k;
+            break;
+    }
+    if (murasaki::platform.sample_rate->Request(rate))
+        murasaki::debugger->Printf("Sample rate : %u Hz requested\n", rate);
+    else
+        murasaki::debugger->Printf("Sample rate : fixed by AUDIO_CONFIG_RESAMPLING\n");
+}
+
+/**
+ * @brief Follow the change of the sampling frequency by the audio task.
+ * @details
+ * Called periodically from ExecPlatform(). When the audio task has switched the sampling frequency,
+ * design the equalizer and the FIR filter for the new frequency, and print the time of the switch. The time is from
+ * the stop of the audio to the start of the new audio framework.
+ */
+static void CheckSampleRateSwitch() {
+    static unsigned int last_switches = 0;
+
+    const unsigned int switches = murasaki::platform.sample_rate->Switches();
+    if (switches == last_switches)
+        return;
+    last_switches = switches;
+
+    SetEqualizer();
+    SetFirFilter();
+
+    const uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    murasaki::debugger->Printf("Sample rate : %u Hz, switched in %lu uS, max %lu uS\n",
+                               murasaki::platform.sample_rate->Get(),
+                               static_cast<unsigned long>(murasaki::platform.sample_rate->SwitchTime() / cycles_per_us),
+                               static_cast<unsigned long>(murasaki::platform.sample_rate->MaxSwitchTime() / cycles_per_us));
+}
+
+/**
+ * @brief Print the CPU load of the audio task to the console.
+ * @details
+ * Called periodically from ExecPlatform(). The load is shown as the ratio of the processing cycles
+ * against the cycles of the block period. The statistics are cleared at each call. Then, each print
+ * shows the load since the last print.
+ *
+ * The histogram shows the number of the blocks in each 10% of the block period.
+ * The last column counts the blocks exceeding the period. That is, the blocks which may drop samples.
+ */
+static void PrintLoadStatistics() {
+    audio::LoadStatistics stats;
+
+    murasaki::platform.load_meter->Read(&stats, true);
+    if (stats.blocks == 0)
+        return;
+
+    const unsigned int min = stats.PerMille(stats.min);
+    const unsigned int mean = stats.PerMille(stats.Mean());
+    const unsigned int max = stats.PerMille(stats.max);
+    murasaki::debugger->Printf("CPU load : min %u.%u%%, mean %u.%u%%, max %u.%u%% of %lu cycles, %lu blocks\n",
+                               min / 10, min % 10,
+                               mean / 10, mean % 10,
+                               max / 10, max % 10,
+                               static_cast<unsigned long>(stats.budget),
+                               static_cast<unsigned long>(stats.blocks));
+    murasaki::debugger->Printf("Histogram : %lu %lu %lu %lu %lu %lu %lu %lu %lu %lu | %lu\n",
+                               static_cast<unsigned long>(stats.histogram[0]),
+                               static_cast<unsigned long>(stats.histogram[1]),
+                               static_cast<unsigned long>(stats.histogram[2]),
+                               static_cast<unsigned long>(stats.histogram[3]),
+                               static_cast<unsigned long>(stats.histogram[4]),
+                               static_cast<unsigned long>(stats.histogram[5]),
+                               static_cast<unsigned long>(stats.histogram[6]),
+                               static_cast<unsigned long>(stats.histogram[7]),
+                               static_cast<unsigned long>(stats.histogram[8]),
+                               static_cast<unsigned long>(stats.histogram[9]),
+                               static_cast<unsigned long>(stats.histogram[10]));
+}
+
+#if AUDIO_CONFIG_ANALYSIS
+/**
+ * @brief Print the CPU load of the analysis task and the latest spectrum to the console.
+ * @details
+ * Called periodically from ExecPlatform(). The load of the analysis task includes the time preempted
+ * by the audio task. The worst case of the audio task itself is shown by PrintLoadStatistics().
+ *
+ * The dropped blocks were not analyzed, because the analysis task was late by AUDIO_BACKGROUND_SLOTS blocks.
+ */
+static void PrintAnalysisStatistics() {
+    audio::LoadStatistics stats;
+
+    murasaki::platform.analysis_meter->Read(&stats, true);
+    if (stats.blocks != 0) {
+        const unsigned int mean = stats.PerMille(stats.Mean());
+        const unsigned int max = stats.PerMille(stats.max);
+        murasaki::debugger->Printf("Analysis load : mean %u.%u%%, max %u.%u%%, %lu blocks processed, %lu dropped\n",
+                                   mean / 10, mean % 10,
+                                   max / 10, max % 10,
+                                   static_cast<unsigned long>(murasaki::platform.analysis->Processed()),
+                                   static_cast<unsigned long>(murasaki::platform.analysis->Dropped()));
+    }
+#if AUDIO_CONFIG_BACKGROUND_CONVOLUTION
+    murasaki::debugger->Printf("Background convolution : %lu blocks processed, %lu dropped, %lu late\n",
+                               static_cast<unsigned long>(murasaki::platform.background_convolver->Processed()),
+                               static_cast<unsigned long>(murasaki::platform.background_convolver->Dropped()),
+                               static_cast<unsigned long>(murasaki::platform.background_convolver->Late()));
+#endif
+
+    audio::SpectrumResult result;
+    if (murasaki::platform.spectrum->Read(&result) && result.frames != 0)
+        murasaki::debugger->Printf("Spectrum : peak %u Hz %d dBFS, RMS %d dBFS, %u frames\n",
+                                   result.peak_bin * ProcessingRate() / AUDIO_ANALYSIS_SIZE,
+                                   static_cast<int>(result.peak_level),
+                                   static_cast<int>(result.rms_level),
+                                   result.frames);
+}
+#endif
+
+#if ! AUDIO_CIRCULAR_DMA
+// DMA callbacks set by HAL. Called from the xrun hooks.
+static void (*hal_tx_half_callback)(DMA_HandleTypeDef *hdma);
+static void (*hal_tx_full_callback)(DMA_HandleTypeDef *hdma);
+static void (*hal_rx_half_callback)(DMA_HandleTypeDef *hdma);
+static void (*hal_rx_full_callback)(DMA_HandleTypeDef *hdma);
+
+// Count the transfer, then pass it to HAL.
+static void TxHalfTransferHook(DMA_HandleTypeDef *hdma) {
+    murasaki::platform.xrun->NotifyTxTransfer();
+    hal_tx_half_callback(hdma);
+}
+
+static void TxFullTransferHook(DMA_HandleTypeDef *hdma) {
+    murasaki::platform.xrun->NotifyTxTransfer();
+    hal_tx_full_callback(hdma);
+}
+
+// The RX interrupt is the start of the latency of the received block.
+static void RxHalfTransferHook(DMA_HandleTypeDef *hdma) {
+    murasaki::platform.latency->NotifyInterrupt(murasaki::GetCycleCounter());
+    AUDIO_TRACE(murasaki::platform.trace, "RX DMA half");
+    murasaki::platform.xrun->NotifyRxTransfer();
+    hal_rx_half_callback(hdma);
+}
+
+static void RxFullTransferHook(DMA_HandleTypeDef *hdma) {
+    murasaki::platform.latency->NotifyInterrupt(murasaki::GetCycleCounter());
+    AUDIO_TRACE(murasaki::platform.trace, "RX DMA full");
+    murasaki::platform.xrun->NotifyRxTransfer();
+    hal_rx_full_callback(hdma);
+}
+
+/**
+ * @brief Chain the xrun hooks to the DMA callbacks of the audio port.
+ * @param tx_dma DMA handle of the TX.
+ * @param rx_dma DMA handle of the RX.
+ * @details
+ * The half and full transfer callbacks of the circular DMA are replaced by the hooks. Each hook
+ * counts a block transfer for @ref audio::XrunMonitor, and calls the original callback of HAL.
+ * The RX hooks also mark the interrupt for @ref audio::LatencyMeter.
+ *
+ * Called each time the DMA is started, because HAL sets its callbacks at the start.
+ */
+static void InstallXrunHooks(DMA_HandleTypeDef *tx_dma, DMA_HandleTypeDef *rx_dma) {
+    MURASAKI_ASSERT(nullptr != tx_dma)
+    MURASAKI_ASSERT(nullptr != rx_dma)
+
+    // Skip if already hooked. Otherwise, the hook calls itself.
+    if (tx_dma->XferHalfCpltCallback != &TxHalfTransferHook) {
+        hal_tx_half_callback = tx_dma->XferHalfCpltCallback;
+        hal_tx_full_callback = tx_dma->XferCpltCallback;
+        // The original callbacks must be stored before the interrupt calls the hook.
+        std::atomic_signal_fence(std::memory_order_release);
+        tx_dma->XferHalfCpltCallback = &TxHalfTransferHook;
+        tx_dma->XferCpltCallback = &TxFullTransferHook;
+    }
+    if (rx_dma->XferHalfCpltCallback != &RxHalfTransferHook) {
+        hal_rx_half_callback = rx_dma->XferHalfCpltCallback;
+        hal_rx_full_callback = rx_dma->XferCpltCallback;
+        std::atomic_signal_fence(std::memory_order_release);
+        rx_dma->XferHalfCpltCallback = &RxHalfTransferHook;
+        rx_dma->XferCpltCallback = &RxFullTransferHook;
+    }
+}
+#else
+// The TX runs by the same clock as the RX. In the interrupt audio mode, nothing to do at its interrupts.
+static void TxTransferInterrupt(DMA_HandleTypeDef *hdma) {
+    (void) hdma;
+#if ! AUDIO_CONFIG_INTERRUPT_AUDIO
+    murasaki::platform.xrun->NotifyTxTransfer();
+#endif
+}
+
+// Process the received half, and write the processed block into the same half of the TX.
+// In the Q31 processing of the audio task, hand the received half to the audio task.
+static void RxHalfTransferInterrupt(DMA_HandleTypeDef *hdma) {
+    murasaki::platform.latency->NotifyInterrupt(murasaki::GetCycleCounter());
+    AUDIO_TRACE(murasaki::platform.trace, "RX DMA half");
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    murasaki::platform.interrupt_audio->OnHalfTransfer();
+#else
+    murasaki::platform.xrun->NotifyRxTransfer();
+    murasaki::platform.q31_exchanger->OnHalfTransfer();
+#endif
+}
+
+static void RxFullTransferInterrupt(DMA_HandleTypeDef *hdma) {
+    murasaki::platform.latency->NotifyInterrupt(murasaki::GetCycleCounter());
+    AUDIO_TRACE(murasaki::platform.trace, "RX DMA full");
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    murasaki::platform.interrupt_audio->OnFullTransfer();
+#else
+    murasaki::platform.xrun->NotifyRxTransfer();
+    murasaki::platform.q31_exchanger->OnFullTransfer();
+#endif
+}
+
+/**
+ * @brief Replace the DMA callbacks of the audio port by the audio::InterruptAudio or the audio::Q31BlockExchanger.
+ * @param tx_dma DMA handle of the TX.
+ * @param rx_dma DMA handle of the RX.
+ * @details
+ * HAL is not called. The error callback of HAL is left.
+ *
+ * Called each time the DMA is started, with the interrupt disabled.
+ */
+static void InstallCircularDmaHooks(DMA_HandleTypeDef *tx_dma, DMA_HandleTypeDef *rx_dma) {
+    MURASAKI_ASSERT(nullptr != tx_dma)
+    MURASAKI_ASSERT(nullptr != rx_dma)
+
+    tx_dma->XferHalfCpltCallback = &TxTransferInterrupt;
+    tx_dma->XferCpltCallback = &TxTransferInterrupt;
+    rx_dma->XferHalfCpltCallback = &RxHalfTransferInterrupt;
+    rx_dma->XferCpltCallback = &RxFullTransferInterrupt;
+}
+#endif
+
+/**
+ * @brief Print the blocks missed by the audio task to the console.
+ * @details
+ * Called periodically from ExecPlatform(). Print only when a new xrun is detected.
+ */
+static void PrintXrunStatistics() {
+    static uint32_t last_events = 0;
+
+    const uint32_t events = murasaki::platform.xrun->GetXrunEvents();
+    if (events == last_events)
+        return;
+    last_events = events;
+
+    murasaki::debugger->Printf("Xrun : %lu events. Missed %lu TX blocks, %lu RX blocks since boot\n",
+                               static_cast<unsigned long>(events),
+                               static_cast<unsigned long>(murasaki::platform.xrun->GetMissedTxBlocks()),
+                               static_cast<unsigned long>(murasaki::platform.xrun->GetMissedRxBlocks()));
+}
+
+/**
+ * @brief Print the messages of the audio task and the interrupts to the console.
+ * @details
+ * Called periodically from ExecPlatform(), every 50mS. The messages were copied into audio::DebugLog
+ * without formatting. Then, they are formatted here, at the priority of ExecPlatform(), and
+ * transmitted by murasaki::debugger. The time is the cycle counter in uS. It wraps around.
+ */
+static void PrintLog() {
+    static uint32_t last_dropped = 0;
+
+    const uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    audio::LogEntry entry;
+    char text[96];
+    while (murasaki::platform.log->Read(&entry)) {
+        entry.Format(text, sizeof(text));
+        murasaki::debugger->Printf("[%lu uS] %s\n", static_cast<unsigned long>(entry.timestamp / cycles_per_us), text);
+    }
+
+    const uint32_t dropped = murasaki::platform.log->Dropped();
+    if (dropped == last_dropped)
+        return;
+    last_dropped = dropped;
+    murasaki::debugger->Printf("Log : %lu messages dropped since boot\n", static_cast<unsigned long>(dropped));
+}
+
+#if AUDIO_CONFIG_TRACE
+/**
+ * @brief Print the location of the trace in the RAM to the console.
+ * @details
+ * Called once from ExecPlatform(). Dump the records by the debugger, and decode them on the host by
+ * the format strings in the ELF file :
+ * @code
+ * (gdb) dump binary memory trace.bin <address> <address + size>
+ * $ tracedecode -e program.elf -t trace.bin -c <SystemCoreClock>
+ * @endcode
+ */
+static void PrintTraceLocation() {
+    const audio::TraceRecord *records = murasaki::platform.trace->Records();
+    murasaki::debugger->Printf("Trace : %u records at 0x%08lx, %u bytes, %lu Hz cycle counter\n",
+                               audio::AudioTrace::Length(),
+                               static_cast<unsigned long>(reinterpret_cast<uintptr_t>(records)),
+                               static_cast<unsigned int>(audio::AudioTrace::Length() * sizeof(audio::TraceRecord)),
+                               static_cast<unsigned long>(SystemCoreClock));
+}
+#endif
+
+/**
+ * @brief Print the latency from the DMA interrupt of the received block to the console.
+ * @details
+ * Called periodically from ExecPlatform(). The response is the time to the start of the processing.
+ * In the task mode, it is the scheduler latency of the audio task. In the interrupt audio mode, it is the
+ * dispatch in the interrupt handler. The jitter is max - min of the response.
+ *
+ * The completion is the time to the end of the processing. A completion over the block period
+ * means the block was late to the transmission.
+ */
+static void PrintLatencyStatistics() {
+    audio::LoadStatistics response;
+    audio::LoadStatistics completion;
+
+    murasaki::platform.latency->Read(&response, &completion, true);
+    if (response.blocks == 0 || completion.blocks == 0)
+        return;
+
+    const uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    murasaki::debugger->Printf("Latency : response min %lu, max %lu, jitter %lu cycles. Completion mean %lu uS, max %lu uS, %lu late\n",
+                               static_cast<unsigned long>(response.min),
+                               static_cast<unsigned long>(response.max),
+                               static_cast<unsigned long>(response.max - response.min),
+                               static_cast<unsigned long>(completion.Mean() / cycles_per_us),
+                               static_cast<unsigned long>(completion.max / cycles_per_us),
+                               static_cast<unsigned long>(completion.histogram[audio::kLoadHistogramBins - 1]));
+}
+
+/**
+ * @brief Set the response of the parametric equalizer.
+ * @details
+ * Called from ExecPlatform(), at the start and after the change of the sampling frequency. Edit the table to change the response. Up to audio::kMaxBiquadStages bands.
+ * The audio task takes the new coefficients at the next block.
+ */
+static void SetEqualizer() {
+    struct Band {
+        audio::BiquadType type;
+        float frequency;    // [Hz]
+        float gain;         // [dB]
+        float q;
+    };
+    static const Band bands[] = {
+            { audio::kbtLowShelf, 100.0f, 3.0f, 0.707f },
+            { audio::kbtPeaking, 3000.0f, -2.0f, 1.0f },
+            { audio::kbtHighShelf, 10000.0f, 2.0f, 0.707f },
+    };
+    const unsigned int stages = sizeof(bands) / sizeof(bands[0]);
+
+    audio::BiquadCoefficients coefficients[stages];
+    for (unsigned int i = 0; i < stages; i++)
+        coefficients[i] = audio::DesignBiquad(
+                                              bands[i].type,
+                                              ProcessingRate(),
+                                              bands[i].frequency,
+                                              bands[i].gain,
+                                              bands[i].q);
+
+    // Wait until the audio task takes the previous coefficients, if any.
+    while (!murasaki::platform.equalizer->SetCoefficients(coefficients, stages))
+        murasaki::Sleep(1);
+#if AUDIO_CONFIG_Q31_PROCESSING
+    while (!murasaki::platform.q31_equalizer->SetCoefficients(coefficients, stages))
+        murasaki::Sleep(1);
+#endif
+}
+
+/**
+ * @brief Set the coefficients of the FIR filter.
+ * @details
+ * Called from ExecPlatform(), at the start and after the change of the sampling frequency.
+ * The audio task takes the new coefficients at the next block. The filter is a linear phase low pass.
+ * The delay is (AUDIO_FIR_TAPS - 1) / 2 samples.
+ */
+static void SetFirFilter() {
+    static float coefficients[AUDIO_FIR_TAPS];
+
+    audio::DesignFirLowPass(coefficients, AUDIO_FIR_TAPS, static_cast<float>(AUDIO_FIR_CUTOFF) / ProcessingRate());
+    // Wait until the audio task takes the previous coefficients, if any.
+    while (!murasaki::platform.fir->SetCoefficients(coefficients))
+        murasaki::Sleep(1);
+}
+
+/**
+ * @brief Set the compressor and the limiter.
+ * @details
+ * Called from ExecPlatform(). The parameters are sent through the parameter queue, and the audio task
+ * applies them at the next block. Then, this function can be called at any time.
+ * The limiter keeps the output under -1dBFS. The delay is AUDIO_DYNAMICS_LOOKAHEAD samples.
+ */
+static void SetDynamics() {
+    static const audio::Parameter parameters[] = {
+            { kpiCompressorThreshold, -18.0f },
+            { kpiCompressorRatio, 3.0f },
+            { kpiCompressorAttack, 0.005f },
+            { kpiCompressorRelease, 0.15f },
+            { kpiCompressorMakeup, 0.0f },
+            { kpiLimiterCeiling, -1.0f },
+            { kpiLimiterRelease, 0.05f },
+    };
+
+    // Wait until the audio task makes a room in the queue, if full.
+    for (const audio::Parameter &parameter : parameters)
+        while (!SetParameter(static_cast<ParameterId>(parameter.id), parameter.value))
+            murasaki::Sleep(1);
+}
+
+/**
+ * @brief Send a parameter change to the audio task.
+ * @param id Parameter to change.
+ * @param value New value.
+ * @return false if the queue is full. Retry later.
+ * @details
+ * Called from a task other than the audio task. Never blocks. The audio task applies the change
+ * at the next block.
+ */
+static bool SetParameter(ParameterId id, float value) {
+    const audio::Parameter parameter = { static_cast<unsigned int>(id), value };
+    return murasaki::platform.parameters->Push(parameter);
+}
+
+/**
+ * @brief Apply the parameter changes from the control task.
+ * @details
+ * Called from the audio task at the block boundary. All the queued changes are applied before
+ * the block. The compressor and the limiter are set once per block at most. The output level moves
+ * to the new value by the ramp of AUDIO_SMOOTHING_LENGTH samples.
+ */
+static void ApplyParameters() {
+    // Current values. Same as the initial values of the audio::DynamicsProcessor and audio::SmoothedGain.
+    static float values[kpiNumParameters] = { 0.0f, 1.0f, 0.005f, 0.1f, 0.0f, 0.0f, 0.05f, 0.0f };
+    bool is_compressor_changed = false;
+    bool is_limiter_changed = false;
+    bool is_level_changed = false;
+
+    audio::Parameter parameter;
+    while (murasaki::platform.parameters->Pop(&parameter)) {
+        if (parameter.id >= kpiNumParameters)
+            continue;
+        values[parameter.id] = parameter.value;
+        if (parameter.id < kpiLimiterCeiling)
+            is_compressor_changed = true;
+        else if (parameter.id < kpiOutputLevel)
+            is_limiter_changed = true;
+        else
+            is_level_changed = true;
+    }
+
+    if (is_compressor_changed)
+        murasaki::platform.dynamics->SetCompressor(
+                                                   values[kpiCompressorThreshold],
+                                                   values[kpiCompressorRatio],
+                                                   values[kpiCompressorAttack],
+                                                   values[kpiCompressorRelease],
+                                                   values[kpiCompressorMakeup]);
+    if (is_limiter_changed)
+        murasaki::platform.dynamics->SetLimiter(
+                                                values[kpiLimiterCeiling],
+                                                values[kpiLimiterRelease]);
+    if (is_level_changed) {
+        murasaki::platform.volume->SetLevel(values[kpiOutputLevel]);
+#if AUDIO_CONFIG_Q31_PROCESSING
+        murasaki::platform.q31_volume->SetLevel(values[kpiOutputLevel]);
+#endif
+    }
+}
+
+#if AUDIO_CONFIG_COHERENCY_BENCHMARK
+/**
+ * @brief Print the cost of the each way of the DMA cache coherency to the console.
+ * @details
+ * Called once from ExecPlatform(), before the audio starts. The cost is the cycles of the CPU
+ * to write a TX block and read a RX block, including the cache maintenance.
+ * The buffers have the length of AUDIO_CHANNEL_LEN.
+ */
+static void RunCoherencyBenchmark() {
+    static int32_t cached_tx[4 * AUDIO_CHANNEL_LEN] __attribute__((aligned(32)));
+    static int32_t cached_rx[4 * AUDIO_CHANNEL_LEN] __attribute__((aligned(32)));
+    static int32_t non_cacheable_tx[4 * AUDIO_CHANNEL_LEN] AUDIO_NOCACHE_BSS;
+    static int32_t non_cacheable_rx[4 * AUDIO_CHANNEL_LEN] AUDIO_NOCACHE_BSS;
+    static int32_t tcm_tx[4 * AUDIO_CHANNEL_LEN] AUDIO_DTCM_BSS;
+    static int32_t tcm_rx[4 * AUDIO_CHANNEL_LEN] AUDIO_DTCM_BSS;
+
+    audio::CoherencyBenchmark benchmark(AUDIO_CHANNEL_LEN, &murasaki::GetCycleCounter);
+    const audio::CoherencyCost cost = benchmark.Run(
+                                                    { cached_tx, cached_rx },
+                                                    { non_cacheable_tx, non_cacheable_rx },
+                                                    { tcm_tx, tcm_rx },
+                                                    64); /* blocks per way */
+
+    murasaki::debugger->Printf("DMA coherency : %u samples per block, cycles per block\n", AUDIO_CHANNEL_LEN);
+    murasaki::debugger->Printf("  whole buffer clean/invalidate : %lu\n", static_cast<unsigned long>(cost.whole_buffer));
+    murasaki::debugger->Printf("  MPU non-cacheable region      : %lu\n", static_cast<unsigned long>(cost.non_cacheable));
+    murasaki::debugger->Printf("  DTCM                          : %lu\n", static_cast<unsigned long>(cost.tcm));
+}
+#endif
+
+#if ! AUDIO_CONFIG_Q31_PROCESSING
+/**
+ * @brief Process a received block in place.
+ * @param block Received block. Transmitted after the processing.
+ * @details
+ * Called from the audio task after the block exchange, or from the DMA interrupt in the interrupt audio mode.
+ */
+static void ProcessBlock(const audio::StereoBlock<float> &block) {
+    // Start measuring the processing time of this block.
+    const uint32_t begin = murasaki::GetCycleCounter();
+    murasaki::platform.latency->Begin(begin);
+    murasaki::platform.load_meter->Begin(begin);
+    AUDIO_TRACE(murasaki::platform.trace, "Block begin : %u samples", block.Length());
+
+    // Apply the parameter changes from the control task, before processing the block.
+    ApplyParameters();
+
+#if AUDIO_CONFIG_RESAMPLING
+    // Convert to the processing rate. The length of the converted block varies.
+    const audio::StereoBlock<float> processing = murasaki::platform.resampler->ToProcessingRate(block);
+#else
+    // Process the received block in place.
+    const audio::StereoBlock<float> &processing = block;
+#endif
+    // Equalize, filter, add the reverberation, compress and limit, and set the volume.
+    // Called by the final type, to inline the chain into this function in the ITCM.
+    static_cast<ProcessingChain*>(murasaki::platform.chain)->Process(processing);
+#if AUDIO_CONFIG_ANALYSIS
+    // Hand the output to the analysis task, and wake it up. It runs after this task sleeps,
+    // or after the DMA interrupt returns.
+    murasaki::platform.analysis->Process(processing);
+#if AUDIO_CONFIG_INTERRUPT_AUDIO
+    murasaki::platform.analysis_request->GiveFromIsr();
+#else
+    murasaki::platform.analysis_request->Give();
+#endif
+#endif
+#if AUDIO_CONFIG_RESAMPLING
+    // Convert back to the CODEC rate, into the received block.
+    murasaki::platform.resampler->FromProcessingRate(processing, block);
+#endif
+
+    // Blink status.
+    murasaki::platform.led_st0->Toggle();
+    murasaki::platform.led_st1->Toggle();
+
+    // End of the processing.
+    const uint32_t end = murasaki::GetCycleCounter();
+    murasaki::platform.load_meter->End(end);
+    murasaki::platform.latency->End(end);
+    AUDIO_TRACE(murasaki::platform.trace, "Block end : %lu cycles", static_cast<unsigned long>(end - begin));
+}
+
+#else
+/**
+ * @brief Process a received Q31 block in place.
+ * @param block Received block. Transmitted after the processing.
+ * @details
+ * Called instead of ProcessBlock() by AUDIO_CONFIG_Q31_PROCESSING, from the audio task after the Q31 block
+ * exchange, or from the DMA interrupt in the interrupt audio mode. The samples are the DMA words, without
+ * the conversion to the float. The equalizer and the output volume are applied in Q31. The FIR filter,
+ * the convolution, the dynamics and the analysis of the float chain are not run.
+ */
+static void ProcessBlockQ31(const audio::StereoBlock<audio::q31_t> &block) {
+    // Start measuring the processing time of this block.
+    const uint32_t begin = murasaki::GetCycleCounter();
+    murasaki::platform.latency->Begin(begin);
+    murasaki::platform.load_meter->Begin(begin);
+    AUDIO_TRACE(murasaki::platform.trace, "Q31 block begin : %u samples", block.Length());
+
+    // Apply the parameter changes from the control task, before processing the block.
+    ApplyParameters();
+
+    // Equalize, and set the volume with saturation.
+    // Called by the final type, to inline the chain into this function in the ITCM.
+    static_cast<ProcessingChainQ31*>(murasaki::platform.q31_chain)->Process(block);
+
+    // Blink status.
+    murasaki::platform.led_st0->Toggle();
+    murasaki::platform.led_st1->Toggle();
+
+    // End of the processing.
+    const uint32_t end = murasaki::GetCycleCounter();
+    murasaki::platform.load_meter->End(end);
+    murasaki::platform.latency->End(end);
+    AUDIO_TRACE(murasaki::platform.trace, "Q31 block end : %lu cycles", static_cast<unsigned long>(end - begin));
+}
+#endif
+
+#if ! AUDIO_CONFIG_INTERRUPT_AUDIO
+#if AUDIO_CONFIG_Q31_PROCESSING
+/**
+ * @brief Audio task of the Q31 processing.
+ * @param ptr Pointer to the parameter block
+ * @details
+ * Exchange the Q31 blocks with the circular DMA by audio::Q31BlockExchanger, and process them
+ * by ProcessBlockQ31(). The DMA is started and stopped by this task, instead of murasaki::DuplexAudio.
+ */
+void TaskBodyFunction(const void *ptr) {
+    // Start codec activity.
+    StartCodec();
+
+    // Tell codec is ready.
+    murasaki::platform.codec_ready->Release();
+
+    // Initiate the LED on the AKSAHI 02 board
+    murasaki::platform.led_st0->Clear();
+    murasaki::platform.led_st1->Set();
+
+    // Receive the blocks from the DMA interrupt. Before the DMA is started.
+    audio::Q31BlockExchanger *const exchanger = murasaki::platform.q31_exchanger;
+    exchanger->Attach();
+    CheckAudioDmaPriority();
+    StartCircularAudio();
+
+    while (true)  // Talk Through
+    {
+        // Take the new baseline of the DMA transfers.
+        murasaki::platform.xrun->Restart();
+
+        // Run until the change of the block length or the sampling frequency is requested.
+        while (!murasaki::platform.audio_block->IsChangeRequested() && !murasaki::platform.sample_rate->IsChangeRequested())
+        {
+            // Wait the next half of the DMA. Then, the block processed in the last iteration is
+            // written to the TX buffer, and the new block is taken from the RX buffer.
+            audio::StereoBlock<audio::q31_t> block = exchanger->Exchange();
+
+            // Count the blocks transferred by DMA while the audio task was late.
+            if (murasaki::platform.xrun->Check())
+                AUDIO_LOG(
+                          murasaki::platform.log,
+                          murasaki::GetCycleCounter(),
+                          "Xrun : missed TX %lu, RX %lu blocks since boot",
+                          static_cast<unsigned long>(murasaki::platform.xrun->GetMissedTxBlocks()),
+                          static_cast<unsigned long>(murasaki::platform.xrun->GetMissedRxBlocks()));
+
+            // Equalize and set the volume in place.
+            ProcessBlockQ31(block);
+        }
+
+        // Stop the audio, and restart it with the new block length and sampling frequency.
+        const uint32_t switch_start = murasaki::GetCycleCounter();
+        Board::StopAudioPort();
+        const bool is_rate_changed = murasaki::platform.sample_rate->IsChangeRequested();
+        if (is_rate_changed)
+            ChangeSampleRate();
+        StartCircularAudio();
+        if (is_rate_changed)
+            murasaki::platform.sample_rate->SetSwitchTime(murasaki::GetCycleCounter() - switch_start);
+    }
+}
+
+#else
+/**
+ * @brief Demonstration task.
+ * @param ptr Pointer to the parameter block
+ * @details
+ * Task body function as demonstration of the @ref murasaki::SimpleTask.
+ *
+ * Equalize, filter and compress the input audio, and output it.
+ */
+void TaskBodyFunction(const void *ptr) {
+    // Start codec activity.
+    StartCodec();
+
+    // Tell codec is ready.
+    murasaki::platform.codec_ready->Release();
+
+
+    // Initiate the LED on the AKSAHI 02 board
+    murasaki::platform.led_st0->Clear();
+    murasaki::platform.led_st1->Set();
+
+
+
+
+    while (true)  // Talk Through
+    {
+        {
+            // Audio sample buffers. The received block is processed in place,
+            // and then transmitted by the next exchange.
+            // The buffers are filled by zero to avoid the big noise at beginning.
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+            static float exchanger_buffer[audio::BlockExchanger::kNumBuffers * audio::kMaxBlockLength] AUDIO_BUFFER_SECTION;
+            audio::BlockExchanger exchanger(murasaki::platform.audio, murasaki::platform.audio_block->Get(), exchanger_buffer);
+#else
+            audio::BlockExchanger exchanger(murasaki::platform.audio, murasaki::platform.audio_block->Get());
+#endif
+
+            // Cycles available for a block.
+            const uint32_t budget = static_cast<uint32_t>(
+                    static_cast<uint64_t>(SystemCoreClock) * murasaki::platform.audio_block->Get() / murasaki::platform.sample_rate->Get());
+            murasaki::platform.load_meter->SetBudget(budget);
+            murasaki::platform.latency->SetBudget(budget);
+
+            // Take the new baseline of the DMA transfers.
+            murasaki::platform.xrun->Restart();
+            bool is_dma_hooked = false;
+
+            // Run until the change of the block length or the sampling frequency is requested.
+            while (!murasaki::platform.audio_block->IsChangeRequested() && !murasaki::platform.sample_rate->IsChangeRequested())
+            {
+                // Wait the end of current audio transmission & receive.
+                // Then, the block processed in the last iteration is transmitted,
+                // and the new block is received.
+                audio::StereoBlock<float> block = exchanger.Exchange();
+
+                // The DMA is started by the first exchange. Then, hook it.
+                if (!is_dma_hooked) {
+                    HookAudioDma();
+                    is_dma_hooked = true;
+                }
+                // Count the blocks transferred by DMA while the audio task was late.
+                // The time of the xrun is logged without formatting.
+                if (murasaki::platform.xrun->Check())
+                    AUDIO_LOG(
+                              murasaki::platform.log,
+                              murasaki::GetCycleCounter(),
+                              "Xrun : missed TX %lu, RX %lu blocks since boot",
+                              static_cast<unsigned long>(murasaki::platform.xrun->GetMissedTxBlocks()),
+                              static_cast<unsigned long>(murasaki::platform.xrun->GetMissedRxBlocks()));
+
+                // Equalize, filter, compress and limit the block in place.
+                ProcessBlock(block);
+            }
+        }
+
+        // Stop the audio, and restart it with the new block length and sampling frequency.
+        // The DMA buffers are re-allocated by the new audio framework.
+        const uint32_t switch_start = murasaki::GetCycleCounter();
+        Board::StopAudioPort();
+        const bool is_rate_changed = murasaki::platform.sample_rate->IsChangeRequested();
+        if (is_rate_changed)
+            ChangeSampleRate();
+        audio::Delete(murasaki::platform.audio);
+        murasaki::platform.audio = CreateDuplexAudio(murasaki::platform.audio_block->Apply());
+        AUDIO_ASSERT_ALLOCATED(murasaki::platform.audio)
+        if (is_rate_changed)
+            murasaki::platform.sample_rate->SetSwitchTime(murasaki::GetCycleCounter() - switch_start);
+    }
+}
+#endif
+#endif
+
+#if AUDIO_CONFIG_ANALYSIS
+/**
+ * @brief Analysis task.
+ * @param ptr Pointer to the parameter block
+ * @details
+ * Process the blocks handed by the audio task through audio::BackgroundStage. The priority is lower
+ * than the audio task. Then, the audio task preempts this task at each block, and this task uses
+ * the idle time of the CPU.
+ *
+ * The background convolution, if configured, is processed first, because the audio task needs its
+ * result at the next block.
+ */
+void AnalysisTaskBodyFunction(const void *ptr) {
+    unsigned int block_length = 0;
+    unsigned int sample_rate = 0;
+
+    // Receive the notification of the blocks. The blocks before here are processed at the first wake up.
+    murasaki::platform.analysis_request->Attach();
+
+    while (true) {
+        // Wait for the blocks from the audio task.
+        murasaki::platform.analysis_request->Wait();
+
+        // Cycles available for a block. Updated when the block length or the sampling frequency is changed.
+        if (block_length != murasaki::platform.audio_block->Get() || sample_rate != murasaki::platform.sample_rate->Get()) {
+            block_length = murasaki::platform.audio_block->Get();
+            sample_rate = murasaki::platform.sample_rate->Get();
+            murasaki::platform.analysis_meter->SetBudget(static_cast<uint32_t>(
+                    static_cast<uint64_t>(SystemCoreClock) * block_length / sample_rate));
+        }
+
+        murasaki::platform.analysis_meter->Begin(murasaki::GetCycleCounter());
+#if AUDIO_CONFIG_BACKGROUND_CONVOLUTION
+        while (murasaki::platform.background_convolver->Run())
+            ;
+#endif
+        while (murasaki::platform.analysis->Run())
+            ;
+        murasaki::platform.analysis_meter->End(murasaki::GetCycleCounter());
+    }
+}
+#endif
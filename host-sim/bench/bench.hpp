@@ -0,0 +1,67 @@
+/**
+ * @file bench.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Timing utilities of the host benchmarks.
+ * @details
+ * The benchmarks run a processing stage of the common/Inc on the host, to compare the
+ * variants of the algorithm before measuring on the target by the CPU load meter.
+ * The time is measured by the steady clock in nanoseconds. The minimum over the repetitions is
+ * taken as the result. It is free from the interrupts and the scheduling of the host.
+ */
+
+#ifndef HOST_SIM_BENCH_HPP_
+#define HOST_SIM_BENCH_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace hostsim {
+
+/**
+ * @brief Measure the shortest execution time of a function.
+ * @param function Function to measure. Called repeat times.
+ * @param repeat Number of the measurement.
+ * @return Shortest execution time [nS].
+ */
+template<typename F>
+double MeasureMin(F function, unsigned int repeat) {
+    double min = 1e300;
+    for (unsigned int i = 0; i < repeat; i++) {
+        const auto begin = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - begin).count();
+        if (ns < min)
+            min = ns;
+    }
+    return min;
+}
+
+/**
+ * @brief Deterministic white noise in [-0.5, 0.5).
+ * @param length Number of the samples.
+ * @param seed Seed of the generator.
+ */
+inline std::vector<float> Noise(unsigned int length, uint32_t seed = 1) {
+    std::vector<float> noise(length);
+    for (unsigned int i = 0; i < length; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        noise[i] = static_cast<float>(seed >> 8) / 16777216.0f - 0.5f;
+    }
+    return noise;
+}
+
+/**
+ * @brief Keep the result of the computation from the optimizer.
+ */
+inline void DoNotOptimize(const void *data) {
+    asm volatile("" : : "g"(data) : "memory");
+}
+
+} /* namespace hostsim */
+
+#endif /* HOST_SIM_BENCH_HPP_ */
@@ -0,0 +1,61 @@
+/**
+ * @file biquad.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::BiquadCascade.
+ * @details
+ * Process a stereo block by the cascade of 1 to kMaxBiquadStages stages, and print the time
+ * per sample per biquad. The block length is 32 to 512 samples.
+ *
+ * The result shows the scaling against the number of the stages and the block length.
+ * On the target, the per stage cost is measured by the "CPU load" line of the console, by changing
+ * the number of the bands in SetEqualizer().
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "bench.hpp"
+#include "biquad.hpp"
+
+int main() {
+    const unsigned int block_lengths[] = { 32, 128, 512 };
+    const unsigned int stage_counts[] = { 1, 2, 4, audio::kMaxBiquadStages };
+    const unsigned int kRepeat = 2000;
+
+    std::vector<audio::BiquadCoefficients> coefficients(audio::kMaxBiquadStages);
+    for (unsigned int i = 0; i < audio::kMaxBiquadStages; i++)
+        coefficients[i] = audio::DesignBiquad(audio::kbtPeaking, 48000.0f, 100.0f * (i + 1), 3.0f, 1.0f);
+
+    std::printf("biquad : nS per sample per biquad, stereo, TDF-II\n");
+    std::printf("%8s", "stages");
+    for (unsigned int length : block_lengths)
+        std::printf("%10u", length);
+    std::printf("   <- block length\n");
+
+    for (unsigned int stages : stage_counts) {
+        std::printf("%8u", stages);
+        for (unsigned int length : block_lengths) {
+            std::vector<float> left = hostsim::Noise(length, 1);
+            std::vector<float> right = hostsim::Noise(length, 2);
+            audio::StereoBlock<float> block;
+            block.left = audio::ChannelSpan<float>(left.data(), length);
+            block.right = audio::ChannelSpan<float>(right.data(), length);
+
+            audio::BiquadCascade cascade;
+            cascade.SetCoefficients(coefficients.data(), stages);
+            cascade.Process(block);    // Take the coefficients.
+
+            const double ns = hostsim::MeasureMin([&]() {
+                cascade.Process(block);
+                hostsim::DoNotOptimize(left.data());
+                hostsim::DoNotOptimize(right.data());
+            },
+                                                  kRepeat);
+            std::printf("%10.3f", ns / (2.0 * length * stages));
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
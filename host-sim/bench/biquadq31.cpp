@@ -0,0 +1,160 @@
+/**
+ * @file biquadq31.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::BiquadCascadeQ31.
+ * @details
+ * At first, the Q31 cascade is compared with audio::BiquadCascade on a sine through the peaking
+ * filters of the equalizer. The program fails if the error is not below -80dB of the output.
+ * The unity coefficients have to pass the samples bit by bit, and a full scale input to a gain of
+ * 2.0 has to saturate without the wrap around.
+ *
+ * Then, the time per sample per biquad is printed as like the biquad benchmark. On the host, the
+ * 64bit products are plain multiplications. On the Cortex-M4 / M7, they are SMLAL.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "bench.hpp"
+#include "biquad.hpp"
+#include "biquadq31.hpp"
+#include "q31.hpp"
+
+namespace {
+
+const float kSampleRate = 48000.0f;
+
+// Error of the Q31 cascade against the float cascade [dB]. Relative to the output power.
+double CompareWithFloat(const std::vector<audio::BiquadCoefficients> &coefficients) {
+    const unsigned int kLength = 128;
+    const unsigned int kBlocks = 100;
+
+    audio::BiquadCascade reference;
+    audio::BiquadCascadeQ31 cascade;
+    reference.SetCoefficients(coefficients.data(), coefficients.size());
+    cascade.SetCoefficients(coefficients.data(), coefficients.size());
+
+    std::vector<float> left(kLength), right(kLength);
+    std::vector<audio::q31_t> left_q31(kLength), right_q31(kLength);
+    audio::StereoBlock<float> block;
+    block.left = audio::ChannelSpan<float>(left.data(), kLength);
+    block.right = audio::ChannelSpan<float>(right.data(), kLength);
+    audio::StereoBlock<audio::q31_t> block_q31;
+    block_q31.left = audio::ChannelSpan<audio::q31_t>(left_q31.data(), kLength);
+    block_q31.right = audio::ChannelSpan<audio::q31_t>(right_q31.data(), kLength);
+
+    double signal = 0.0;
+    double error = 0.0;
+    unsigned int n = 0;
+    for (unsigned int b = 0; b < kBlocks; b++) {
+        for (unsigned int i = 0; i < kLength; i++, n++) {
+            const float x = 0.25f * std::sin(2.0f * 3.14159265f * 800.0f * n / kSampleRate);
+            left[i] = right[i] = x;
+            left_q31[i] = right_q31[i] = audio::FloatToQ31(x);
+        }
+        reference.Process(block);
+        cascade.Process(block_q31);
+        for (unsigned int i = 0; i < kLength; i++) {
+            const double y = left[i];
+            const double d = audio::Q31ToFloat(left_q31[i]) - y;
+            signal += y * y;
+            error += d * d;
+        }
+    }
+    return 10.0 * std::log10(error / signal);
+}
+
+// The unity stage passes the samples, and the gain of 2.0 saturates.
+bool CheckExact() {
+    const audio::BiquadCoefficients unity = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    const audio::BiquadCoefficients twice = { 2.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    const audio::q31_t samples[] = { INT32_MIN, INT32_MIN + 1, -12345, -1, 0, 1, 12345, INT32_MAX - 1, INT32_MAX };
+    const unsigned int length = sizeof(samples) / sizeof(samples[0]);
+
+    std::vector<audio::q31_t> left(samples, samples + length), right(samples, samples + length);
+    audio::StereoBlock<audio::q31_t> block;
+    block.left = audio::ChannelSpan<audio::q31_t>(left.data(), length);
+    block.right = audio::ChannelSpan<audio::q31_t>(right.data(), length);
+
+    audio::BiquadCascadeQ31 cascade;
+    cascade.SetCoefficients(&unity, 1);
+    cascade.Process(block);
+    for (unsigned int i = 0; i < length; i++)
+        if (left[i] != samples[i] || right[i] != samples[i]) {
+            std::printf("biquadq31 : unity FAILED at %d, got %d\n", static_cast<int>(samples[i]), static_cast<int>(left[i]));
+            return false;
+        }
+
+    audio::BiquadCascadeQ31 doubler;
+    doubler.SetCoefficients(&twice, 1);
+    doubler.Process(block);
+    for (unsigned int i = 0; i < length; i++) {
+        const int64_t expected = audio::SaturateQ31(2 * static_cast<int64_t>(samples[i]));
+        if (left[i] != expected) {
+            std::printf("biquadq31 : gain 2.0 FAILED at %d, got %d\n", static_cast<int>(samples[i]), static_cast<int>(left[i]));
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int block_lengths[] = { 32, 128, 512 };
+    const unsigned int stage_counts[] = { 1, 2, 4, audio::kMaxBiquadStages };
+    const unsigned int kRepeat = 2000;
+
+    std::vector<audio::BiquadCoefficients> coefficients(audio::kMaxBiquadStages);
+    for (unsigned int i = 0; i < audio::kMaxBiquadStages; i++)
+        coefficients[i] = audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 100.0f * (i + 1), 3.0f, 1.0f);
+
+    bool ok = CheckExact();
+    std::printf("biquadq31 : unity and saturation %s\n", ok ? "ok" : "FAILED");
+
+    const std::vector<audio::BiquadCoefficients> bands(coefficients.begin(), coefficients.begin() + 4);
+    const double error = CompareWithFloat(bands);
+    const bool is_close = error < -80.0;
+    std::printf("biquadq31 : error against the float cascade %.1f dB %s\n", error, is_close ? "ok" : "FAILED");
+    ok = ok && is_close;
+
+    std::printf("biquadq31 : nS per sample per biquad, stereo, DF-I, Q3.29 coefficients\n");
+    std::printf("%8s", "stages");
+    for (unsigned int length : block_lengths)
+        std::printf("%10u", length);
+    std::printf("   <- block length\n");
+
+    for (unsigned int stages : stage_counts) {
+        std::printf("%8u", stages);
+        for (unsigned int length : block_lengths) {
+            const std::vector<float> noise_left = hostsim::Noise(length, 1);
+            const std::vector<float> noise_right = hostsim::Noise(length, 2);
+            std::vector<audio::q31_t> left(length), right(length);
+            for (unsigned int i = 0; i < length; i++) {
+                left[i] = audio::FloatToQ31(0.5f * noise_left[i]);
+                right[i] = audio::FloatToQ31(0.5f * noise_right[i]);
+            }
+            audio::StereoBlock<audio::q31_t> block;
+            block.left = audio::ChannelSpan<audio::q31_t>(left.data(), length);
+            block.right = audio::ChannelSpan<audio::q31_t>(right.data(), length);
+
+            audio::BiquadCascadeQ31 cascade;
+            cascade.SetCoefficients(coefficients.data(), stages);
+            cascade.Process(block);    // Take the coefficients.
+
+            const double ns = hostsim::MeasureMin([&]() {
+                cascade.Process(block);
+                hostsim::DoNotOptimize(left.data());
+                hostsim::DoNotOptimize(right.data());
+            },
+                                                  kRepeat);
+            std::printf("%10.3f", ns / (2.0 * length * stages));
+        }
+        std::printf("\n");
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,297 @@
+/**
+ * @file blockfifo.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::BlockFifo and audio::BackgroundStage.
+ * @details
+ * At first, the following checks are done. The program fails if one of them fails.
+ * @li Lockstep : The background task runs after each block. The output must be the result of the
+ *     previous block exactly, without the late block.
+ * @li Threaded : The background task runs in another thread, without the synchronization. Each block
+ *     must be the result of the previous block exactly, or silent. The silent blocks must be counted as late.
+ * @li Spectrum : A sine is analyzed through kbmTap. The peak bin and the level must match.
+ *
+ * Then, the time of the realtime path per block is measured against the block length, with the stage
+ * in the audio task (inline), and with the stage in the background thread. The background thread runs
+ * between the blocks, as like the analysis task of lower priority on the target. The mean and the
+ * worst case are printed. The worst case of the inline analysis is the block at the end of the frame.
+ *
+ * On the target, the worst case of the audio task is the max of the "CPU load" lines of the console,
+ * and the load of the background task is the "Analysis load" lines.
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "backgroundstage.hpp"
+#include "bench.hpp"
+#include "partitionedconvolver.hpp"
+#include "spectrumanalyzer.hpp"
+
+namespace {
+
+const unsigned int kSlots = 4;
+const unsigned int kAnalysisSize = 1024;
+const unsigned int kPartitionSize = 32;
+const unsigned int kPartitions = 64;
+
+// Half of the input. The result is exact in the float.
+class HalfGain final : public audio::FloatProcessor {
+ public:
+    virtual void Process(const audio::StereoBlock<float> &block) {
+        for (unsigned int i = 0; i < block.Length(); i++) {
+            block.left[i] *= 0.5f;
+            block.right[i] *= 0.5f;
+        }
+    }
+};
+
+// Spectra of an exponentially decaying noise, and their storage.
+struct Ir {
+    std::vector<float> bins;
+    audio::IrSpectrum spectrum;
+};
+
+Ir MakeIr() {
+    Ir ir;
+    std::vector<float> taps = hostsim::Noise(kPartitionSize * kPartitions, 5);
+    for (unsigned int i = 0; i < taps.size(); i++)
+        taps[i] *= std::exp(-4.0f * i / taps.size());
+    ir.bins.resize(kPartitions * 2 * (kPartitionSize + 1));
+
+    const audio::Fft fft(2 * kPartitionSize);
+    std::vector<float> scratch(4 * 2 * kPartitionSize);
+    audio::ComputeIrSpectrum(fft, taps.data(), kPartitions, ir.bins.data(), scratch.data());
+    ir.spectrum = { kPartitionSize, kPartitions, ir.bins.data() };
+    return ir;
+}
+
+audio::StereoBlock<float> Block(std::vector<float> *left, std::vector<float> *right, unsigned int position, unsigned int length) {
+    audio::StereoBlock<float> block;
+    block.left = audio::ChannelSpan<float>(&(*left)[position], length);
+    block.right = audio::ChannelSpan<float>(&(*right)[position], length);
+    return block;
+}
+
+// Check the output of the kbmReplace stage with HalfGain. Return the number of the silent blocks, or -1 if wrong.
+int CheckReplaced(const std::vector<float> &input, const std::vector<float> &output, unsigned int length) {
+    int silent = 0;
+    for (unsigned int position = 0; position < output.size(); position += length) {
+        bool is_delayed = position >= length;
+        bool is_silent = true;
+        for (unsigned int i = position; i < position + length; i++) {
+            if (is_delayed && output[i] != 0.5f * input[i - length])
+                is_delayed = false;
+            if (output[i] != 0.0f)
+                is_silent = false;
+        }
+        if (is_silent)
+            silent++;
+        else if (!is_delayed)
+            return -1;
+    }
+    return silent;
+}
+
+// Run the kbmReplace stage over the noise. The worker is called after each block, or runs in a thread.
+bool CheckReplace(bool is_threaded) {
+    const unsigned int kLength = 128;
+    const unsigned int kBlocks = 2000;
+    const std::vector<float> input_left = hostsim::Noise(kLength * kBlocks, 1);
+    const std::vector<float> input_right = hostsim::Noise(kLength * kBlocks, 2);
+    std::vector<float> left(input_left);
+    std::vector<float> right(input_right);
+
+    HalfGain gain;
+    std::vector<float> storage(audio::BackgroundStage::StorageSize(kSlots, kLength));
+    audio::BackgroundStage stage(&gain, audio::kbmReplace, kSlots, kLength, storage.data());
+
+    std::atomic<bool> is_done(false);
+    std::thread worker;
+    if (is_threaded)
+        worker = std::thread([&]() {
+            while (!is_done.load()) {
+                if (!stage.Run())
+                    std::this_thread::yield();
+            }
+        });
+
+    for (unsigned int position = 0; position < left.size(); position += kLength) {
+        stage.Process(Block(&left, &right, position, kLength));
+        if (is_threaded)
+            std::this_thread::yield();
+        else
+            while (stage.Run())
+                ;
+    }
+
+    if (is_threaded) {
+        is_done.store(true);
+        worker.join();
+    }
+    while (stage.Run())
+        ;
+
+    const int silent_left = CheckReplaced(input_left, left, kLength);
+    const int silent_right = CheckReplaced(input_right, right, kLength);
+    // The first block is silent, and not late.
+    const bool is_ok = silent_left >= 1 && silent_left == silent_right && static_cast<uint32_t>(silent_left - 1) == stage.Late()
+            && stage.Processed() + stage.Dropped() == kBlocks && (is_threaded || (0 == stage.Late() && 0 == stage.Dropped()));
+    std::printf("blockfifo : %s replace, %u blocks processed, %u dropped, %u late %s\n", is_threaded ? "threaded" : "lockstep",
+                static_cast<unsigned int>(stage.Processed()), static_cast<unsigned int>(stage.Dropped()),
+                static_cast<unsigned int>(stage.Late()), is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Analyze a sine at a bin through the kbmTap stage. The block must be untouched.
+bool CheckSpectrum() {
+    const unsigned int kLength = 128;
+    const unsigned int kBin = 64;
+    const float kAmplitude = 0.5f;
+    const unsigned int kSamples = 8 * kAnalysisSize;
+    std::vector<float> left(kSamples);
+    std::vector<float> right(kSamples);
+    for (unsigned int i = 0; i < kSamples; i++)
+        left[i] = right[i] = kAmplitude * std::sin(2.0f * 3.14159265f * kBin * i / kAnalysisSize);
+    const std::vector<float> input(left);
+
+    std::vector<float> analyzer_storage(audio::SpectrumAnalyzer::StorageSize(kAnalysisSize));
+    audio::SpectrumAnalyzer analyzer(kAnalysisSize, analyzer_storage.data());
+    std::vector<float> storage(audio::BackgroundStage::StorageSize(kSlots, kLength));
+    audio::BackgroundStage stage(&analyzer, audio::kbmTap, kSlots, kLength, storage.data());
+    for (unsigned int position = 0; position < kSamples; position += kLength) {
+        stage.Process(Block(&left, &right, position, kLength));
+        while (stage.Run())
+            ;
+    }
+
+    audio::SpectrumResult result;
+    analyzer.Read(&result);
+    const float peak_expected = 20.0f * std::log10(kAmplitude);
+    const float rms_expected = peak_expected - 10.0f * std::log10(2.0f);
+    const bool is_ok = left == input && result.peak_bin == kBin && std::fabs(result.peak_level - peak_expected) < 0.2f
+            && std::fabs(result.rms_level - rms_expected) < 0.2f;
+    std::printf("blockfifo : spectrum bin %u, peak %.2f dBFS, RMS %.2f dBFS, %u frames %s\n", result.peak_bin, result.peak_level,
+                result.rms_level, result.frames, is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Time per block of the realtime path [nS].
+struct PathTime {
+    double mean;
+    double max;
+};
+
+// Process the noise by the blocks of length. The background thread runs the stage between the blocks.
+// The worst case is the min of the max of the runs, to remove the scheduling of the host.
+template<typename F>
+PathTime MeasurePath(unsigned int length, unsigned int blocks, F process, audio::BackgroundStage *stage) {
+    const unsigned int kRuns = 5;
+    std::vector<float> left = hostsim::Noise(length * blocks, 1);
+    std::vector<float> right = hostsim::Noise(length * blocks, 2);
+
+    std::atomic<bool> is_done(false);
+    std::atomic<uint32_t> pushed(0);
+    std::thread worker;
+    if (nullptr != stage)
+        worker = std::thread([&]() {
+            while (!is_done.load()) {
+                if (!stage->Run())
+                    std::this_thread::yield();
+            }
+        });
+
+    PathTime time = { 0.0, 1e300 };
+    for (unsigned int run = 0; run < kRuns; run++) {
+        double sum = 0.0;
+        double max = 0.0;
+        for (unsigned int position = 0; position < left.size(); position += length) {
+            const audio::StereoBlock<float> block = Block(&left, &right, position, length);
+            const auto begin = std::chrono::steady_clock::now();
+            process(block);
+            const auto end = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - begin).count();
+            sum += ns;
+            max = std::fmax(max, ns);
+
+            // Idle time of the audio task. The background thread finishes the block.
+            if (nullptr != stage) {
+                pushed.fetch_add(1);
+                while (stage->Processed() + stage->Dropped() != pushed.load())
+                    std::this_thread::yield();
+            }
+        }
+        time.mean = sum / blocks;
+        time.max = std::fmin(time.max, max);
+    }
+
+    if (nullptr != stage) {
+        is_done.store(true);
+        worker.join();
+    }
+    return time;
+}
+
+}  // namespace
+
+int main() {
+    bool is_passed = true;
+    is_passed = CheckReplace(false) && is_passed;
+    is_passed = CheckReplace(true) && is_passed;
+    is_passed = CheckSpectrum() && is_passed;
+
+    const Ir ir = MakeIr();
+    std::printf("blockfifo : realtime path per block [nS], %u point spectrum, %u taps convolution\n", kAnalysisSize,
+                kPartitionSize * kPartitions);
+    std::printf("%8s%14s%14s%14s%14s%14s%14s%14s%14s\n", "length", "spectrum", "worst", "tap", "worst", "convolver", "worst", "replace",
+                "worst");
+    const unsigned int lengths[] = { 32, 128, 512 };
+    for (unsigned int length : lengths) {
+        // Whole frames of the analysis.
+        const unsigned int blocks = 16 * kAnalysisSize / length;
+
+        std::vector<float> inline_analyzer_storage(audio::SpectrumAnalyzer::StorageSize(kAnalysisSize));
+        audio::SpectrumAnalyzer inline_analyzer(kAnalysisSize, inline_analyzer_storage.data());
+        const PathTime inline_analysis = MeasurePath(length, blocks, [&](const audio::StereoBlock<float> &block) {
+            inline_analyzer.Process(block);
+        },
+                                                     nullptr);
+
+        std::vector<float> analyzer_storage(audio::SpectrumAnalyzer::StorageSize(kAnalysisSize));
+        audio::SpectrumAnalyzer analyzer(kAnalysisSize, analyzer_storage.data());
+        std::vector<float> tap_storage(audio::BackgroundStage::StorageSize(kSlots, length));
+        audio::BackgroundStage tap(&analyzer, audio::kbmTap, kSlots, length, tap_storage.data());
+        const PathTime background_analysis = MeasurePath(length, blocks, [&](const audio::StereoBlock<float> &block) {
+            tap.Process(block);
+        },
+                                                         &tap);
+
+        std::vector<float> inline_convolver_storage(audio::PartitionedConvolver::StorageSize(kPartitionSize, kPartitions));
+        audio::PartitionedConvolver inline_convolver(ir.spectrum, inline_convolver_storage.data());
+        const PathTime inline_convolution = MeasurePath(length, blocks, [&](const audio::StereoBlock<float> &block) {
+            inline_convolver.Process(block);
+        },
+                                                        nullptr);
+
+        std::vector<float> convolver_storage(audio::PartitionedConvolver::StorageSize(kPartitionSize, kPartitions));
+        audio::PartitionedConvolver convolver(ir.spectrum, convolver_storage.data());
+        std::vector<float> replace_storage(audio::BackgroundStage::StorageSize(kSlots, length));
+        audio::BackgroundStage replace(&convolver, audio::kbmReplace, kSlots, length, replace_storage.data());
+        const PathTime background_convolution = MeasurePath(length, blocks, [&](const audio::StereoBlock<float> &block) {
+            replace.Process(block);
+        },
+                                                            &replace);
+        is_passed = is_passed && 0 == replace.Late() && 0 == tap.Dropped();
+
+        std::printf("%8u%14.0f%14.0f%14.0f%14.0f%14.0f%14.0f%14.0f%14.0f\n", length, inline_analysis.mean, inline_analysis.max,
+                    background_analysis.mean, background_analysis.max, inline_convolution.mean, inline_convolution.max,
+                    background_convolution.mean, background_convolution.max);
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
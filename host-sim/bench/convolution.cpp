@@ -0,0 +1,142 @@
+/**
+ * @file convolution.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::PartitionedConvolver.
+ * @details
+ * At first, the output is compared with the direct convolution in double precision, for both the
+ * aligned blocks and the blocks shorter than the partition. The program fails if the error exceeds
+ * the tolerance.
+ *
+ * Then, the time per block of 128 samples is measured against the number of the partitions. The time is
+ * divided into the fixed cost (FFT and inverse FFT) and the cost per partition by the least squares fit.
+ * The longest impulse response sustainable in the block period at 48kHz is printed for the given
+ * fraction of the CPU time.
+ *
+ * On the target, the same division is obtained from the "CPU load" lines of the console, by changing
+ * the length of the impulse response.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "partitionedconvolver.hpp"
+
+namespace {
+
+// Spectra and their storage.
+struct Ir {
+    std::vector<float> taps;
+    std::vector<float> bins;
+    audio::IrSpectrum spectrum;
+};
+
+Ir MakeIr(unsigned int partition_size, unsigned int partitions) {
+    Ir ir;
+    ir.taps = hostsim::Noise(partition_size * partitions, 5);
+    for (unsigned int i = 0; i < ir.taps.size(); i++)
+        ir.taps[i] *= std::exp(-4.0f * i / ir.taps.size());
+    ir.bins.resize(partitions * 2 * (partition_size + 1));
+
+    const audio::Fft fft(2 * partition_size);
+    std::vector<float> scratch(4 * 2 * partition_size);
+    audio::ComputeIrSpectrum(fft, ir.taps.data(), partitions, ir.bins.data(), scratch.data());
+    ir.spectrum = { partition_size, partitions, ir.bins.data() };
+    return ir;
+}
+
+// Compare with the direct convolution. Return the max absolute error.
+double Verify(unsigned int partition_size, unsigned int partitions, unsigned int block_length) {
+    const unsigned int kLength = 4096;
+    const Ir ir = MakeIr(partition_size, partitions);
+    const std::vector<float> input_left = hostsim::Noise(kLength, 3);
+    const std::vector<float> input_right = hostsim::Noise(kLength, 4);
+    // The blocks shorter than the partition are delayed by the partition.
+    const unsigned int latency = (block_length % partition_size == 0) ? 0 : partition_size;
+
+    std::vector<float> storage(audio::PartitionedConvolver::StorageSize(partition_size, partitions));
+    audio::PartitionedConvolver convolver(ir.spectrum, storage.data());
+    std::vector<float> left(input_left);
+    std::vector<float> right(input_right);
+    for (unsigned int position = 0; position < kLength; position += block_length) {
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(&left[position], block_length);
+        block.right = audio::ChannelSpan<float>(&right[position], block_length);
+        convolver.Process(block);
+    }
+
+    double max_error = 0.0;
+    for (unsigned int n = latency; n < kLength; n++) {
+        double l = 0.0, r = 0.0;
+        for (unsigned int k = 0; k < ir.taps.size() && k <= n - latency; k++) {
+            l += static_cast<double>(ir.taps[k]) * input_left[n - latency - k];
+            r += static_cast<double>(ir.taps[k]) * input_right[n - latency - k];
+        }
+        max_error = std::fmax(max_error, std::fabs(l - left[n]));
+        max_error = std::fmax(max_error, std::fabs(r - right[n]));
+    }
+    return max_error;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    const unsigned int kPartitionSize = 128;
+    const unsigned int kSampleRate = 48000;
+    const double kTolerance = 1e-4;
+    // Fraction of the block period given to the convolution.
+    const double share = (argc > 1) ? std::atof(argv[1]) : 0.5;
+
+    std::printf("convolution : max error against the direct convolution\n");
+    bool is_passed = true;
+    const unsigned int cases[][3] = { { 32, 1, 32 }, { 32, 10, 32 }, { 32, 10, 128 }, { 32, 10, 8 }, { 128, 4, 128 } };
+    for (const auto &c : cases) {
+        const double error = Verify(c[0], c[1], c[2]);
+        const bool is_ok = error <= kTolerance;
+        std::printf("  partition %3u x %2u, block %3u : %.3g %s\n", c[0], c[1], c[2], error, is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("convolution : uS per block of %u samples, stereo\n", kPartitionSize);
+    std::printf("%12s%8s%12s\n", "partitions", "taps", "uS/block");
+    const unsigned int partition_counts[] = { 1, 4, 16, 64, 256 };
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (unsigned int partitions : partition_counts) {
+        const Ir ir = MakeIr(kPartitionSize, partitions);
+        std::vector<float> storage(audio::PartitionedConvolver::StorageSize(kPartitionSize, partitions));
+        audio::PartitionedConvolver convolver(ir.spectrum, storage.data());
+        std::vector<float> left = hostsim::Noise(kPartitionSize, 1);
+        std::vector<float> right = hostsim::Noise(kPartitionSize, 2);
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(left.data(), kPartitionSize);
+        block.right = audio::ChannelSpan<float>(right.data(), kPartitionSize);
+
+        const double us = hostsim::MeasureMin([&]() {
+            convolver.Process(block);
+            hostsim::DoNotOptimize(left.data());
+            hostsim::DoNotOptimize(right.data());
+        },
+                                              1000) / 1000.0;
+        std::printf("%12u%8u%12.3f\n", partitions, partitions * kPartitionSize, us);
+        sx += partitions;
+        sy += us;
+        sxx += static_cast<double>(partitions) * partitions;
+        sxy += partitions * us;
+    }
+
+    // us = fixed + per_partition x partitions.
+    const double count = sizeof(partition_counts) / sizeof(partition_counts[0]);
+    const double per_partition = (count * sxy - sx * sy) / (count * sxx - sx * sx);
+    const double fixed = (sy - per_partition * sx) / count;
+    const double period = 1e6 * kPartitionSize / kSampleRate;
+    const double sustainable = (period * share - fixed) / per_partition;
+    std::printf("convolution : fixed %.3f uS + %.3f uS per partition. Block period %.1f uS\n", fixed, per_partition, period);
+    std::printf("convolution : %.0f%% of the block period sustains %.0f partitions, %.0f taps (%.2f S) at %u Hz on this host\n",
+                share * 100, sustainable, sustainable * kPartitionSize, sustainable * kPartitionSize / kSampleRate, kSampleRate);
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file dynamics.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::DynamicsProcessor.
+ * @details
+ * At first, the followings are checked. The program fails if any of them is out of the tolerance.
+ * @li Error of FastLog2() and FastExp2() against the math library.
+ * @li Output level of the compressor against the static curve, by a square wave.
+ * @li Peak of the limiter output against the ceiling, by the noise bursts up to +12dBFS.
+ *
+ * Then, the time per sample is printed for the DynamicsProcessor, the level and gain conversion by
+ * the approximation and by the math library, and the 3 band equalizer of the audio task. The ratio of
+ * the time of the DynamicsProcessor and the equalizer is the estimate of the CPU time on the target.
+ * On the target, compare the "CPU load" lines with and without the DynamicsProcessor.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "biquad.hpp"
+#include "dynamics.hpp"
+
+namespace {
+
+const unsigned int kLookahead = 64;
+const float kSampleRate = 48000.0f;
+
+// Max errors of the approximation.
+void VerifyFastMath(double *log2_error, double *exp2_error) {
+    *log2_error = 0.0;
+    for (float x = 1e-9f; x < 100.0f; x *= 1.001f)
+        *log2_error = std::fmax(*log2_error, std::fabs(audio::FastLog2(x) - std::log2(static_cast<double>(x))));
+    *exp2_error = 0.0;
+    for (float x = -40.0f; x < 10.0f; x += 0.0007f)
+        *exp2_error = std::fmax(*exp2_error, std::fabs(audio::FastExp2(x) / std::exp2(static_cast<double>(x)) - 1.0));
+}
+
+// Process by the blocks of the varying length.
+void Run(audio::DynamicsProcessor *dynamics, std::vector<float> *left, std::vector<float> *right) {
+    const unsigned int block_lengths[] = { 1, 7, 32, 128, 300 };
+    unsigned int i = 0;
+    for (unsigned int position = 0; position < left->size(); i++) {
+        unsigned int length = block_lengths[i % 5];
+        if (position + length > left->size())
+            length = left->size() - position;
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(&(*left)[position], length);
+        block.right = audio::ChannelSpan<float>(&(*right)[position], length);
+        dynamics->Process(block);
+        position += length;
+    }
+}
+
+// Steady output level of the square wave of the input level [dBFS].
+double CompressorLevel(float input, float threshold, float ratio) {
+    const unsigned int kLength = 48000;
+    std::vector<float> storage(audio::DynamicsProcessor::StorageSize(kLookahead));
+    audio::DynamicsProcessor dynamics(kLookahead, kSampleRate, storage.data());
+    dynamics.SetCompressor(threshold, ratio, 0.005f, 0.05f, 0.0f);
+    dynamics.SetLimiter(6.0f, 0.05f);
+
+    const float amplitude = std::pow(10.0f, input / 20.0f);
+    std::vector<float> left(kLength), right(kLength);
+    for (unsigned int n = 0; n < kLength; n++) {
+        left[n] = ((n / 50) & 1) ? amplitude : -amplitude;
+        right[n] = 0.5f * left[n];
+    }
+    Run(&dynamics, &left, &right);
+    return 20.0 * std::log10(std::fabs(left[kLength - 1]));
+}
+
+// Peak of the limiter output [dBFS].
+double LimiterPeak(float ceiling) {
+    const unsigned int kLength = 48000;
+    std::vector<float> storage(audio::DynamicsProcessor::StorageSize(kLookahead));
+    audio::DynamicsProcessor dynamics(kLookahead, kSampleRate, storage.data());
+    dynamics.SetCompressor(-20.0f, 2.0f, 0.001f, 0.05f, 6.0f);
+    dynamics.SetLimiter(ceiling, 0.02f);
+
+    std::vector<float> left = hostsim::Noise(kLength, 3);
+    std::vector<float> right = hostsim::Noise(kLength, 4);
+    for (unsigned int n = 0; n < kLength; n++) {
+        // Bursts of 2ms to 20ms, up to 8 times of the noise. The peak is 4.0.
+        const float burst = ((n % 4801) < 96u + (n / 4801) * 96u) ? 8.0f : 0.25f;
+        left[n] *= burst;
+        right[n] *= burst * ((n / 4801) & 1 ? 0.1f : 1.0f);
+    }
+    Run(&dynamics, &left, &right);
+
+    double peak = 0.0;
+    for (unsigned int n = 0; n < kLength; n++)
+        peak = std::fmax(peak, std::fmax(std::fabs(left[n]), std::fabs(right[n])));
+    return 20.0 * std::log10(peak);
+}
+
+// Level to gain conversion of a block, as the DynamicsProcessor does. L and E are log2 and exp2.
+template<typename L, typename E>
+void Convert(float *left, float *right, unsigned int length, L log2_function, E exp2_function) {
+    for (unsigned int n = 0; n < length; n++) {
+        const float peak = std::fmax(std::fmax(std::fabs(left[n]), std::fabs(right[n])), 1e-12f);
+        const float gain = exp2_function(std::fmin(0.0f, (-3.0f - log2_function(peak)) * 0.75f));
+        left[n] *= gain;
+        right[n] *= gain;
+    }
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int kBlockLength = 128;
+    const unsigned int kRepeat = 1000;
+    bool is_passed = true;
+
+    double log2_error, exp2_error;
+    VerifyFastMath(&log2_error, &exp2_error);
+    const bool is_math_ok = log2_error < 2e-4 && exp2_error < 1e-5;
+    std::printf("dynamics : FastLog2 max abs error %.3g, FastExp2 max rel error %.3g %s\n", log2_error, exp2_error,
+                is_math_ok ? "ok" : "FAILED");
+    is_passed = is_passed && is_math_ok;
+
+    std::printf("dynamics : compressor output of the square wave, threshold -20dBFS, ratio 4\n");
+    const float inputs[] = { -30.0f, -20.0f, -10.0f, 0.0f };
+    for (float input : inputs) {
+        const double expected = (input < -20.0f) ? input : -20.0f + (input + 20.0f) / 4.0f;
+        const double output = CompressorLevel(input, -20.0f, 4.0f);
+        const bool is_ok = std::fabs(output - expected) < 0.01;
+        std::printf("  input %6.1f dBFS : output %8.3f dBFS, expected %6.2f %s\n", input, output, expected, is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("dynamics : limiter peak of the bursts up to +12dBFS\n");
+    const float ceilings[] = { -1.0f, -6.0f };
+    for (float ceiling : ceilings) {
+        const double peak = LimiterPeak(ceiling);
+        const bool is_ok = peak <= ceiling;
+        std::printf("  ceiling %5.1f dBFS : peak %8.3f dBFS %s\n", ceiling, peak, is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("dynamics : nS per sample, stereo, block length %u\n", kBlockLength);
+    std::vector<float> left = hostsim::Noise(kBlockLength, 1);
+    std::vector<float> right = hostsim::Noise(kBlockLength, 2);
+    audio::StereoBlock<float> block;
+    block.left = audio::ChannelSpan<float>(left.data(), kBlockLength);
+    block.right = audio::ChannelSpan<float>(right.data(), kBlockLength);
+
+    std::vector<float> storage(audio::DynamicsProcessor::StorageSize(kLookahead));
+    audio::DynamicsProcessor dynamics(kLookahead, kSampleRate, storage.data());
+    dynamics.SetCompressor(-20.0f, 4.0f, 0.005f, 0.1f, 0.0f);
+    dynamics.SetLimiter(-1.0f, 0.05f);
+    const double dynamics_ns = hostsim::MeasureMin([&]() {
+        dynamics.Process(block);
+        hostsim::DoNotOptimize(left.data());
+        hostsim::DoNotOptimize(right.data());
+    },
+                                                   kRepeat) / kBlockLength;
+
+    const double fast_ns = hostsim::MeasureMin([&]() {
+        Convert(left.data(), right.data(), kBlockLength, audio::FastLog2, audio::FastExp2);
+        hostsim::DoNotOptimize(left.data());
+        hostsim::DoNotOptimize(right.data());
+    },
+                                               kRepeat) / kBlockLength;
+    const double library_ns = hostsim::MeasureMin([&]() {
+        Convert(left.data(), right.data(), kBlockLength, log2f, exp2f);
+        hostsim::DoNotOptimize(left.data());
+        hostsim::DoNotOptimize(right.data());
+    },
+                                                  kRepeat) / kBlockLength;
+
+    // Same bands as SetEqualizer() of the murasaki_platform.cpp.
+    audio::BiquadCoefficients coefficients[3] = {
+            audio::DesignBiquad(audio::kbtLowShelf, kSampleRate, 100.0f, 3.0f, 0.707f),
+            audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 3000.0f, -2.0f, 1.0f),
+            audio::DesignBiquad(audio::kbtHighShelf, kSampleRate, 10000.0f, 2.0f, 0.707f) };
+    audio::BiquadCascade equalizer;
+    equalizer.SetCoefficients(coefficients, 3);
+    const double equalizer_ns = hostsim::MeasureMin([&]() {
+        equalizer.Process(block);
+        hostsim::DoNotOptimize(left.data());
+        hostsim::DoNotOptimize(right.data());
+    },
+                                                    kRepeat) / kBlockLength;
+
+    std::printf("%36s%10.2f\n", "DynamicsProcessor, lookahead 64", dynamics_ns);
+    std::printf("%36s%10.2f\n", "conversion by FastLog2 / FastExp2", fast_ns);
+    std::printf("%36s%10.2f\n", "conversion by log2f / exp2f", library_ns);
+    std::printf("%36s%10.2f\n", "3 band equalizer", equalizer_ns);
+    std::printf("dynamics : %.2f times of the equalizer\n", dynamics_ns / equalizer_ns);
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file fft.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::Fft and audio::RealFft.
+ * @details
+ * At first, the forward transforms are compared with the DFT in double precision, and the round trip
+ * of the forward and inverse transform is compared with the input. The program fails if the error
+ * relative to the RMS of the spectrum exceeds the tolerance.
+ *
+ * Then, the time per transform is printed for the sizes from 128 to 1024 points, for the complex FFT,
+ * the real FFT and the DFT. The real FFT of N points is compared with the complex FFT of N / 2 points,
+ * which it calls.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "fft.hpp"
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// Complex DFT in double. in and out are interleaved as re, im.
+void Dft(const std::vector<double> &in, std::vector<double> *out, unsigned int size) {
+    out->assign(2 * size, 0.0);
+    for (unsigned int k = 0; k < size; k++) {
+        double re = 0.0, im = 0.0;
+        for (unsigned int n = 0; n < size; n++) {
+            const double angle = -2.0 * kPi * ((static_cast<unsigned long>(k) * n) % size) / size;
+            re += in[2 * n] * std::cos(angle) - in[2 * n + 1] * std::sin(angle);
+            im += in[2 * n] * std::sin(angle) + in[2 * n + 1] * std::cos(angle);
+        }
+        (*out)[2 * k] = re;
+        (*out)[2 * k + 1] = im;
+    }
+}
+
+// Errors relative to the RMS of the reference.
+struct Errors {
+    double forward;
+    double round_trip;
+};
+
+Errors VerifyComplex(unsigned int size) {
+    const std::vector<float> input = hostsim::Noise(2 * size, 7);
+    std::vector<double> reference;
+    Dft(std::vector<double>(input.begin(), input.end()), &reference, size);
+
+    const audio::Fft fft(size);
+    std::vector<float> data(input);
+    fft.Forward(data.data());
+
+    double power = 0.0, error = 0.0;
+    for (unsigned int i = 0; i < 2 * size; i++) {
+        power += reference[i] * reference[i];
+        error = std::fmax(error, std::fabs(reference[i] - data[i]));
+    }
+    Errors errors;
+    errors.forward = error / std::sqrt(power / (2 * size));
+
+    fft.Inverse(data.data());
+    error = 0.0;
+    for (unsigned int i = 0; i < 2 * size; i++)
+        error = std::fmax(error, std::fabs(data[i] / size - input[i]));
+    errors.round_trip = error / 0.5;    // The noise is from -0.5 to 0.5.
+    return errors;
+}
+
+Errors VerifyReal(unsigned int size) {
+    const std::vector<float> input = hostsim::Noise(size, 8);
+    std::vector<double> complex_input(2 * size, 0.0);
+    for (unsigned int i = 0; i < size; i++)
+        complex_input[2 * i] = input[i];
+    std::vector<double> reference;
+    Dft(complex_input, &reference, size);
+
+    const audio::RealFft fft(size);
+    std::vector<float> data(input);
+    fft.Forward(data.data());
+
+    // Unpack. See RealFft.
+    std::vector<double> spectrum(data.begin(), data.end());
+    spectrum[1] = 0.0;
+    double power = 0.0, error = std::fabs(reference[size] - data[1]);
+    for (unsigned int i = 0; i < size; i++) {
+        power += reference[i] * reference[i];
+        error = std::fmax(error, std::fabs(reference[i] - spectrum[i]));
+    }
+    Errors errors;
+    errors.forward = error / std::sqrt(power / size);
+
+    fft.Inverse(data.data());
+    error = 0.0;
+    for (unsigned int i = 0; i < size; i++)
+        error = std::fmax(error, std::fabs(data[i] / size - input[i]));
+    errors.round_trip = error / 0.5;
+    return errors;
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int sizes[] = { 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048 };
+    const double kTolerance = 1e-5;
+
+    std::printf("fft : max error relative to RMS, forward against DFT and round trip\n");
+    std::printf("%8s%14s%14s%14s%14s\n", "points", "Fft", "Fft trip", "RealFft", "RealFft trip");
+    bool is_passed = true;
+    for (unsigned int size : sizes) {
+        const Errors c = VerifyComplex(size);
+        const Errors r = VerifyReal(size);
+        const bool is_ok = c.forward <= kTolerance && c.round_trip <= kTolerance && r.forward <= kTolerance
+                && r.round_trip <= kTolerance;
+        std::printf("%8u%14.3g%14.3g%14.3g%14.3g %s\n", size, c.forward, c.round_trip, r.forward, r.round_trip,
+                    is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("fft : nS per forward transform\n");
+    std::printf("%8s%12s%12s%12s\n", "points", "Fft", "RealFft", "DFT");
+    for (unsigned int size = 128; size <= 1024; size *= 2) {
+        const audio::Fft fft(size);
+        std::vector<float> complex_data = hostsim::Noise(2 * size, 1);
+        const double fft_ns = hostsim::MeasureMin([&]() {
+            fft.Forward(complex_data.data());
+            hostsim::DoNotOptimize(complex_data.data());
+        },
+                                                  200);
+
+        const audio::RealFft real_fft(size);
+        std::vector<float> real_data = hostsim::Noise(size, 2);
+        const double real_ns = hostsim::MeasureMin([&]() {
+            real_fft.Forward(real_data.data());
+            hostsim::DoNotOptimize(real_data.data());
+        },
+                                                   200);
+
+        // Single precision DFT with the precomputed table. O(N^2).
+        std::vector<float> table(2 * size);
+        for (unsigned int i = 0; i < size; i++) {
+            table[2 * i] = static_cast<float>(std::cos(2.0 * kPi * i / size));
+            table[2 * i + 1] = static_cast<float>(-std::sin(2.0 * kPi * i / size));
+        }
+        std::vector<float> dft_in = hostsim::Noise(2 * size, 3);
+        std::vector<float> dft_out(2 * size);
+        const double dft_ns = hostsim::MeasureMin([&]() {
+            for (unsigned int k = 0; k < size; k++) {
+                float re = 0.0f, im = 0.0f;
+                for (unsigned int n = 0, index = 0; n < size; n++, index = (index + k) & (size - 1)) {
+                    re += dft_in[2 * n] * table[2 * index] - dft_in[2 * n + 1] * table[2 * index + 1];
+                    im += dft_in[2 * n] * table[2 * index + 1] + dft_in[2 * n + 1] * table[2 * index];
+                }
+                dft_out[2 * k] = re;
+                dft_out[2 * k + 1] = im;
+            }
+            hostsim::DoNotOptimize(dft_out.data());
+        },
+                                                  5);
+
+        std::printf("%8u%12.0f%12.0f%12.0f\n", size, fft_ns, real_ns, dft_ns);
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file fir.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::FirFilter.
+ * @details
+ * At first, the output of the filter is compared with the direct convolution in double precision.
+ * The input is processed by the blocks of the varying length, to check the continuity of the
+ * state over the blocks. The program fails if the error exceeds the tolerance.
+ *
+ * Then, the time per sample per tap is printed against the number of taps, for the filter and the
+ * naive convolution with the modulo indexing.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "fir.hpp"
+
+namespace {
+
+// Straightforward stereo FIR with the circular buffer and the modulo indexing.
+class NaiveFir {
+ public:
+    explicit NaiveFir(const std::vector<float> &coefficients)
+            : h_(coefficients),
+              left_(coefficients.size(), 0.0f),
+              right_(coefficients.size(), 0.0f),
+              position_(0) {
+    }
+
+    void Process(float *left, float *right, unsigned int length) {
+        const unsigned int taps = h_.size();
+        for (unsigned int n = 0; n < length; n++) {
+            left_[position_] = left[n];
+            right_[position_] = right[n];
+            float l = 0.0f, r = 0.0f;
+            for (unsigned int k = 0; k < taps; k++) {
+                const unsigned int index = (position_ + taps - k) % taps;
+                l += h_[k] * left_[index];
+                r += h_[k] * right_[index];
+            }
+            left[n] = l;
+            right[n] = r;
+            position_ = (position_ + 1) % taps;
+        }
+    }
+
+ private:
+    std::vector<float> h_;
+    std::vector<float> left_;
+    std::vector<float> right_;
+    unsigned int position_;
+};
+
+// Compare the filter with the direct convolution. Return the max absolute error.
+double Verify(unsigned int taps) {
+    const unsigned int kLength = 4096;
+    std::vector<float> h(taps);
+    audio::DesignFirLowPass(h.data(), taps, 0.2f);
+    const std::vector<float> input_left = hostsim::Noise(kLength, 3);
+    const std::vector<float> input_right = hostsim::Noise(kLength, 4);
+
+    std::vector<float> storage(audio::FirFilter::StorageSize(taps));
+    audio::FirFilter fir(taps, storage.data());
+    fir.SetCoefficients(h.data());
+
+    std::vector<float> left(input_left);
+    std::vector<float> right(input_right);
+    const unsigned int block_lengths[] = { 1, 7, 32, 128, 300 };
+    unsigned int i = 0;
+    for (unsigned int position = 0; position < kLength; i++) {
+        unsigned int length = block_lengths[i % 5];
+        if (position + length > kLength)
+            length = kLength - position;
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(&left[position], length);
+        block.right = audio::ChannelSpan<float>(&right[position], length);
+        fir.Process(block);
+        position += length;
+    }
+
+    double max_error = 0.0;
+    for (unsigned int n = 0; n < kLength; n++) {
+        double l = 0.0, r = 0.0;
+        for (unsigned int k = 0; k < taps && k <= n; k++) {
+            l += static_cast<double>(h[k]) * input_left[n - k];
+            r += static_cast<double>(h[k]) * input_right[n - k];
+        }
+        max_error = std::fmax(max_error, std::fabs(l - left[n]));
+        max_error = std::fmax(max_error, std::fabs(r - right[n]));
+    }
+    return max_error;
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int tap_counts[] = { 1, 2, 31, 64, 255, 512 };
+    const unsigned int kBlockLength = 128;
+    const unsigned int kRepeat = 200;
+    const double kTolerance = 1e-5;
+
+    std::printf("fir : max error against the direct convolution\n");
+    bool is_passed = true;
+    for (unsigned int taps : tap_counts) {
+        const double error = Verify(taps);
+        const bool is_ok = error <= kTolerance;
+        std::printf("%8u taps : %.3g %s\n", taps, error, is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("fir : nS per sample per tap, stereo, block length %u\n", kBlockLength);
+    std::printf("%8s%12s%12s\n", "taps", "FirFilter", "naive");
+    for (unsigned int taps : tap_counts) {
+        if (taps < 16)
+            continue;
+        std::vector<float> h(taps);
+        audio::DesignFirLowPass(h.data(), taps, 0.2f);
+        std::vector<float> left = hostsim::Noise(kBlockLength, 1);
+        std::vector<float> right = hostsim::Noise(kBlockLength, 2);
+
+        std::vector<float> storage(audio::FirFilter::StorageSize(taps));
+        audio::FirFilter fir(taps, storage.data());
+        fir.SetCoefficients(h.data());
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(left.data(), kBlockLength);
+        block.right = audio::ChannelSpan<float>(right.data(), kBlockLength);
+        const double fir_ns = hostsim::MeasureMin([&]() {
+            fir.Process(block);
+            hostsim::DoNotOptimize(left.data());
+            hostsim::DoNotOptimize(right.data());
+        },
+                                                  kRepeat);
+
+        NaiveFir naive(h);
+        const double naive_ns = hostsim::MeasureMin([&]() {
+            naive.Process(left.data(), right.data(), kBlockLength);
+            hostsim::DoNotOptimize(left.data());
+            hostsim::DoNotOptimize(right.data());
+        },
+                                                    kRepeat);
+
+        const double samples = 2.0 * kBlockLength * taps;
+        std::printf("%8u%12.3f%12.3f\n", taps, fir_ns / samples, naive_ns / samples);
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,281 @@
+/**
+ * @file interruptaudio.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::InterruptAudio and audio::LatencyMeter.
+ * @details
+ * At first, the following checks are done. The program fails if one of them fails.
+ * @li Circular : The halves of the DMA buffers are emulated for both word orders. Each transmitted half
+ *     must be the received half of 2 blocks before, processed by the callback, exactly.
+ * @li Saturation : The processed sample over the full scale must be saturated in the DMA word.
+ * @li Q31 : With the Q31 callback, the DMA words are given as they are. The transmitted half must be the
+ *     received 32bit words of 2 blocks before, doubled by audio::Q31Gain with saturation, bit by bit.
+ *
+ * Then, the latency from the emulated DMA interrupt to the processing is measured by audio::LatencyMeter,
+ * with the processing in the interrupt thread, and with the processing in a task thread woken by the
+ * interrupt thread. The scheduler of the host stands for the RTOS. The interrupt thread ticks at the block
+ * period in real time.
+ *
+ * On the target, the same numbers are the "Latency" lines of the console. Switch the mode by
+ * AUDIO_CONFIG_INTERRUPT_AUDIO.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench.hpp"
+#include "interruptaudio.hpp"
+#include "latencymeter.hpp"
+#include "q31gain.hpp"
+
+namespace {
+
+const unsigned int kMaxLength = 512;
+const unsigned int kSampleRate = 48000;
+
+float gain = 0.5f;
+audio::Q31Gain q31_gain;
+audio::LatencyMeter *meter = nullptr;
+
+uint32_t Cycles() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Multiply by the gain. Exact in the float for the gain of power of 2.
+void Gain(const audio::StereoBlock<float> &block) {
+    if (nullptr != meter)
+        meter->Begin(Cycles());
+    for (unsigned int i = 0; i < block.Length(); i++) {
+        block.left[i] *= gain;
+        block.right[i] *= gain;
+    }
+    if (nullptr != meter)
+        meter->End(Cycles());
+}
+
+void GainQ31(const audio::StereoBlock<audio::q31_t> &block) {
+    q31_gain.Process(block);
+}
+
+// Q31 of the noise. Exact in the float.
+std::vector<audio::q31_t> NoiseQ31(unsigned int length, uint32_t seed) {
+    const std::vector<float> noise = hostsim::Noise(length, seed);
+    std::vector<audio::q31_t> samples(length);
+    for (unsigned int i = 0; i < length; i++)
+        samples[i] = audio::FloatToQ31(noise[i]);
+    return samples;
+}
+
+// Emulate the circular DMA over the noise, and compare the transmitted halves.
+bool CheckCircular(audio::DmaWordOrder order, unsigned int length) {
+    const unsigned int kBlocks = 64;
+    const std::vector<audio::q31_t> left = NoiseQ31(length * kBlocks, 1);
+    const std::vector<audio::q31_t> right = NoiseQ31(length * kBlocks, 2);
+
+    std::vector<int32_t> dma_storage(audio::InterruptAudio::DmaStorageSize(kMaxLength));
+    std::vector<float> storage(audio::InterruptAudio::StorageSize(kMaxLength));
+    audio::InterruptAudio interrupt_audio(&Gain, order, kMaxLength, dma_storage.data(), storage.data());
+    interrupt_audio.SetLength(length);
+    gain = 0.5f;
+
+    bool is_ok = interrupt_audio.DmaWords() == 4 * length;
+    for (unsigned int block = 0; block < kBlocks; block++) {
+        const unsigned int offset = (block % 2) * 2 * length;
+
+        // The half transmitted while this block is received.
+        for (unsigned int i = 0; i < length; i++) {
+            audio::q31_t expected_left = 0;
+            audio::q31_t expected_right = 0;
+            if (block >= 2) {
+                const unsigned int position = (block - 2) * length + i;
+                expected_left = audio::FloatToQ31(0.5f * audio::Q31ToFloat(left[position]));
+                expected_right = audio::FloatToQ31(0.5f * audio::Q31ToFloat(right[position]));
+            }
+            if (interrupt_audio.TxBuffer()[offset + 2 * i] != audio::InterruptAudio::ToDmaWord(expected_left, order)
+                    || interrupt_audio.TxBuffer()[offset + 2 * i + 1] != audio::InterruptAudio::ToDmaWord(expected_right, order))
+                is_ok = false;
+        }
+
+        // Receive the block, and take the interrupt.
+        for (unsigned int i = 0; i < length; i++) {
+            interrupt_audio.RxBuffer()[offset + 2 * i] = audio::InterruptAudio::ToDmaWord(left[block * length + i], order);
+            interrupt_audio.RxBuffer()[offset + 2 * i + 1] = audio::InterruptAudio::ToDmaWord(right[block * length + i], order);
+        }
+        if (block % 2 == 0)
+            interrupt_audio.OnHalfTransfer();
+        else
+            interrupt_audio.OnFullTransfer();
+    }
+
+    std::printf("interruptaudio : circular %s, %u samples %s\n", order == audio::kdwoNative ? "native" : "swapped halves", length,
+                is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Random 32bit words through the Q31 callback. No float conversion.
+bool CheckQ31(audio::DmaWordOrder order, unsigned int length) {
+    const unsigned int kBlocks = 16;
+    std::vector<audio::q31_t> samples(2 * length * kBlocks);
+    uint32_t seed = 7;
+    for (audio::q31_t &sample : samples) {
+        seed = seed * 1664525u + 1013904223u;
+        sample = static_cast<audio::q31_t>(seed);
+    }
+
+    std::vector<int32_t> dma_storage(audio::InterruptAudio::DmaStorageSize(kMaxLength));
+    std::vector<audio::q31_t> storage(audio::InterruptAudio::StorageSize(kMaxLength));
+    audio::InterruptAudio interrupt_audio(&GainQ31, order, kMaxLength, dma_storage.data(), storage.data());
+    interrupt_audio.SetLength(length);
+    q31_gain.SetGain(2.0f, 2.0f);
+
+    bool is_ok = true;
+    for (unsigned int block = 0; block < kBlocks; block++) {
+        const unsigned int offset = (block % 2) * 2 * length;
+        for (unsigned int i = 0; i < 2 * length; i++) {
+            const int64_t doubled = block >= 2 ? 2 * static_cast<int64_t>(samples[(block - 2) * 2 * length + i]) : 0;
+            const audio::q31_t expected = audio::SaturateQ31(doubled);
+            if (interrupt_audio.TxBuffer()[offset + i] != audio::InterruptAudio::ToDmaWord(expected, order))
+                is_ok = false;
+        }
+        for (unsigned int i = 0; i < 2 * length; i++)
+            interrupt_audio.RxBuffer()[offset + i] = audio::InterruptAudio::ToDmaWord(samples[block * 2 * length + i], order);
+        if (block % 2 == 0)
+            interrupt_audio.OnHalfTransfer();
+        else
+            interrupt_audio.OnFullTransfer();
+    }
+
+    std::printf("interruptaudio : q31 %s, %u samples %s\n", order == audio::kdwoNative ? "native" : "swapped halves", length,
+                is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Full scale in, gain 4. The output must be saturated.
+bool CheckSaturation() {
+    const unsigned int kLength = 16;
+    std::vector<int32_t> dma_storage(audio::InterruptAudio::DmaStorageSize(kLength));
+    std::vector<float> storage(audio::InterruptAudio::StorageSize(kLength));
+    audio::InterruptAudio interrupt_audio(&Gain, audio::kdwoSwappedHalves, kLength, dma_storage.data(), storage.data());
+    gain = 4.0f;
+
+    for (unsigned int i = 0; i < kLength; i++) {
+        interrupt_audio.RxBuffer()[2 * i] = audio::InterruptAudio::ToDmaWord(audio::kQ31Max / 2, audio::kdwoSwappedHalves);
+        interrupt_audio.RxBuffer()[2 * i + 1] = audio::InterruptAudio::ToDmaWord(audio::kQ31Min / 2, audio::kdwoSwappedHalves);
+    }
+    interrupt_audio.OnHalfTransfer();
+
+    bool is_ok = true;
+    for (unsigned int i = 0; i < kLength; i++)
+        if (audio::InterruptAudio::FromDmaWord(interrupt_audio.TxBuffer()[2 * i], audio::kdwoSwappedHalves) != audio::kQ31Max
+                || audio::InterruptAudio::FromDmaWord(interrupt_audio.TxBuffer()[2 * i + 1], audio::kdwoSwappedHalves) != audio::kQ31Min)
+            is_ok = false;
+    gain = 0.5f;
+
+    std::printf("interruptaudio : saturation %s\n", is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Run the interrupt thread at the block period. The block is processed in the interrupt thread,
+// or in the task thread woken by the interrupt thread.
+void MeasureLatency(unsigned int length, bool is_task, audio::LoadStatistics *response, audio::LoadStatistics *completion) {
+    const unsigned int kBlocks = 2 * kSampleRate / length;    // 2 seconds.
+    std::vector<int32_t> dma_storage(audio::InterruptAudio::DmaStorageSize(kMaxLength));
+    std::vector<float> storage(audio::InterruptAudio::StorageSize(kMaxLength));
+    audio::InterruptAudio interrupt_audio(&Gain, audio::kdwoSwappedHalves, kMaxLength, dma_storage.data(), storage.data());
+    interrupt_audio.SetLength(length);
+
+    audio::LatencyMeter latency;
+    latency.SetBudget(static_cast<uint32_t>(1000000000ull * length / kSampleRate));
+    meter = &latency;
+
+    // Binary semaphore between the interrupt and the task.
+    std::mutex mutex;
+    std::condition_variable condition;
+    unsigned int requests = 0;
+    bool is_done = false;
+
+    std::thread task;
+    if (is_task)
+        task = std::thread([&]() {
+            unsigned int processed = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    condition.wait(lock, [&] {
+                        return requests != processed || is_done;
+                    });
+                    if (is_done)
+                        return;
+                    processed = requests;
+                }
+                if (processed % 2 == 1)
+                    interrupt_audio.OnHalfTransfer();
+                else
+                    interrupt_audio.OnFullTransfer();
+            }
+        });
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::chrono::nanoseconds period(1000000000ull * length / kSampleRate);
+    for (unsigned int block = 0; block < kBlocks; block++) {
+        std::this_thread::sleep_until(start + period * (block + 1));
+        latency.NotifyInterrupt(Cycles());
+        if (is_task) {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests++;
+            condition.notify_one();
+        }
+        else if (block % 2 == 0)
+            interrupt_audio.OnHalfTransfer();
+        else
+            interrupt_audio.OnFullTransfer();
+    }
+
+    if (is_task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_done = true;
+            condition.notify_one();
+        }
+        task.join();
+    }
+    meter = nullptr;
+    latency.Read(response, completion, false);
+}
+
+}  // namespace
+
+int main() {
+    bool is_passed = true;
+    const unsigned int check_lengths[] = { 16, 128, 512 };
+    for (unsigned int length : check_lengths) {
+        is_passed = CheckCircular(audio::kdwoNative, length) && is_passed;
+        is_passed = CheckCircular(audio::kdwoSwappedHalves, length) && is_passed;
+        is_passed = CheckQ31(audio::kdwoNative, length) && is_passed;
+        is_passed = CheckQ31(audio::kdwoSwappedHalves, length) && is_passed;
+    }
+    is_passed = CheckSaturation() && is_passed;
+
+    std::printf("interruptaudio : latency from the interrupt [uS], %u Hz, 2 seconds each\n", kSampleRate);
+    std::printf("%8s%10s%10s%10s%10s%10s%10s%10s\n", "length", "mode", "min", "mean", "max", "jitter", "complete", "worst");
+    const unsigned int lengths[] = { 32, 128 };
+    for (unsigned int length : lengths) {
+        for (int is_task = 1; is_task >= 0; is_task--) {
+            audio::LoadStatistics response;
+            audio::LoadStatistics completion;
+            MeasureLatency(length, is_task, &response, &completion);
+            is_passed = is_passed && response.blocks != 0 && response.blocks == completion.blocks;
+            std::printf("%8u%10s%10.1f%10.1f%10.1f%10.1f%10.1f%10.1f\n", length, is_task ? "task" : "interrupt", response.min / 1000.0,
+                        response.Mean() / 1000.0, response.max / 1000.0, (response.max - response.min) / 1000.0,
+                        completion.Mean() / 1000.0, completion.max / 1000.0);
+        }
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
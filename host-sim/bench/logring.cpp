@@ -0,0 +1,178 @@
+/**
+ * @file logring.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::LogRing.
+ * @details
+ * At first, the following checks are done. The program fails if one of them fails.
+ * @li Order : The messages are read in the written order with the arguments, over the wrap around of the ring.
+ * @li Full : The messages over the capacity are dropped and counted. The ring works again after the read.
+ * @li Concurrent : Two writer threads, standing for the audio task and an interrupt, log while a reader
+ *     thread reads. A writer retries the dropped message. Each writer's messages must be read in order,
+ *     without loss and duplication.
+ *
+ * Then, the time of the writer per message is compared between Log() and the formatting by snprintf(),
+ * which the audio task pays with murasaki::debugger->Printf().
+ *
+ * On the target, the messages are shown in the console with the time in uS, by ExecPlatform().
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "bench.hpp"
+#include "logring.hpp"
+
+namespace {
+
+const unsigned int kSlots = 64;
+const char kFormat[] = "Block %lu : %lu cycles, %s";
+const char kLate[] = "late";
+
+typedef audio::LogRing<kSlots> Ring;
+
+bool CheckOrder() {
+    Ring ring;
+    bool is_ok = true;
+    unsigned long written = 0;
+    unsigned long read = 0;
+
+    // Rounds of the different length, to cross the end of the ring at the different positions.
+    for (unsigned int round = 0; round < 20; round++) {
+        const unsigned int count = 1 + (round * 7) % kSlots;
+        for (unsigned int i = 0; i < count; i++, written++)
+            is_ok = AUDIO_LOG(&ring, static_cast<uint32_t>(written * 3), kFormat, written, written * 2, kLate) && is_ok;
+
+        audio::LogEntry entry;
+        while (ring.Read(&entry)) {
+            if (entry.format != kFormat || entry.timestamp != read * 3 || entry.args[0] != read || entry.args[1] != read * 2
+                    || entry.args[2] != reinterpret_cast<audio::LogArg>(kLate) || entry.args[3] != 0)
+                is_ok = false;
+            read++;
+        }
+    }
+
+    // Formatting of the last message.
+    char text[64];
+    AUDIO_LOG(&ring, 0, kFormat, 7ul, 1234ul, kLate);
+    audio::LogEntry entry;
+    is_ok = ring.Read(&entry) && is_ok;
+    entry.Format(text, sizeof(text));
+    is_ok = is_ok && std::strcmp(text, "Block 7 : 1234 cycles, late") == 0;
+    is_ok = is_ok && read == written && ring.Dropped() == 0;
+
+    std::printf("logring : order %lu messages %s\n", read, is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// The messages are never formatted. Then, Log() is called without the check of the arguments.
+bool CheckFull() {
+    Ring ring;
+    bool is_ok = true;
+
+    for (unsigned long i = 0; i < kSlots + 5; i++)
+        is_ok = ring.Log(0, kFormat, i) == (i < kSlots) && is_ok;
+    is_ok = is_ok && ring.Dropped() == 5;
+
+    audio::LogEntry entry;
+    for (unsigned long i = 0; i < kSlots; i++)
+        is_ok = ring.Read(&entry) && entry.args[0] == i && is_ok;
+    is_ok = !ring.Read(&entry) && is_ok;
+
+    // Room again.
+    is_ok = ring.Log(0, kFormat, 99ul) && ring.Read(&entry) && entry.args[0] == 99 && is_ok;
+
+    std::printf("logring : full %s\n", is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+bool CheckConcurrent() {
+    const unsigned long kMessages = 100000;
+    Ring ring;
+    std::atomic<int> running(2);
+
+    auto writer = [&](unsigned long id) {
+        for (unsigned long i = 0; i < kMessages; i++)
+            while (!ring.Log(0, kFormat, id, i))
+                std::this_thread::yield();
+        running--;
+    };
+
+    unsigned long read[2] = { 0, 0 };
+    unsigned long next[2] = { 0, 0 };
+    bool is_ok = true;
+    std::thread task(writer, 0);
+    std::thread interrupt(writer, 1);
+    audio::LogEntry entry;
+    while (true) {
+        const bool is_done = running == 0;
+        while (ring.Read(&entry)) {
+            const unsigned long id = entry.args[0];
+            if (id > 1 || entry.args[1] != next[id]) {
+                is_ok = false;
+                continue;
+            }
+            next[id] = entry.args[1] + 1;
+            read[id]++;
+        }
+        if (is_done)
+            break;
+    }
+    task.join();
+    interrupt.join();
+
+    is_ok = is_ok && read[0] == kMessages && read[1] == kMessages;
+    std::printf("logring : concurrent %lu read, %lu retried %s\n", read[0] + read[1], static_cast<unsigned long>(ring.Dropped()),
+                is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Time per message of the writer [nS]. The shortest of the batches.
+template<typename F>
+double MeasureWriter(F write, Ring *ring) {
+    const unsigned int kBatch = kSlots / 2;
+    double min = 1e300;
+    for (unsigned int repeat = 0; repeat < 1000; repeat++) {
+        const auto begin = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < kBatch; i++)
+            write(i);
+        const auto end = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - begin).count() / kBatch;
+        if (ns < min)
+            min = ns;
+
+        audio::LogEntry entry;
+        while (ring->Read(&entry))
+            ;
+    }
+    return min;
+}
+
+}  // namespace
+
+int main() {
+    bool is_passed = true;
+    is_passed = CheckOrder() && is_passed;
+    is_passed = CheckFull() && is_passed;
+    is_passed = CheckConcurrent() && is_passed;
+
+    Ring ring;
+    char text[96];
+    const double log_ns = MeasureWriter([&](unsigned int i) {
+        AUDIO_LOG(&ring, i, kFormat, static_cast<unsigned long>(i), 123456ul, kLate);
+    },
+                                        &ring);
+    const double format_ns = MeasureWriter([&](unsigned int i) {
+        std::snprintf(text, sizeof(text), kFormat, static_cast<unsigned long>(i), 123456ul, kLate);
+        hostsim::DoNotOptimize(text);
+    },
+                                           &ring);
+    std::printf("logring : writer time per message [nS], Log() %.1f, snprintf() %.1f\n", log_ns, format_ns);
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
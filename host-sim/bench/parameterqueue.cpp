@@ -0,0 +1,152 @@
+/**
+ * @file parameterqueue.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::SpscQueue and audio::DoubleBuffer.
+ * @details
+ * At first, the followings are checked between two threads running at the same time. The program fails
+ * if any of them is broken.
+ * @li SpscQueue : Every pushed value is popped once, in the order of the push.
+ * @li DoubleBuffer : The reader never sees a bank written partially.
+ *
+ * Then, the time of Push() and Pop(), and of Update() at a block boundary, is printed. The reader side
+ * is the cost added to the audio task per block.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "bench.hpp"
+#include "doublebuffer.hpp"
+#include "parameterqueue.hpp"
+
+namespace {
+
+const unsigned int kMessages = 200000;
+const unsigned int kBankSize = 64;
+
+struct Bank {
+    unsigned int value[kBankSize];
+};
+
+// Push the sequence from the other thread, and check the popped order.
+// Both sides yield while waiting, for the host with a single core.
+bool VerifyQueue() {
+    audio::ParameterQueue queue;
+    std::thread producer([&queue]() {
+        for (unsigned int i = 0; i < kMessages; i++) {
+            const audio::Parameter parameter = { i, static_cast<float>(i & 0xFFFF) };
+            while (!queue.Push(parameter))
+                std::this_thread::yield();
+        }
+    });
+
+    bool is_ok = true;
+    for (unsigned int expected = 0; expected < kMessages;) {
+        audio::Parameter parameter;
+        if (!queue.Pop(&parameter)) {
+            std::this_thread::yield();
+            continue;
+        }
+        is_ok = is_ok && parameter.id == expected && parameter.value == static_cast<float>(expected & 0xFFFF);
+        expected++;
+    }
+    producer.join();
+    return is_ok;
+}
+
+// Write the banks filled by a sequence number from the other thread. The reader checks each bank
+// has the same number in all the elements, and the number never decreases.
+bool VerifyDoubleBuffer(unsigned int *updates) {
+    audio::DoubleBuffer<Bank> banks { Bank(), Bank() };
+    std::atomic<bool> is_done(false);
+    std::thread writer([&banks, &is_done]() {
+        for (unsigned int n = 1; n <= kMessages / 4;) {
+            Bank *const bank = banks.BeginWrite();
+            if (nullptr == bank) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (unsigned int i = 0; i < kBankSize; i++)
+                bank->value[i] = n;
+            banks.EndWrite();
+            n++;
+        }
+        is_done.store(true);
+    });
+
+    bool is_ok = true;
+    unsigned int last = 0;
+    *updates = 0;
+    while (!is_done.load() || banks.Update()) {
+        if (banks.Update())
+            (*updates)++;
+        const Bank &bank = banks.Front();
+        for (unsigned int i = 0; i < kBankSize; i++)
+            is_ok = is_ok && bank.value[i] == bank.value[0];
+        is_ok = is_ok && bank.value[0] >= last;
+        last = bank.value[0];
+        std::this_thread::yield();
+    }
+    writer.join();
+    return is_ok && last == kMessages / 4;
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int kRepeat = 1000;
+    bool is_passed = true;
+
+    const bool is_queue_ok = VerifyQueue();
+    std::printf("parameterqueue : %u messages between two threads, order %s\n", kMessages, is_queue_ok ? "ok" : "FAILED");
+    is_passed = is_passed && is_queue_ok;
+
+    unsigned int updates;
+    const bool is_buffer_ok = VerifyDoubleBuffer(&updates);
+    std::printf("parameterqueue : %u banks taken by the reader, no torn bank %s\n", updates, is_buffer_ok ? "ok" : "FAILED");
+    is_passed = is_passed && is_buffer_ok;
+
+    std::printf("parameterqueue : nS per operation\n");
+    audio::ParameterQueue queue;
+    const unsigned int kBurst = audio::kParameterQueueLength - 1;
+    const double push_ns = hostsim::MeasureMin([&]() {
+        for (unsigned int i = 0; i < kBurst; i++) {
+            const audio::Parameter parameter = { i, 1.0f };
+            queue.Push(parameter);
+        }
+        hostsim::DoNotOptimize(&queue);
+        audio::Parameter parameter;
+        while (queue.Pop(&parameter))
+            hostsim::DoNotOptimize(&parameter);
+    },
+                                               kRepeat) / kBurst;
+    // The single call is too short for the clock. Measure a loop of them.
+    const unsigned int kLoop = 1000;
+    audio::Parameter parameter;
+    const double empty_ns = hostsim::MeasureMin([&]() {
+        for (unsigned int i = 0; i < kLoop; i++) {
+            queue.Pop(&parameter);
+            hostsim::DoNotOptimize(&parameter);
+        }
+    },
+                                                kRepeat) / kLoop;
+
+    audio::DoubleBuffer<Bank> banks { Bank(), Bank() };
+    const double update_ns = hostsim::MeasureMin([&]() {
+        for (unsigned int i = 0; i < kLoop; i++) {
+            banks.Update();
+            hostsim::DoNotOptimize(&banks.Front());
+        }
+    },
+                                                 kRepeat) / kLoop;
+
+    std::printf("%36s%10.2f\n", "Push and Pop of a message", push_ns);
+    std::printf("%36s%10.2f\n", "Pop of the empty queue", empty_ns);
+    std::printf("%36s%10.2f\n", "Update without the pending bank", update_ns);
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
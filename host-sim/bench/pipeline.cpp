@@ -0,0 +1,205 @@
+/**
+ * @file pipeline.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::StaticChain and audio::DynamicChain.
+ * @details
+ * The chain is gain, 3 band equalizer, feedback delay and gain. It is processed in the following ways.
+ * @li Fused : A StaticChain of the 4 sample stages. One loop over the block.
+ * @li Separate : A StaticChain for each stage, called one by one. Four loops over the block.
+ * @li Dynamic : A DynamicChain of the same 4 StaticChains. Four virtual calls per block.
+ * @li Block stages : SmoothedGain, BiquadCascade and DynamicsProcessor in a StaticChain and in a DynamicChain.
+ *
+ * At first, the outputs of the fused and the dynamic chain are compared with the separate passes.
+ * They must be identical. Then, the time per sample is printed against the block length.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "bench.hpp"
+#include "biquad.hpp"
+#include "dynamics.hpp"
+#include "pipeline.hpp"
+#include "smoothing.hpp"
+
+namespace {
+
+const float kSampleRate = 48000.0f;
+const unsigned int kDelaySize = 4096;
+const unsigned int kLookahead = 64;
+
+// Stages of a chain. Each instance has its own state.
+struct Stages {
+    audio::SampleGain input;
+    audio::SampleBiquad<3> equalizer;
+    std::vector<float> delay_storage;
+    audio::SampleDelay delay;
+    audio::SampleGain output;
+
+    Stages()
+            : input(0.5f),
+              delay_storage(audio::SampleDelay::StorageSize(kDelaySize)),
+              delay(kDelaySize, delay_storage.data()),
+              output(1.0f) {
+        const audio::BiquadCoefficients bands[3] = {
+                audio::DesignBiquad(audio::kbtLowShelf, kSampleRate, 100.0f, 3.0f, 0.707f),
+                audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 3000.0f, -2.0f, 1.0f),
+                audio::DesignBiquad(audio::kbtHighShelf, kSampleRate, 10000.0f, 2.0f, 0.707f) };
+        equalizer.SetCoefficients(bands);
+        delay.SetDelay(3001);
+        delay.SetFeedback(0.4f, 0.3f);
+        output.SetGain(0.8f);
+    }
+};
+
+typedef audio::StaticChain<audio::SampleGain, audio::SampleBiquad<3>, audio::SampleDelay, audio::SampleGain> FusedChain;
+
+// A chain for each stage.
+struct SeparateChains {
+    audio::StaticChain<audio::SampleGain> input;
+    audio::StaticChain<audio::SampleBiquad<3>> equalizer;
+    audio::StaticChain<audio::SampleDelay> delay;
+    audio::StaticChain<audio::SampleGain> output;
+
+    explicit SeparateChains(Stages *stages)
+            : input(stages->input),
+              equalizer(stages->equalizer),
+              delay(stages->delay),
+              output(stages->output) {
+    }
+
+    void Process(const audio::StereoBlock<float> &block) {
+        input.Process(block);
+        equalizer.Process(block);
+        delay.Process(block);
+        output.Process(block);
+    }
+};
+
+audio::StereoBlock<float> Block(std::vector<float> *left, std::vector<float> *right, unsigned int position, unsigned int length) {
+    audio::StereoBlock<float> block;
+    block.left = audio::ChannelSpan<float>(&(*left)[position], length);
+    block.right = audio::ChannelSpan<float>(&(*right)[position], length);
+    return block;
+}
+
+// Process the noise by the blocks of 128 samples. Return the left and right output.
+template<typename F>
+std::vector<float> Run(F process) {
+    const unsigned int kLength = 16 * 1024;
+    std::vector<float> left = hostsim::Noise(kLength, 1);
+    std::vector<float> right = hostsim::Noise(kLength, 2);
+    for (unsigned int position = 0; position < kLength; position += 128)
+        process(Block(&left, &right, position, 128));
+    left.insert(left.end(), right.begin(), right.end());
+    return left;
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int kRepeat = 2000;
+    bool is_passed = true;
+
+    // Reference by the separate passes.
+    Stages separate_stages;
+    SeparateChains separate(&separate_stages);
+    const std::vector<float> reference = Run([&](const audio::StereoBlock<float> &block) {
+        separate.Process(block);
+    });
+
+    Stages fused_stages;
+    FusedChain fused(fused_stages.input, fused_stages.equalizer, fused_stages.delay, fused_stages.output);
+    const std::vector<float> fused_output = Run([&](const audio::StereoBlock<float> &block) {
+        fused.Process(block);
+    });
+
+    Stages dynamic_stages;
+    SeparateChains dynamic_parts(&dynamic_stages);
+    audio::FloatProcessor *const parts[] = { &dynamic_parts.input, &dynamic_parts.equalizer, &dynamic_parts.delay, &dynamic_parts.output };
+    audio::DynamicChain dynamic;
+    dynamic.SetStages(parts, 4);
+    const std::vector<float> dynamic_output = Run([&](const audio::StereoBlock<float> &block) {
+        dynamic.Process(block);
+    });
+
+    const bool is_fused_ok = fused_output == reference;
+    const bool is_dynamic_ok = dynamic_output == reference;
+    std::printf("pipeline : fused chain against the separate passes %s\n", is_fused_ok ? "identical ok" : "FAILED");
+    std::printf("pipeline : dynamic chain against the separate passes %s\n", is_dynamic_ok ? "identical ok" : "FAILED");
+    is_passed = is_passed && is_fused_ok && is_dynamic_ok;
+
+    // Block stages. The calls of the StaticChain are resolved at compile time.
+    audio::SmoothedGain block_gain(256);
+    audio::BiquadCascade block_equalizer;
+    std::vector<float> dynamics_storage(audio::DynamicsProcessor::StorageSize(kLookahead));
+    audio::DynamicsProcessor block_dynamics(kLookahead, kSampleRate, dynamics_storage.data());
+    const audio::BiquadCoefficients bands[3] = {
+            audio::DesignBiquad(audio::kbtLowShelf, kSampleRate, 100.0f, 3.0f, 0.707f),
+            audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 3000.0f, -2.0f, 1.0f),
+            audio::DesignBiquad(audio::kbtHighShelf, kSampleRate, 10000.0f, 2.0f, 0.707f) };
+    block_equalizer.SetCoefficients(bands, 3);
+    block_gain.SetLevel(-6.0f);
+    block_dynamics.SetCompressor(-20.0f, 4.0f, 0.005f, 0.1f, 0.0f);
+    block_dynamics.SetLimiter(-1.0f, 0.05f);
+    audio::StaticChain<audio::SmoothedGain, audio::BiquadCascade, audio::DynamicsProcessor> block_chain(block_gain, block_equalizer,
+                                                                                                         block_dynamics);
+    audio::FloatProcessor *const block_parts[] = { &block_gain, &block_equalizer, &block_dynamics };
+    audio::DynamicChain block_dynamic;
+    block_dynamic.SetStages(block_parts, 3);
+
+    std::printf("pipeline : nS per sample, stereo\n");
+    std::printf("%8s%12s%12s%12s%14s%14s\n", "length", "fused", "separate", "dynamic", "block static", "block dynamic");
+    const unsigned int lengths[] = { 32, 128, 512 };
+    for (unsigned int length : lengths) {
+        const std::vector<float> noise_left = hostsim::Noise(length, 1);
+        const std::vector<float> noise_right = hostsim::Noise(length, 2);
+        std::vector<float> left(length);
+        std::vector<float> right(length);
+        const audio::StereoBlock<float> block = Block(&left, &right, 0, length);
+
+        // The input is restored for each measurement. Otherwise, the repeated processing makes the denormal numbers.
+        auto restore = [&]() {
+            std::memcpy(left.data(), noise_left.data(), length * sizeof(float));
+            std::memcpy(right.data(), noise_right.data(), length * sizeof(float));
+        };
+        const double restore_ns = hostsim::MeasureMin([&]() {
+            restore();
+            hostsim::DoNotOptimize(left.data());
+            hostsim::DoNotOptimize(right.data());
+        },
+                                                      kRepeat);
+        auto measure = [&](auto process) {
+            return (hostsim::MeasureMin([&]() {
+                restore();
+                process();
+                hostsim::DoNotOptimize(left.data());
+                hostsim::DoNotOptimize(right.data());
+            },
+                                        kRepeat) - restore_ns) / length;
+        };
+
+        const double fused_ns = measure([&]() {
+            fused.Process(block);
+        });
+        const double separate_ns = measure([&]() {
+            separate.Process(block);
+        });
+        const double dynamic_ns = measure([&]() {
+            dynamic.Process(block);
+        });
+        const double block_static_ns = measure([&]() {
+            block_chain.Process(block);
+        });
+        const double block_dynamic_ns = measure([&]() {
+            block_dynamic.Process(block);
+        });
+        std::printf("%8u%12.2f%12.2f%12.2f%14.2f%14.2f\n", length, fused_ns, separate_ns, dynamic_ns, block_static_ns, block_dynamic_ns);
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file q31.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of the Q31 arithmetic and audio::Q31Gain.
+ * @details
+ * At first, the following checks are done against the models in the 64bit integer and the double.
+ * The program fails if one of them fails. The host runs the reference implementation of q31.hpp.
+ * The target instructions are compared with the reference by audio::SelfTestQ31() on the target.
+ * @li Add / Sub : Saturation of the sum and the difference, over the random values and the corners.
+ * @li Multiply : Floor of the product to 31 fractional bits, with saturation. -1 * -1 saturates.
+ * @li Shift : x * 2^shift with saturation, for all shifts, including the overflow of INT32_MIN.
+ * @li FloatToQ31 : Truncation toward zero, saturation at +-1.0 and over, NaN to zero, and the round trip
+ *     with Q31ToFloat().
+ * @li Q31Gain : The unity gain and the gains of the power of 2 are exact. The other gains are within
+ *     the quantization of the gain and the product. The output saturates.
+ *
+ * Then, the time per sample of audio::Q31Gain is compared with the float gain on the same block.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "bench.hpp"
+#include "q31.hpp"
+#include "q31gain.hpp"
+
+namespace {
+
+const audio::q31_t kCorners[] = { INT32_MIN, INT32_MIN + 1, -0x40000000, -2, -1, 0, 1, 2, 0x40000000, INT32_MAX - 1, INT32_MAX };
+
+// Deterministic random Q31 values, with the corners first.
+std::vector<audio::q31_t> Values(unsigned int count) {
+    std::vector<audio::q31_t> values(std::begin(kCorners), std::end(kCorners));
+    uint32_t seed = 12345;
+    while (values.size() < count) {
+        seed = seed * 1664525u + 1013904223u;
+        values.push_back(static_cast<audio::q31_t>(seed));
+    }
+    return values;
+}
+
+int64_t Clamp(int64_t x) {
+    return x > INT32_MAX ? INT32_MAX : (x < INT32_MIN ? INT32_MIN : x);
+}
+
+// Floor of x / 2^31, by the division.
+int64_t FloorDiv31(int64_t x) {
+    const int64_t divisor = static_cast<int64_t>(1) << 31;
+    int64_t q = x / divisor;
+    if (x % divisor != 0 && x < 0)
+        q--;
+    return q;
+}
+
+bool CheckAddSub() {
+    const std::vector<audio::q31_t> values = Values(2000);
+    bool is_ok = true;
+    for (audio::q31_t a : values)
+        for (audio::q31_t b : values) {
+            if (audio::SaturatingAdd(a, b) != Clamp(static_cast<int64_t>(a) + b))
+                is_ok = false;
+            if (audio::SaturatingSub(a, b) != Clamp(static_cast<int64_t>(a) - b))
+                is_ok = false;
+        }
+    std::printf("q31 : add and sub %s\n", is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+bool CheckMultiply() {
+    const std::vector<audio::q31_t> values = Values(2000);
+    bool is_ok = true;
+    double max_error = 0;
+    for (audio::q31_t a : values)
+        for (audio::q31_t b : values) {
+            const audio::q31_t product = audio::MultiplyQ31(a, b);
+            if (product != Clamp(FloorDiv31(static_cast<int64_t>(a) * b)))
+                is_ok = false;
+            // Error against the exact product, out of the saturation.
+            if (!(a == INT32_MIN && b == INT32_MIN)) {
+                // In the 64bit integer. The double can't hold the product.
+                const int64_t remainder = static_cast<int64_t>(a) * b - static_cast<int64_t>(product) * (static_cast<int64_t>(1) << 31);
+                const double error = std::ldexp(static_cast<double>(std::llabs(remainder)), -31);
+                if (error > max_error)
+                    max_error = error;
+            }
+        }
+    // -1 * -1 is +1, out of the range.
+    is_ok = is_ok && audio::MultiplyQ31(INT32_MIN, INT32_MIN) == INT32_MAX;
+    is_ok = is_ok && audio::MultiplyQ31(INT32_MIN, INT32_MAX) == INT32_MIN + 1;
+    is_ok = is_ok && audio::MultiplyQ31(INT32_MAX, INT32_MAX) == INT32_MAX - 1;
+    is_ok = is_ok && audio::MultiplyQ31(INT32_MIN, -1) == 1;
+    is_ok = is_ok && audio::MultiplyQ31(-1, 1) == -1;
+    // The truncation loses less than 1 LSB.
+    is_ok = is_ok && max_error < 1.0;
+
+    std::printf("q31 : multiply max error %.10f LSB %s\n", max_error, is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+bool CheckShift() {
+    const std::vector<audio::q31_t> values = Values(2000);
+    bool is_ok = true;
+    for (audio::q31_t x : values)
+        for (unsigned int shift = 0; shift < 32; shift++) {
+            const double expected = std::fmax(std::fmin(std::ldexp(static_cast<double>(x), shift), INT32_MAX), INT32_MIN);
+            if (audio::SaturatingShiftLeft(x, shift) != static_cast<audio::q31_t>(expected))
+                is_ok = false;
+        }
+    is_ok = is_ok && audio::SaturatingShiftLeft(INT32_MIN, 1) == INT32_MIN;
+    is_ok = is_ok && audio::SaturatingShiftLeft(INT32_MIN, 31) == INT32_MIN;
+    is_ok = is_ok && audio::SaturatingShiftLeft(1, 31) == INT32_MAX;
+    is_ok = is_ok && audio::SaturatingShiftLeft(-1, 31) == INT32_MIN;
+
+    std::printf("q31 : shift %s\n", is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Truncation toward zero with saturation, in double.
+audio::q31_t FloatModel(float x) {
+    if (std::isnan(x))
+        return 0;
+    const double scaled = std::trunc(static_cast<double>(x) * 2147483648.0);
+    return static_cast<audio::q31_t>(std::fmax(std::fmin(scaled, INT32_MAX), INT32_MIN));
+}
+
+bool CheckFloat() {
+    const float corners[] = { 1.0f, -1.0f, 2.0f, -2.0f, std::nextafter(1.0f, 0.0f), std::nextafter(-1.0f, 0.0f), 0.0f, -0.0f, 1e-10f, -1e-10f,
+            std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+    bool is_ok = true;
+    for (float x : corners)
+        if (audio::FloatToQ31(x) != FloatModel(x))
+            is_ok = false;
+    is_ok = is_ok && audio::FloatToQ31(1.0f) == INT32_MAX;
+    is_ok = is_ok && audio::FloatToQ31(-1.0f) == INT32_MIN;
+    is_ok = is_ok && audio::FloatToQ31(std::numeric_limits<float>::quiet_NaN()) == 0;
+    is_ok = is_ok && audio::FloatToQ31(-std::numeric_limits<float>::quiet_NaN()) == 0;
+
+    const std::vector<float> noise = hostsim::Noise(100000, 3);
+    for (float x : noise)
+        if (audio::FloatToQ31(x) != FloatModel(x) || audio::FloatToQ31(2.0f * x) != FloatModel(2.0f * x))
+            is_ok = false;
+
+    // Q31 to float rounds to nearest, by the double model. The round trip is exact for the float values.
+    for (audio::q31_t x : Values(100000)) {
+        const float y = audio::Q31ToFloat(x);
+        if (y != static_cast<float>(std::ldexp(static_cast<double>(x), -31)))
+            is_ok = false;
+        if (y < 1.0f && audio::FloatToQ31(audio::Q31ToFloat(audio::FloatToQ31(y))) != audio::FloatToQ31(y))
+            is_ok = false;
+    }
+
+    std::printf("q31 : float conversion %s\n", is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Apply a gain to the copies of the values in both channels, by the block of 128 samples. Returns the left.
+std::vector<audio::q31_t> ApplyGain(audio::Q31Gain *gain, const std::vector<audio::q31_t> &values, std::vector<audio::q31_t> *right_output =
+                                            nullptr) {
+    const unsigned int kLength = 128;
+    std::vector<audio::q31_t> left(values);
+    std::vector<audio::q31_t> right(values);
+    for (unsigned int offset = 0; offset + kLength <= values.size(); offset += kLength) {
+        audio::StereoBlock<audio::q31_t> block;
+        block.left = audio::ChannelSpan<audio::q31_t>(&left[offset], kLength);
+        block.right = audio::ChannelSpan<audio::q31_t>(&right[offset], kLength);
+        gain->Process(block);
+    }
+    if (nullptr != right_output)
+        *right_output = right;
+    return left;
+}
+
+bool CheckGain() {
+    const std::vector<audio::q31_t> values = Values(128 * 64);
+    bool is_ok = true;
+
+    // Unity by the constructor and by 0dB. Bit exact.
+    audio::Q31Gain gain;
+    is_ok = ApplyGain(&gain, values) == values && is_ok;
+    gain.SetLevel(0.0f);
+    is_ok = ApplyGain(&gain, values) == values && is_ok;
+
+    // Power of 2. Exact with saturation.
+    gain.SetGain(4.0f, 4.0f);
+    std::vector<audio::q31_t> output = ApplyGain(&gain, values);
+    for (unsigned int i = 0; i < values.size(); i++)
+        is_ok = output[i] == Clamp(static_cast<int64_t>(values[i]) * 4) && is_ok;
+
+    // Each channel has its own gain.
+    gain.SetGain(1.0f, 2.0f);
+    std::vector<audio::q31_t> right;
+    is_ok = ApplyGain(&gain, values, &right) == values && is_ok;
+    for (unsigned int i = 0; i < values.size(); i++)
+        is_ok = right[i] == Clamp(static_cast<int64_t>(values[i]) * 2) && is_ok;
+
+    // Other gains. Within the quantization of the gain and the product, and saturated.
+    const float gains[] = { 0.0f, 0.3f, 0.5f, 0.999f, 1.7f, 100.0f };
+    double max_error = 0;
+    for (float g : gains) {
+        gain.SetGain(g, g);
+        output = ApplyGain(&gain, values);
+        for (unsigned int i = 0; i < values.size(); i++) {
+            const double expected = std::fmax(std::fmin(static_cast<double>(values[i]) * g, INT32_MAX), INT32_MIN);
+            const double error = std::fabs(output[i] - expected) / std::fmax(1.0, g);
+            if (error > max_error)
+                max_error = error;
+        }
+    }
+    is_ok = is_ok && max_error < 4.0;
+
+    std::printf("q31 : gain max error %.2f LSB of the gain %s\n", max_error, is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Time per sample [nS]. The shortest of the repeats.
+template<typename F>
+double MeasureSample(F process, unsigned int samples) {
+    double min = 1e300;
+    for (unsigned int repeat = 0; repeat < 1000; repeat++) {
+        const auto begin = std::chrono::steady_clock::now();
+        process();
+        const auto end = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - begin).count() / samples;
+        if (ns < min)
+            min = ns;
+    }
+    return min;
+}
+
+}  // namespace
+
+int main() {
+    bool is_passed = true;
+    is_passed = CheckAddSub() && is_passed;
+    is_passed = CheckMultiply() && is_passed;
+    is_passed = CheckShift() && is_passed;
+    is_passed = CheckFloat() && is_passed;
+    is_passed = CheckGain() && is_passed;
+    const bool is_self_test_ok = audio::SelfTestQ31();
+    std::printf("q31 : self test %s\n", is_self_test_ok ? "ok" : "FAILED");
+    is_passed = is_self_test_ok && is_passed;
+
+    const unsigned int kLength = 128;
+    std::vector<audio::q31_t> q31_samples = Values(2 * kLength);
+    std::vector<float> float_samples = hostsim::Noise(2 * kLength, 1);
+    audio::StereoBlock<audio::q31_t> q31_block;
+    q31_block.left = audio::ChannelSpan<audio::q31_t>(&q31_samples[0], kLength);
+    q31_block.right = audio::ChannelSpan<audio::q31_t>(&q31_samples[kLength], kLength);
+
+    audio::Q31Gain gain;
+    gain.SetGain(0.999f, 0.999f);
+    const double q31_ns = MeasureSample([&]() {
+        gain.Process(q31_block);
+        hostsim::DoNotOptimize(q31_samples.data());
+    },
+                                        2 * kLength);
+    const double float_ns = MeasureSample([&]() {
+        for (unsigned int i = 0; i < 2 * kLength; i++)
+            float_samples[i] *= 0.999f;
+        hostsim::DoNotOptimize(float_samples.data());
+    },
+                                          2 * kLength);
+    std::printf("q31 : gain time per sample [nS], Q31Gain %.2f, float %.2f\n", q31_ns, float_ns);
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file resampler.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::PolyphaseResampler and audio::ResamplingStage.
+ * @details
+ * At first, the accuracy is measured for each conversion. The program fails if any of them is out of
+ * the tolerance.
+ * @li THD+N : Residual of the sine at -6dBFS, after the least squares fit of the sine at the output rate.
+ *     At 1kHz, and at 0.36 of the lower rate where the images of the interpolation are the largest.
+ * @li Passband ripple : Gain of the sine from 20Hz to 0.38 of the lower rate.
+ * @li Alias rejection : Output of the sine between the Nyquist frequency of the lower rate and 0.5 of the input rate.
+ *
+ * The adaptive ratio is measured by the ratio off by 100ppm from 44.1kHz, and the round trip of
+ * the ResamplingStage by the block lengths of 32, 128 and 512 samples.
+ *
+ * Then, the time per output sample of the conversions, and the time per block of the round trip are printed.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "resampler.hpp"
+
+namespace {
+
+const unsigned int kSettle = 256;    // Samples skipped before the measurement.
+const double kPi = 3.14159265358979323846;
+
+// Same tables as the murasaki_platform.cpp defines.
+constexpr audio::ResamplerTable<48000, 44100> k48To44(48000, 44100);
+constexpr audio::ResamplerTable<44100, 48000> k44To48(44100, 48000);
+constexpr audio::ResamplerTable<48000, 96000> k48To96(48000, 96000);
+constexpr audio::ResamplerTable<96000, 48000> k96To48(96000, 48000);
+
+struct Conversion {
+    const char *name;
+    const audio::PolyphaseFilter filter;
+    unsigned int input_rate;
+    unsigned int output_rate;
+    bool is_adaptive;
+};
+
+std::vector<float> Sine(double frequency, double rate, unsigned int length) {
+    std::vector<float> x(length);
+    for (unsigned int n = 0; n < length; n++)
+        x[n] = static_cast<float>(0.5 * std::sin(2.0 * kPi * frequency * n / rate));
+    return x;
+}
+
+// Output rate seen from the input. The adaptive ratio is rounded as SetAdaptiveRatio() does.
+double EffectiveRate(const Conversion &c) {
+    if (!c.is_adaptive)
+        return c.output_rate;
+    const float ratio = static_cast<float>(c.input_rate) / c.output_rate;
+    return c.input_rate / (static_cast<uint32_t>(ratio * (1u << 20) + 0.5f) / static_cast<double>(1u << 20));
+}
+
+// Convert a mono signal, block by block.
+std::vector<float> Convert(const Conversion &c, const std::vector<float> &input, unsigned int block_length) {
+    std::vector<float> storage(audio::PolyphaseResampler::StorageSize(c.filter.taps, block_length));
+    audio::PolyphaseResampler resampler(c.filter, block_length, storage.data());
+    if (c.is_adaptive)
+        resampler.SetAdaptiveRatio(static_cast<float>(c.input_rate) / c.output_rate);
+    else
+        resampler.SetRatio(c.input_rate, c.output_rate);
+
+    std::vector<float> output;
+    std::vector<float> left(resampler.MaxOutput(block_length)), right(left.size());
+    std::vector<float> in(input);
+    for (unsigned int position = 0; position + block_length <= in.size(); position += block_length) {
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(&in[position], block_length);
+        block.right = audio::ChannelSpan<float>(&in[position], block_length);
+        const unsigned int count = resampler.Process(block, left.data(), right.data());
+        output.insert(output.end(), left.begin(), left.begin() + count);
+    }
+    return output;
+}
+
+// Least squares fit of a sin + b cos + c. Return the amplitude, and the RMS of the residual.
+void FitSine(const std::vector<float> &y, unsigned int first, double frequency, double rate, double *amplitude, double *residual) {
+    double m[3][4] = { };
+    for (unsigned int n = first; n < y.size(); n++) {
+        const double basis[3] = { std::sin(2.0 * kPi * frequency * n / rate), std::cos(2.0 * kPi * frequency * n / rate), 1.0 };
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++)
+                m[i][j] += basis[i] * basis[j];
+            m[i][3] += basis[i] * y[n];
+        }
+    }
+    // Gauss-Jordan elimination.
+    for (int c = 0; c < 3; c++)
+        for (int r = 0; r < 3; r++)
+            if (r != c) {
+                const double f = m[r][c] / m[c][c];
+                for (int k = c; k < 4; k++)
+                    m[r][k] -= f * m[c][k];
+            }
+    const double a = m[0][3] / m[0][0], b = m[1][3] / m[1][1], dc = m[2][3] / m[2][2];
+    double sum = 0.0;
+    for (unsigned int n = first; n < y.size(); n++) {
+        const double e = y[n] - (a * std::sin(2.0 * kPi * frequency * n / rate) + b * std::cos(2.0 * kPi * frequency * n / rate) + dc);
+        sum += e * e;
+    }
+    *amplitude = std::sqrt(a * a + b * b);
+    *residual = std::sqrt(sum / (y.size() - first));
+}
+
+double Decibel(double x) {
+    return 20.0 * std::log10(x);
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int kLength = 24000;
+    const unsigned int kBlockLength = 128;
+    const double kThdnLimit = -90.0;
+    const double kHighThdnLimit = -85.0;
+    const double kRippleLimit = 0.05;
+    const double kAliasLimit = -70.0;
+    bool is_passed = true;
+
+    const Conversion conversions[] = {
+            { "48000 -> 44100", audio::PolyphaseFilter(k48To44), 48000, 44100, false },
+            { "44100 -> 48000", audio::PolyphaseFilter(k44To48), 44100, 48000, false },
+            { "48000 -> 96000", audio::PolyphaseFilter(k48To96), 48000, 96000, false },
+            { "96000 -> 48000", audio::PolyphaseFilter(k96To48), 96000, 48000, false },
+            { "48000 -> 44104 adaptive", audio::PolyphaseFilter(k48To44), 48000, 44104, true },
+    };
+
+    std::printf("resampler : THD+N at 1kHz and 0.36 of the lower rate [dB], passband ripple [dB], alias rejection [dB]\n");
+    for (const Conversion &c : conversions) {
+        const double lower = (c.input_rate < c.output_rate) ? c.input_rate : c.output_rate;
+        double amplitude, residual;
+
+        FitSine(Convert(c, Sine(1000.0, c.input_rate, kLength), kBlockLength), kSettle, 1000.0, EffectiveRate(c), &amplitude, &residual);
+        const double thdn = Decibel(residual / (amplitude / std::sqrt(2.0)));
+
+        // Near the passband edge, the images of the interpolation appear in the residual.
+        FitSine(Convert(c, Sine(0.36 * lower, c.input_rate, kLength), kBlockLength), kSettle, 0.36 * lower, EffectiveRate(c), &amplitude, &residual);
+        const double thdn_high = Decibel(residual / (amplitude / std::sqrt(2.0)));
+
+        double minimum = 1e9, maximum = -1e9;
+        for (double f = 20.0; f <= 0.38 * lower; f *= 1.25) {
+            FitSine(Convert(c, Sine(f, c.input_rate, kLength), kBlockLength), kSettle, f, EffectiveRate(c), &amplitude, &residual);
+            minimum = std::fmin(minimum, Decibel(amplitude / 0.5));
+            maximum = std::fmax(maximum, Decibel(amplitude / 0.5));
+        }
+        const double ripple = maximum - minimum;
+
+        // The output of the sine above the Nyquist frequency of the lower rate is the alias.
+        double alias = -1e9;
+        for (double f = 0.5 * lower * 1.01; f < 0.5 * c.input_rate; f += 0.01 * lower) {
+            const std::vector<float> y = Convert(c, Sine(f, c.input_rate, kLength), kBlockLength);
+            double sum = 0.0;
+            for (unsigned int n = kSettle; n < y.size(); n++)
+                sum += static_cast<double>(y[n]) * y[n];
+            alias = std::fmax(alias, Decibel(std::sqrt(sum / (y.size() - kSettle)) / (0.5 / std::sqrt(2.0))));
+        }
+        if (c.input_rate <= c.output_rate)
+            alias = -1e9;    // No alias by the interpolation.
+
+        const bool is_ok = thdn <= kThdnLimit && thdn_high <= kHighThdnLimit && ripple <= kRippleLimit && alias <= kAliasLimit;
+        if (alias > -1e9)
+            std::printf("%26s : %8.1f %8.1f %8.4f %8.1f %s\n", c.name, thdn, thdn_high, ripple, alias, is_ok ? "ok" : "FAILED");
+        else
+            std::printf("%26s : %8.1f %8.1f %8.4f %8s %s\n", c.name, thdn, thdn_high, ripple, "-", is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("resampler : round trip by ResamplingStage, THD+N [dB], underruns, latency [samples]\n");
+    const unsigned int processing_rates[] = { 44100, 96000 };
+    const unsigned int block_lengths[] = { 32, 128, 512 };
+    for (unsigned int rate : processing_rates) {
+        const audio::PolyphaseFilter to_processing = (rate == 44100) ? audio::PolyphaseFilter(k48To44) : audio::PolyphaseFilter(k48To96);
+        const audio::PolyphaseFilter to_codec = (rate == 44100) ? audio::PolyphaseFilter(k44To48) : audio::PolyphaseFilter(k96To48);
+        for (unsigned int block_length : block_lengths) {
+            std::vector<float> storage(audio::ResamplingStage::StorageSize(to_processing, to_codec, block_length, 48000, rate));
+            audio::ResamplingStage stage(to_processing, to_codec, block_length, 48000, rate, storage.data());
+            std::vector<float> left = Sine(1000.0, 48000, kLength);
+            std::vector<float> right(left);
+            for (unsigned int position = 0; position + block_length <= kLength; position += block_length) {
+                audio::StereoBlock<float> block;
+                block.left = audio::ChannelSpan<float>(&left[position], block_length);
+                block.right = audio::ChannelSpan<float>(&right[position], block_length);
+                stage.FromProcessingRate(stage.ToProcessingRate(block), block);
+            }
+            left.resize(kLength / block_length * block_length);
+            double amplitude, residual;
+            FitSine(left, stage.Latency() + kSettle, 1000.0, 48000, &amplitude, &residual);
+            const double thdn = Decibel(residual / (amplitude / std::sqrt(2.0)));
+            const bool is_ok = thdn <= kThdnLimit && stage.Underruns() == 0;
+            std::printf("  48000 -> %5u -> 48000, block %3u : %8.1f %4u %4u %s\n", rate, block_length, thdn, stage.Underruns(),
+                        stage.Latency(), is_ok ? "ok" : "FAILED");
+            is_passed = is_passed && is_ok;
+        }
+    }
+
+    std::printf("resampler : nS per output sample, stereo\n");
+    for (const Conversion &c : conversions) {
+        std::vector<float> storage(audio::PolyphaseResampler::StorageSize(c.filter.taps, kBlockLength));
+        audio::PolyphaseResampler resampler(c.filter, kBlockLength, storage.data());
+        resampler.SetRatio(c.input_rate, c.output_rate);
+        std::vector<float> left = hostsim::Noise(kBlockLength, 1);
+        std::vector<float> right = hostsim::Noise(kBlockLength, 2);
+        std::vector<float> out_left(resampler.MaxOutput(kBlockLength)), out_right(out_left.size());
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(left.data(), kBlockLength);
+        block.right = audio::ChannelSpan<float>(right.data(), kBlockLength);
+        unsigned int count = 0;
+        const double ns = hostsim::MeasureMin([&]() {
+            count = resampler.Process(block, out_left.data(), out_right.data());
+            hostsim::DoNotOptimize(out_left.data());
+            hostsim::DoNotOptimize(out_right.data());
+        },
+                                              1000);
+        std::printf("%26s : %8.2f, %u phases x %u taps\n", c.name, ns / count, c.filter.phases, c.filter.taps);
+    }
+
+    std::printf("resampler : uS per round trip of a block of %u samples. Block period %.1f uS\n", kBlockLength, 1e6 * kBlockLength / 48000);
+    for (unsigned int rate : processing_rates) {
+        const audio::PolyphaseFilter to_processing = (rate == 44100) ? audio::PolyphaseFilter(k48To44) : audio::PolyphaseFilter(k48To96);
+        const audio::PolyphaseFilter to_codec = (rate == 44100) ? audio::PolyphaseFilter(k44To48) : audio::PolyphaseFilter(k96To48);
+        std::vector<float> storage(audio::ResamplingStage::StorageSize(to_processing, to_codec, kBlockLength, 48000, rate));
+        audio::ResamplingStage stage(to_processing, to_codec, kBlockLength, 48000, rate, storage.data());
+        std::vector<float> left = hostsim::Noise(kBlockLength, 1);
+        std::vector<float> right = hostsim::Noise(kBlockLength, 2);
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(left.data(), kBlockLength);
+        block.right = audio::ChannelSpan<float>(right.data(), kBlockLength);
+        const double ns = hostsim::MeasureMin([&]() {
+            stage.FromProcessingRate(stage.ToProcessingRate(block), block);
+            hostsim::DoNotOptimize(left.data());
+            hostsim::DoNotOptimize(right.data());
+        },
+                                              1000);
+        std::printf("  48000 -> %5u -> 48000 : %8.2f\n", rate, ns / 1000.0);
+    }
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
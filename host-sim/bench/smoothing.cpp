@@ -0,0 +1,243 @@
+/**
+ * @file smoothing.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::Ramp, audio::SmoothedGain and the coefficient interpolation of audio::BiquadCascade.
+ * @details
+ * At first, the followings are checked. The program fails if any of them is out of the tolerance.
+ * @li Linear ramp against the straight line, and exponential ramp against the straight line in dB.
+ * Both must end exactly at the target.
+ * @li Click by the change of the gain and the equalizer at the block boundary. The click is the
+ * largest second difference of the output of a 1kHz sine after the change, relative to the one before
+ * the change. The ramp must reduce the click of the jump by kMinReduction or more. The ramp itself
+ * leaves a few dB, by the bend of the parameter at the start and the end of the ramp.
+ *
+ * Then, the time per sample is printed for the stages while idle and while moving.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bench.hpp"
+#include "biquad.hpp"
+#include "smoothing.hpp"
+
+namespace {
+
+const float kSampleRate = 48000.0f;
+const unsigned int kBlockLength = 128;
+const unsigned int kRampLength = 256;
+const double kPi = 3.14159265358979;
+const double kMinReduction = 12.0;     // [dB]
+const unsigned int kChangePosition = 3 * kBlockLength;
+
+// Max error of the ramp values generated by the chunks of the varying length.
+double RampError(audio::RampShape shape, float from, float to, bool *is_exact) {
+    const unsigned int kLength = 1000;
+    audio::Ramp ramp(from);
+    ramp.SetTarget(to, kLength, shape);
+
+    const unsigned int counts[] = { 1, 7, 16, 3, 11 };
+    std::vector<float> values;
+    for (unsigned int i = 0; values.size() < kLength + 20; i++) {
+        float chunk[audio::Ramp::kChunk];
+        ramp.Generate(chunk, counts[i % 5]);
+        values.insert(values.end(), chunk, chunk + counts[i % 5]);
+    }
+
+    double error = 0.0;
+    for (unsigned int i = 0; i < kLength; i++) {
+        const double t = (i + 1.0) / kLength;
+        if (audio::krsLinear == shape)
+            error = std::fmax(error, std::fabs(values[i] - (from + (to - from) * t)));
+        else
+            error = std::fmax(error, std::fabs(20.0 * std::log10(values[i] / from) - 20.0 * std::log10(to / from) * t));
+    }
+    *is_exact = !ramp.IsActive() && ramp.Value() == to;
+    for (unsigned int i = kLength; i < values.size(); i++)
+        *is_exact = *is_exact && values[i] == to;
+    return error;
+}
+
+// 1kHz sine of amplitude 0.5. The peak is at every 48 samples.
+std::vector<float> Sine(unsigned int length) {
+    std::vector<float> sine(length);
+    for (unsigned int i = 0; i < length; i++)
+        sine[i] = static_cast<float>(0.5 * std::cos(2.0 * kPi * 1000.0 * i / kSampleRate));
+    return sine;
+}
+
+// Largest second difference from the position to the end.
+double SecondDifference(const std::vector<float> &output, unsigned int begin, unsigned int end) {
+    double peak = 0.0;
+    for (unsigned int i = begin; i < end; i++)
+        peak = std::fmax(peak, std::fabs(output[i] - 2.0 * output[i - 1] + output[i - 2]));
+    return peak;
+}
+
+// Click after the change, relative to the steady output in the block before the change [dB].
+double Click(const std::vector<float> &output) {
+    const double steady = SecondDifference(output, kChangePosition - kBlockLength, kChangePosition);
+    return 20.0 * std::log10(SecondDifference(output, kChangePosition, output.size()) / steady);
+}
+
+// Process the sine by the blocks. The change is done by the function before the block at kChangePosition.
+template<typename F>
+std::vector<float> RunWithChange(audio::FloatProcessor *stage, F change) {
+    std::vector<float> left = Sine(8 * kBlockLength);
+    std::vector<float> right = Sine(8 * kBlockLength);
+    for (unsigned int top = 0; top < left.size(); top += kBlockLength) {
+        if (top == kChangePosition)
+            change();
+        audio::StereoBlock<float> block;
+        block.left = audio::ChannelSpan<float>(&left[top], kBlockLength);
+        block.right = audio::ChannelSpan<float>(&right[top], kBlockLength);
+        stage->Process(block);
+    }
+    return left;
+}
+
+double GainClick(unsigned int ramp_length) {
+    audio::SmoothedGain gain(ramp_length);
+    // The sine is at the peak at the change. Then, the jump is the largest.
+    const std::vector<float> output = RunWithChange(&gain, [&gain]() {
+        gain.SetLevel(-20.0f);
+    });
+    return Click(output);
+}
+
+double EqualizerClick(unsigned int ramp_length) {
+    audio::BiquadCascade equalizer(ramp_length);
+    const audio::BiquadCoefficients boost = audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 1000.0f, 12.0f, 1.0f);
+    const audio::BiquadCoefficients cut = audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 1000.0f, -12.0f, 1.0f);
+    equalizer.SetCoefficients(&boost, 1);
+    const std::vector<float> output = RunWithChange(&equalizer, [&equalizer, &cut]() {
+        equalizer.SetCoefficients(&cut, 1);
+    });
+    return Click(output);
+}
+
+}  // namespace
+
+int main() {
+    const unsigned int kRepeat = 2000;
+    bool is_passed = true;
+
+    std::printf("smoothing : ramp error against the straight line\n");
+    struct RampCase {
+        audio::RampShape shape;
+        float from;
+        float to;
+        const char *name;
+        const char *unit;
+        double tolerance;
+    };
+    const RampCase ramps[] = {
+            { audio::krsLinear, 0.0f, 1.0f, "linear 0 to 1", "", 1e-5 },
+            { audio::krsLinear, 1.0f, -0.5f, "linear 1 to -0.5", "", 1e-5 },
+            { audio::krsExponential, 1.0f, 0.01f, "exponential 0dB to -40dB", "dB", 0.01 },
+            { audio::krsExponential, 0.1f, 2.0f, "exponential -20dB to +6dB", "dB", 0.01 },
+    };
+    for (const RampCase &ramp : ramps) {
+        bool is_exact;
+        const double error = RampError(ramp.shape, ramp.from, ramp.to, &is_exact);
+        const bool is_ok = error < ramp.tolerance && is_exact;
+        std::printf("  %-28s : max error %9.2e %-2s, end %s %s\n", ramp.name, error, ramp.unit, is_exact ? "exact" : "NOT EXACT",
+                    is_ok ? "ok" : "FAILED");
+        is_passed = is_passed && is_ok;
+    }
+
+    std::printf("smoothing : click at the change, relative to the output before the change [dB]\n");
+    const double gain_jump = GainClick(0);
+    const double gain_ramp = GainClick(kRampLength);
+    const double equalizer_jump = EqualizerClick(0);
+    const double equalizer_ramp = EqualizerClick(kRampLength);
+    const bool is_gain_ok = gain_ramp < gain_jump - kMinReduction;
+    const bool is_equalizer_ok = equalizer_ramp < equalizer_jump - kMinReduction;
+    std::printf("  gain 0dB to -20dB      : jump %6.1f, ramp of %u samples %6.1f %s\n", gain_jump, kRampLength, gain_ramp,
+                is_gain_ok ? "ok" : "FAILED");
+    std::printf("  peaking +12dB to -12dB : jump %6.1f, ramp of %u samples %6.1f %s\n", equalizer_jump, kRampLength, equalizer_ramp,
+                is_equalizer_ok ? "ok" : "FAILED");
+    is_passed = is_passed && is_gain_ok && is_equalizer_ok;
+
+    std::printf("smoothing : nS per sample, stereo, block length %u\n", kBlockLength);
+    const std::vector<float> noise_left = hostsim::Noise(kBlockLength, 1);
+    const std::vector<float> noise_right = hostsim::Noise(kBlockLength, 2);
+    std::vector<float> left(kBlockLength);
+    std::vector<float> right(kBlockLength);
+    audio::StereoBlock<float> block;
+    block.left = audio::ChannelSpan<float>(left.data(), kBlockLength);
+    block.right = audio::ChannelSpan<float>(right.data(), kBlockLength);
+    // The input is restored for each measurement. Otherwise, the repeated gain makes the denormal numbers.
+    auto restore = [&]() {
+        left = noise_left;
+        right = noise_right;
+    };
+    const double restore_ns = hostsim::MeasureMin([&]() {
+        restore();
+        hostsim::DoNotOptimize(left.data());
+        hostsim::DoNotOptimize(right.data());
+    },
+                                                  kRepeat);
+    auto measure = [&](audio::FloatProcessor *stage, auto change) {
+        return (hostsim::MeasureMin([&]() {
+            restore();
+            change();
+            stage->Process(block);
+            hostsim::DoNotOptimize(left.data());
+            hostsim::DoNotOptimize(right.data());
+        },
+                                    kRepeat) - restore_ns) / kBlockLength;
+    };
+
+    // The ramp longer than the block. Then, the whole block is in the ramp.
+    const unsigned int kLongRamp = 1u << 30;
+    audio::SmoothedGain unity(kLongRamp);
+    const double unity_ns = measure(&unity, []() {
+    });
+    audio::SmoothedGain fixed(0);
+    fixed.SetLevel(-6.0f);
+    const double fixed_ns = measure(&fixed, []() {
+    });
+    audio::SmoothedGain linear(kLongRamp, audio::krsLinear);
+    linear.SetGain(0.5f);
+    const double linear_ns = measure(&linear, []() {
+    });
+    audio::SmoothedGain exponential(kLongRamp, audio::krsExponential);
+    exponential.SetGain(0.5f);
+    const double exponential_ns = measure(&exponential, []() {
+    });
+
+    // Same bands as SetEqualizer() of the murasaki_platform.cpp, and the bands by the different gains.
+    const audio::BiquadCoefficients bands[2][3] = {
+            { audio::DesignBiquad(audio::kbtLowShelf, kSampleRate, 100.0f, 3.0f, 0.707f),
+                    audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 3000.0f, -2.0f, 1.0f),
+                    audio::DesignBiquad(audio::kbtHighShelf, kSampleRate, 10000.0f, 2.0f, 0.707f) },
+            { audio::DesignBiquad(audio::kbtLowShelf, kSampleRate, 100.0f, -3.0f, 0.707f),
+                    audio::DesignBiquad(audio::kbtPeaking, kSampleRate, 3000.0f, 2.0f, 1.0f),
+                    audio::DesignBiquad(audio::kbtHighShelf, kSampleRate, 10000.0f, -2.0f, 0.707f) } };
+    audio::BiquadCascade steady(kRampLength);
+    steady.SetCoefficients(bands[0], 3);
+    const double steady_ns = measure(&steady, []() {
+    });
+    audio::BiquadCascade moving(kLongRamp);
+    moving.SetCoefficients(bands[0], 3);
+    moving.Process(block);
+    unsigned int toggle = 0;
+    const double moving_ns = measure(&moving, [&]() {
+        toggle ^= 1;
+        moving.SetCoefficients(bands[toggle], 3);
+    });
+
+    std::printf("%36s%10.2f\n", "SmoothedGain, unity", unity_ns);
+    std::printf("%36s%10.2f\n", "SmoothedGain, fixed -6dB", fixed_ns);
+    std::printf("%36s%10.2f\n", "SmoothedGain, linear ramp", linear_ns);
+    std::printf("%36s%10.2f\n", "SmoothedGain, exponential ramp", exponential_ns);
+    std::printf("%36s%10.2f\n", "3 band equalizer, steady", steady_ns);
+    std::printf("%36s%10.2f\n", "3 band equalizer, interpolated", moving_ns);
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
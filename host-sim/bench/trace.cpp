@@ -0,0 +1,160 @@
+/**
+ * @file trace.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host benchmark of audio::TraceBuffer.
+ * @details
+ * At first, the following checks are done. The program fails if one of them fails.
+ * @li Format : The ID of AUDIO_TRACE() finds its format string in the section trace_formats.
+ * @li Wrap : Over the length of the ring, the latest records are kept with their sequences and arguments.
+ * @li Concurrent : Two writer threads, standing for the audio task and an interrupt, record into a ring.
+ *     The ring must hold the last record, without duplication, and each writer's records in order.
+ *
+ * Then, the time of the writer per record is compared between AUDIO_TRACE(), audio::LogRing::Log()
+ * and the formatting by snprintf().
+ *
+ * The records of the host simulation are dumped by its -t option, and decoded by tools/tracedecode.
+ */
+
+#define AUDIO_CONFIG_TRACE true
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "bench.hpp"
+#include "logring.hpp"
+#include "trace.hpp"
+
+namespace {
+
+const unsigned int kRecords = 64;
+const char kFormat[] = "Block %u : %lu cycles";
+
+typedef audio::TraceBuffer<kRecords> Trace;
+
+unsigned int Cycles() {
+    return static_cast<unsigned int>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool CheckFormat() {
+    const uint32_t block = AUDIO_TRACE_ID("Block %u : %lu cycles");
+    const uint32_t half = AUDIO_TRACE_ID("RX DMA half");
+    bool is_ok = block != half;
+    is_ok = is_ok && std::strcmp(__start_trace_formats + block, kFormat) == 0;
+    is_ok = is_ok && std::strcmp(__start_trace_formats + half, "RX DMA half") == 0;
+
+    std::printf("trace : format %s\n", is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+bool CheckWrap() {
+    Trace trace(&Cycles);
+    const unsigned int kWritten = kRecords * 3 / 2 + 5;
+    for (unsigned int i = 0; i < kWritten; i++)
+        AUDIO_TRACE(&trace, "Block %u : %lu cycles", i, static_cast<unsigned long>(i * 2));
+    const uint32_t id = trace.Records()[0].id;
+
+    bool is_ok = true;
+    for (unsigned int i = 0; i < kRecords; i++) {
+        const audio::TraceRecord &record = trace.Records()[i];
+        // The record i holds the latest written of i, i + kRecords, ...
+        const uint32_t written = i + (kWritten - 1 - i) / kRecords * kRecords;
+        if (record.sequence != written + 1 || record.id != id || record.args[0] != written || record.args[1] != written * 2
+                || record.args[2] != 0)
+            is_ok = false;
+    }
+    is_ok = is_ok && std::strcmp(__start_trace_formats + id, kFormat) == 0;
+
+    std::printf("trace : wrap %u records %s\n", kWritten, is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+bool CheckConcurrent() {
+    const unsigned int kWritten = 100000;
+    Trace trace(&Cycles);
+
+    auto writer = [&](unsigned int writer_id) {
+        for (unsigned int i = 0; i < kWritten; i++)
+            trace.Record(0, writer_id, i);
+    };
+    std::thread task(writer, 0);
+    std::thread interrupt(writer, 1);
+    task.join();
+    interrupt.join();
+
+    // Sort by the sequence, and check each writer's records in order.
+    audio::TraceRecord records[kRecords];
+    std::memcpy(records, trace.Records(), sizeof(records));
+    std::sort(records, records + kRecords, [](const audio::TraceRecord &a, const audio::TraceRecord &b) {
+        return a.sequence < b.sequence;
+    });
+    // A writer preempted for the length of the ring leaves an older record. Then, a gap.
+    bool is_ok = records[kRecords - 1].sequence == 2 * kWritten;
+    uint32_t next[2] = { 0, 0 };
+    for (unsigned int i = 0; i < kRecords; i++) {
+        const audio::TraceRecord &record = records[i];
+        if ((i != 0 && record.sequence == records[i - 1].sequence) || record.args[0] > 1 || record.args[1] < next[record.args[0]]) {
+            is_ok = false;
+            continue;
+        }
+        next[record.args[0]] = record.args[1] + 1;
+    }
+    // Both writers finish at their last record.
+    is_ok = is_ok && (next[0] == kWritten || next[1] == kWritten);
+
+    std::printf("trace : concurrent %u records %s\n", 2 * kWritten, is_ok ? "ok" : "FAILED");
+    return is_ok;
+}
+
+// Time per record of the writer [nS]. The shortest of the batches.
+template<typename F>
+double MeasureWriter(F write) {
+    const unsigned int kBatch = 32;
+    double min = 1e300;
+    for (unsigned int repeat = 0; repeat < 1000; repeat++) {
+        const auto begin = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < kBatch; i++)
+            write(i);
+        const auto end = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - begin).count() / kBatch;
+        if (ns < min)
+            min = ns;
+    }
+    return min;
+}
+
+}  // namespace
+
+int main() {
+    bool is_passed = true;
+    is_passed = CheckFormat() && is_passed;
+    is_passed = CheckWrap() && is_passed;
+    is_passed = CheckConcurrent() && is_passed;
+
+    // The clock of the trace is read in each record. The LogRing takes the same clock by the caller.
+    Trace trace(&Cycles);
+    audio::LogRing<kRecords> ring;
+    char text[96];
+    const double trace_ns = MeasureWriter([&](unsigned int i) {
+        AUDIO_TRACE(&trace, "Block %u : %lu cycles", i, 123456ul);
+    });
+    const double log_ns = MeasureWriter([&](unsigned int i) {
+        ring.Log(Cycles(), kFormat, i, 123456ul);
+        audio::LogEntry entry;
+        ring.Read(&entry);
+    });
+    const double format_ns = MeasureWriter([&](unsigned int i) {
+        std::snprintf(text, sizeof(text), kFormat, i, 123456ul);
+        hostsim::DoNotOptimize(text);
+    });
+    std::printf("trace : writer time per record [nS], AUDIO_TRACE() %.1f, Log() with Read() %.1f, snprintf() %.1f\n", trace_ns, log_ns,
+                format_ns);
+    std::printf("trace : %u bytes per record\n", static_cast<unsigned int>(sizeof(audio::TraceRecord)));
+
+    return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,46 @@
+/**
+ * @file FreeRTOS.h
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host replacement of the FreeRTOS.h.
+ * @details
+ * Only the types referred from the application are defined.
+ */
+
+#ifndef HOST_SIM_FREERTOS_H_
+#define HOST_SIM_FREERTOS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE ((BaseType_t) 0)
+#define pdTRUE ((BaseType_t) 1)
+#define portMAX_DELAY ((TickType_t) 0xffffffffUL)
+
+// The host has no context switch at the end of the interrupt. The woken thread runs by itself.
+#define portYIELD_FROM_ISR(x) ((void) (x))
+
+// Same as the FreeRTOSConfig.h of the boards.
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 5
+
+/**
+ * @brief Stand-in of the static task control block. The content is a dummy.
+ */
+typedef struct {
+    void *dummy;
+} StaticTask_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SIM_FREERTOS_H_ */
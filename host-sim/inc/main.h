@@ -0,0 +1,147 @@
+/**
+ * @file main.h
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host replacement of the main.h generated by CubeIDE.
+ * @details
+ * The murasaki_platform.cpp of each board includes main.h to get the HAL handle types
+ * and the GPIO names defined by the configurator. This file provides the same names
+ * for the host simulation. The union of the names used by all boards is defined here,
+ * so that one file serves every board.
+ */
+
+#ifndef HOST_SIM_MAIN_H_
+#define HOST_SIM_MAIN_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Stand-in of the HAL handles. Mostly, only the address of the handle is used by the
+ * platform file, so the content is a dummy.
+ */
+typedef struct {
+    int dummy;
+} UART_HandleTypeDef;
+
+typedef struct {
+    int dummy;
+} I2C_HandleTypeDef;
+
+/*
+ * The DMA handle has the callbacks called by the DMA interrupt, as like HAL.
+ * The stand-in DuplexAudio calls them at each block transfer.
+ */
+typedef struct __DMA_HandleTypeDef {
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+    void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+} DMA_HandleTypeDef;
+
+typedef struct {
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+} SAI_HandleTypeDef;
+
+typedef struct {
+    DMA_HandleTypeDef *hdmatx;
+    DMA_HandleTypeDef *hdmarx;
+} I2S_HandleTypeDef;
+
+typedef struct {
+    const char *name;
+} GPIO_TypeDef;
+
+typedef enum {
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+/*
+ * Stand-in of the HAL functions called by the platform file.
+ * The user button is never pushed. The circular DMA of the I2S is emulated by the simulation
+ * after both of the transmission and the reception are started. The DMA stop stops it, if running.
+ */
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai);
+HAL_StatusTypeDef HAL_I2S_DMAStop(I2S_HandleTypeDef *hi2s);
+HAL_StatusTypeDef HAL_I2S_Transmit_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2S_Receive_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData, uint16_t Size);
+
+/*
+ * Stand-in of the CMSIS intrinsics. Mask the emulated DMA interrupts.
+ */
+void __disable_irq(void);
+void __enable_irq(void);
+
+/*
+ * Stand-in of the IRQ numbers of the audio DMA, with the values of CMSIS.
+ */
+typedef enum {
+    DMA1_Channel3_IRQn = 13,    /* G431RB */
+    DMA1_Channel4_IRQn = 14
+} IRQn_Type;
+
+/*
+ * Stand-in of the CMSIS NVIC. The host has no NVIC. Returns 5, the priority of the DMA set by CubeIDE.
+ */
+uint32_t NVIC_GetPriority(IRQn_Type IRQn);
+
+extern GPIO_TypeDef host_gpioa;
+extern GPIO_TypeDef host_gpiob;
+extern GPIO_TypeDef host_gpioc;
+extern GPIO_TypeDef host_gpioe;
+
+/**
+ * @brief Core clock frequency [Hz].
+ * @details
+ * On the host, the cycle counter counts nanoseconds. Then, the core clock is 1GHz.
+ */
+extern uint32_t SystemCoreClock;
+
+#define GPIOA (&host_gpioa)
+#define GPIOB (&host_gpiob)
+#define GPIOC (&host_gpioc)
+#define GPIOE (&host_gpioe)
+
+#define GPIO_PIN_0 ((uint16_t)0x0001)
+#define GPIO_PIN_2 ((uint16_t)0x0004)
+#define GPIO_PIN_3 ((uint16_t)0x0008)
+#define GPIO_PIN_5 ((uint16_t)0x0020)
+#define GPIO_PIN_7 ((uint16_t)0x0080)
+#define GPIO_PIN_11 ((uint16_t)0x0800)
+#define GPIO_PIN_13 ((uint16_t)0x2000)
+
+/* Nucleo F722ZE + Akashi-02 */
+#define LD2_Pin GPIO_PIN_7
+#define LD2_GPIO_Port GPIOB
+#define ST0_Pin GPIO_PIN_0
+#define ST0_GPIO_Port GPIOE
+#define ST1_Pin GPIO_PIN_11
+#define ST1_GPIO_Port GPIOB
+#define USER_Btn_Pin GPIO_PIN_13
+#define USER_Btn_GPIO_Port GPIOC
+
+/* Nucleo G431RB + Akashi-04 */
+#define LED1_Pin GPIO_PIN_2
+#define LED1_GPIO_Port GPIOC
+#define LED2_Pin GPIO_PIN_3
+#define LED2_GPIO_Port GPIOC
+#define B1_Pin GPIO_PIN_13
+#define B1_GPIO_Port GPIOC
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SIM_MAIN_H_ */
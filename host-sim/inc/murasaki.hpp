@@ -0,0 +1,369 @@
+/**
+ * @file murasaki.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host stand-in of the murasaki class library.
+ * @details
+ * This file provides the subset of the murasaki API used by murasaki_platform.cpp,
+ * so that the platform file of each board can be compiled and run on the host without modification.
+ *
+ * The stand-in classes keep the same names, constructors and member functions as the
+ * library. The audio classes exchange the samples with the WAV files managed by
+ * @ref hostsim::Simulation, instead of the DMA of the SAI / I2S peripheral.
+ */
+
+#ifndef HOST_SIM_MURASAKI_HPP_
+#define HOST_SIM_MURASAKI_HPP_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "main.h"
+#include "platform_config.hpp"
+
+#ifndef MURASAKI_CONFIG_NOCYCCNT
+#define MURASAKI_CONFIG_NOCYCCNT false
+#endif
+
+/**
+ * @brief Assertion as like murasaki library.
+ * @details
+ * Print the location and terminate the simulation, when the condition is false.
+ * As like the library, the macro is used without trailing semicolon.
+ */
+#define MURASAKI_ASSERT(COND) \
+    { \
+        if (!(COND)) { \
+            fprintf(stderr, "%s:%d Assertion failed : %s\n", __FILE__, __LINE__, #COND); \
+            abort(); \
+        } \
+    }
+
+namespace murasaki {
+
+/**
+ * @brief Wait time specifier of the blocking functions.
+ */
+enum WaitMilliSeconds : unsigned int {
+    kwmsPolling = 0,                  ///< Not waiting. Immediate timeout.
+    kwmsIndefinitely = 0xFFFFFFFF     ///< Wait forever.
+};
+
+/**
+ * @brief Task priority.
+ * @details
+ * On the host, all tasks run as native threads. The priority is recorded but not used.
+ */
+enum TaskPriority {
+    ktpIdle = 0,       ///< Idle priority.
+    ktpLow,            ///< Lower than normal.
+    ktpNormal,         ///< Default priority.
+    ktpHigh,           ///< Higher than normal.
+    ktpRealtime        ///< Highest priority.
+};
+
+/**
+ * @brief Audio channel of the CODEC.
+ */
+enum CodecChannel {
+    kccLineInput,         ///< Line input.
+    kccAuxInput,          ///< Aux input.
+    kccMicInput,          ///< Microphone input.
+    kccHeadphoneOutput,   ///< Headphone output.
+    kccLineOutput         ///< Line output.
+};
+
+/* ----------------------------------- Strategies ------------------------------------------ */
+
+/**
+ * @brief Root class of the UART.
+ */
+class UartStrategy {
+ public:
+    virtual ~UartStrategy() {
+    }
+};
+
+/**
+ * @brief Root class of the logger.
+ */
+class LoggerStrategy {
+ public:
+    virtual ~LoggerStrategy() {
+    }
+};
+
+/**
+ * @brief Root class of the GPIO output.
+ */
+class BitOutStrategy {
+ public:
+    virtual ~BitOutStrategy() {
+    }
+    virtual void Set(unsigned int state = 1) = 0;
+    virtual void Clear() = 0;
+    virtual unsigned int Get() = 0;
+    virtual void Toggle() = 0;
+};
+
+/**
+ * @brief Root class of the I2C master.
+ */
+class I2cMasterStrategy {
+ public:
+    virtual ~I2cMasterStrategy() {
+    }
+};
+
+/**
+ * @brief Root class of the audio CODEC controller.
+ */
+class AudioCodecStrategy {
+ public:
+    /**
+     * @param fs Sampling frequency [Hz].
+     */
+    explicit AudioCodecStrategy(unsigned int fs)
+            : fs_(fs) {
+    }
+    virtual ~AudioCodecStrategy() {
+    }
+    virtual void Start(void) = 0;
+    virtual void SetGain(murasaki::CodecChannel channel, float left_gain, float right_gain) = 0;
+    virtual void Mute(murasaki::CodecChannel channel, bool mute = true) = 0;
+ protected:
+    const unsigned int fs_;
+};
+
+/**
+ * @brief Root class of the audio port adapter.
+ */
+class AudioPortAdapterStrategy {
+ public:
+    virtual ~AudioPortAdapterStrategy() {
+    }
+    /**
+     * @brief Number of channels in a frame.
+     * @return Always 2 for I2S and SAI stereo mode.
+     */
+    virtual unsigned int GetNumberOfChannelsPerFrame() = 0;
+    /**
+     * @brief Host only. Set the DMA callbacks as like HAL does at the start of the DMA.
+     */
+    void EmulateDmaStart();
+    /**
+     * @brief Host only. Call the DMA callbacks as like the DMA interrupts.
+     * @param blocks Number of the blocks transferred since the last call.
+     * @details
+     * The half and full transfer callbacks are called alternately, as like the circular DMA.
+     */
+    void EmulateDmaTransfer(unsigned int blocks);
+ protected:
+    AudioPortAdapterStrategy(DMA_HandleTypeDef *tx_dma, DMA_HandleTypeDef *rx_dma)
+            : tx_dma_(tx_dma),
+              rx_dma_(rx_dma),
+              is_half_(true) {
+    }
+ private:
+    DMA_HandleTypeDef *const tx_dma_;
+    DMA_HandleTypeDef *const rx_dma_;
+    bool is_half_;
+};
+
+/**
+ * @brief Root class of the task.
+ */
+class TaskStrategy {
+ public:
+    virtual ~TaskStrategy() {
+    }
+    virtual void Start() = 0;
+};
+
+/* ------------------------------------- Classes ------------------------------------------ */
+
+/**
+ * @brief Stand-in of the DebuggerUart. The output goes to the stdout.
+ */
+class DebuggerUart : public UartStrategy {
+ public:
+    explicit DebuggerUart(UART_HandleTypeDef *uart);
+};
+
+/**
+ * @brief Stand-in of the UartLogger.
+ */
+class UartLogger : public LoggerStrategy {
+ public:
+    explicit UartLogger(UartStrategy *uart);
+};
+
+/**
+ * @brief Stand-in of the Debugger. Printf() goes to the stdout.
+ */
+class Debugger {
+ public:
+    explicit Debugger(LoggerStrategy *logger);
+    /**
+     * @brief Formatted print to the stdout.
+     * @param fmt Format string as like printf.
+     */
+    void Printf(const char *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+    /**
+     * @brief Do nothing on the host.
+     */
+    void AutoRePrint();
+};
+
+/**
+ * @brief Stand-in of the BitOut. The state is kept in the object.
+ */
+class BitOut : public BitOutStrategy {
+ public:
+    BitOut(GPIO_TypeDef *port, uint16_t pin);
+    virtual void Set(unsigned int state = 1);
+    virtual void Clear();
+    virtual unsigned int Get();
+    virtual void Toggle();
+ private:
+    GPIO_TypeDef *const port_;
+    const uint16_t pin_;
+    unsigned int state_;
+};
+
+/**
+ * @brief Stand-in of the I2cMaster. Do nothing.
+ */
+class I2cMaster : public I2cMasterStrategy {
+ public:
+    explicit I2cMaster(I2C_HandleTypeDef *i2c_handle);
+};
+
+/**
+ * @brief Stand-in of the ADAU1361 CODEC controller.
+ * @details
+ * Records the gain and mute status. The audio data is not affected by these settings,
+ * to keep the simulation output deterministic.
+ */
+class Adau1361 : public AudioCodecStrategy {
+ public:
+    Adau1361(unsigned int fs, unsigned int master_clock, murasaki::I2cMasterStrategy *controller, unsigned int i2c_device_addr);
+    virtual void Start(void);
+    virtual void SetGain(murasaki::CodecChannel channel, float left_gain, float right_gain);
+    virtual void Mute(murasaki::CodecChannel channel, bool mute = true);
+};
+
+/**
+ * @brief Stand-in of the SaiPortAdapter.
+ */
+class SaiPortAdapter : public AudioPortAdapterStrategy {
+ public:
+    SaiPortAdapter(SAI_HandleTypeDef *tx_peripheral, SAI_HandleTypeDef *rx_peripheral);
+    virtual unsigned int GetNumberOfChannelsPerFrame();
+};
+
+/**
+ * @brief Stand-in of the I2sPortAdapter.
+ */
+class I2sPortAdapter : public AudioPortAdapterStrategy {
+ public:
+    I2sPortAdapter(I2S_HandleTypeDef *tx_peripheral, I2S_HandleTypeDef *rx_peripheral);
+    virtual unsigned int GetNumberOfChannelsPerFrame();
+};
+
+/**
+ * @brief Stand-in of the DuplexAudio.
+ * @details
+ * TransmitAndReceive() writes the TX samples to the output WAV file and reads the
+ * RX samples from the input WAV file. The samples are scaled to [-1.0, 1.0) as like the
+ * library.
+ *
+ * The time between the return from TransmitAndReceive() and the next call is
+ * the processing time of a block. It is recorded by @ref hostsim::Simulation.
+ *
+ * The DMA callbacks of the port are called as like the interrupts of the circular DMA.
+ * In the real time mode, a late call of TransmitAndReceive() causes multiple transfers.
+ */
+class DuplexAudio {
+ public:
+    DuplexAudio(murasaki::AudioPortAdapterStrategy *peripheral_adapter, unsigned int channel_length);
+    virtual ~DuplexAudio();
+    /**
+     * @brief Exchange a block of the stereo samples.
+     * @param tx_left Left samples to transmit. Length is channel_length.
+     * @param tx_right Right samples to transmit. Length is channel_length.
+     * @param rx_left Buffer to receive the left samples. Length is channel_length.
+     * @param rx_right Buffer to receive the right samples. Length is channel_length.
+     * @details
+     * Never return after the input file is exhausted.
+     */
+    void TransmitAndReceive(float *tx_left, float *tx_right, float *rx_left, float *rx_right);
+ private:
+    murasaki::AudioPortAdapterStrategy *const peripheral_adapter_;
+    const unsigned int channel_length_;
+    bool is_started_;
+};
+
+/**
+ * @brief Stand-in of the SimpleTask. The task runs as a host thread.
+ */
+class SimpleTask : public TaskStrategy {
+ public:
+    SimpleTask(const char *task_name, unsigned short stack_depth, murasaki::TaskPriority task_priority, const void *task_parameter, void (*task_body_func)(const void *));
+    virtual void Start();
+ private:
+    const char *const name_;
+    const void *const parameter_;
+    void (*const body_)(const void *);
+};
+
+/**
+ * @brief Stand-in of the Synchronizer.
+ */
+class Synchronizer {
+ public:
+    Synchronizer();
+    virtual ~Synchronizer();
+    /**
+     * @brief Wait for the release.
+     * @param timeout_ms Not used on the host. Always wait forever.
+     * @return Always true.
+     */
+    bool Wait(unsigned int timeout_ms = murasaki::kwmsIndefinitely);
+    /**
+     * @brief Release the waiting task.
+     */
+    void Release();
+ private:
+    void *const impl_;
+};
+
+/**
+ * @brief Sleep the calling thread.
+ * @param duration Duration in milliseconds.
+ */
+void Sleep(unsigned int duration);
+
+/**
+ * @brief Initialize the cycle counter. Do nothing on the host.
+ */
+void InitCycleCounter();
+
+/**
+ * @brief Get the current value of the cycle counter.
+ * @return Nanoseconds from an arbitrary origin, truncated to 32bit.
+ */
+unsigned int GetCycleCounter();
+
+/**
+ * @brief Debugger object as like the library.
+ */
+extern Debugger *debugger;
+
+} /* namespace murasaki */
+
+#include "platform_defs.hpp"
+
+#endif /* HOST_SIM_MURASAKI_HPP_ */
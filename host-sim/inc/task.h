@@ -0,0 +1,38 @@
+/**
+ * @file task.h
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host replacement of the task.h of FreeRTOS.
+ * @details
+ * The task runs as a host thread. The stack given by the application is not used.
+ *
+ * The handle of xTaskGetCurrentTaskHandle() is the notification state of the calling thread. It is
+ * used only for the task notification, and differs from the handle of xTaskCreateStatic().
+ */
+
+#ifndef HOST_SIM_TASK_H_
+#define HOST_SIM_TASK_H_
+
+#include "FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t pxTaskCode, const char *const pcName, const uint32_t ulStackDepth, void *const pvParameters,
+                               UBaseType_t uxPriority, StackType_t *const puxStackBuffer, StaticTask_t *const pxTaskBuffer);
+void vTaskDelete(TaskHandle_t xTaskToDelete);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SIM_TASK_H_ */
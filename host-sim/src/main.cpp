@@ -0,0 +1,137 @@
+/**
+ * @file main.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Entry of the host simulation.
+ * @details
+ * Run the InitPlatform(), ExecPlatform() and TaskBodyFunction() of a board on the host.
+ * The audio is read from a WAV file and the processed audio is written to a WAV file.
+ * At the end of the input, the timing statistics of the audio task is printed.
+ * The trace of AUDIO_TRACE() can be dumped in the same format as the dump of the debugger on the target.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include "murasaki.hpp"
+#include "murasaki_platform.hpp"
+#include "blocklength.hpp"
+#include "samplerate.hpp"
+#include "simulation.hpp"
+#include "trace.hpp"
+
+namespace {
+
+void Usage(const char *name) {
+    std::fprintf(stderr,
+                 "Usage : %s [-i input.wav] [-o output.wav] [-s seconds] [-f fs] [-b length] [-c fs] [-t trace.bin] [-r] [-q]\n"
+                 "  -i : Input WAV file. 16/24/32bit PCM or 32bit float. Without -i, a test signal is synthesized.\n"
+                 "  -o : Output WAV file. Same sample format as the input.\n"
+                 "  -s : Length of the synthesized test signal in seconds. Default 10.\n"
+                 "  -f : Sampling frequency of the synthesized test signal. Default 48000.\n"
+                 "  -b : Audio block length. Power of 2 from 16 to 512. Default is the one selected by InitPlatform().\n"
+                 "  -c : Sampling frequency switched to after the start. 44100, 48000 or 96000.\n"
+                 "  -t : Dump the trace records at the end. Decode by tools/tracedecode with this executable.\n"
+                 "  -r : Pace the audio blocks in real time. Default is as fast as possible.\n"
+                 "  -q : Suppress the debugger console output.\n",
+                 name);
+}
+
+// Write the ring of the trace as like "dump binary memory" of GDB.
+bool DumpTrace(const char *file_name) {
+    FILE *file = std::fopen(file_name, "wb");
+    if (nullptr == file) {
+        std::perror(file_name);
+        return false;
+    }
+    const size_t written = std::fwrite(murasaki::platform.trace->Records(), sizeof(audio::TraceRecord), audio::AudioTrace::Length(), file);
+    const bool is_ok = std::fclose(file) == 0 && written == audio::AudioTrace::Length();
+    if (!is_ok)
+        std::fprintf(stderr, "Failed to write %s\n", file_name);
+    return is_ok;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    hostsim::Options options;
+    unsigned int block_length = 0;
+    unsigned int sample_rate = 0;
+    const char *trace_file = nullptr;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:o:s:f:b:c:t:rqh")) != -1) {
+        switch (opt) {
+            case 'i':
+                options.input_file = optarg;
+                break;
+            case 'o':
+                options.output_file = optarg;
+                break;
+            case 's':
+                options.synth_seconds = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 0));
+                break;
+            case 'f':
+                options.synth_rate = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 0));
+                break;
+            case 'b':
+                block_length = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 0));
+                if (!audio::BlockLength::IsValid(block_length)) {
+                    std::fprintf(stderr, "Block length must be a power of 2 from %u to %u\n", audio::kMinBlockLength, audio::kMaxBlockLength);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'c':
+                sample_rate = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 0));
+                if (!audio::SampleRate::IsValid(sample_rate)) {
+                    std::fprintf(stderr, "Sampling frequency must be %u, %u or %u\n", audio::kSampleRate44k, audio::kSampleRate48k, audio::kSampleRate96k);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 't':
+                trace_file = optarg;
+                break;
+            case 'r':
+                options.realtime = true;
+                break;
+            case 'q':
+                options.quiet = true;
+                break;
+            default:
+                Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (!hostsim::Simulation::Instance().Configure(options))
+        return EXIT_FAILURE;
+
+    // Same sequence as the StartDefaultTask() in main.c.
+    InitPlatform();
+    if (nullptr != trace_file && nullptr == murasaki::platform.trace) {
+        std::fprintf(stderr, "Trace is disabled by AUDIO_CONFIG_TRACE\n");
+        return EXIT_FAILURE;
+    }
+    // Request the block length before the audio starts, as like the control task does while running.
+    if (block_length != 0)
+        murasaki::platform.audio_block->Request(block_length);
+    // The sampling frequency is switched by the audio task after the start, to measure the switch.
+    if (sample_rate != 0 && !murasaki::platform.sample_rate->Request(sample_rate)) {
+        std::fprintf(stderr, "Sampling frequency is fixed by AUDIO_CONFIG_RESAMPLING\n");
+        return EXIT_FAILURE;
+    }
+    std::thread(ExecPlatform).detach();
+
+    hostsim::Simulation::Instance().WaitForCompletion();
+    hostsim::Simulation::Instance().Report();
+    const bool is_dumped = nullptr == trace_file || DumpTrace(trace_file);
+
+    // The audio task and ExecPlatform() never return. Terminate them here.
+    std::fflush(stdout);
+    std::fflush(stderr);
+    std::_Exit(is_dumped ? EXIT_SUCCESS : EXIT_FAILURE);
+}
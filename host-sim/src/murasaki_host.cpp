@@ -0,0 +1,427 @@
+/**
+ * @file murasaki_host.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Host implementation of the murasaki stand-in classes.
+ */
+
+#include "murasaki.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+#include <vector>
+
+#include "simulation.hpp"
+#include "task.h"
+
+/* ---------------------------- HAL stand-in ------------------------------- */
+
+GPIO_TypeDef host_gpioa = { "GPIOA" };
+GPIO_TypeDef host_gpiob = { "GPIOB" };
+GPIO_TypeDef host_gpioc = { "GPIOC" };
+GPIO_TypeDef host_gpioe = { "GPIOE" };
+
+uint32_t SystemCoreClock = 1000000000;
+
+// Union of the peripheral handles referred by the murasaki_platform.cpp of all boards.
+// The DMA handles are linked as like the HAL_xxx_MspInit() generated by CubeIDE.
+UART_HandleTypeDef huart3;
+UART_HandleTypeDef hlpuart1;
+UART_HandleTypeDef huart2;
+I2C_HandleTypeDef hi2c1;
+DMA_HandleTypeDef hdma_sai1_a;
+DMA_HandleTypeDef hdma_sai1_b;
+DMA_HandleTypeDef hdma_spi1_tx;
+DMA_HandleTypeDef hdma_spi2_tx;
+DMA_HandleTypeDef hdma_spi2_rx;
+DMA_HandleTypeDef hdma_spi3_rx;
+SAI_HandleTypeDef hsai_BlockA1 = { &hdma_sai1_a, &hdma_sai1_a };
+SAI_HandleTypeDef hsai_BlockB1 = { &hdma_sai1_b, &hdma_sai1_b };
+I2S_HandleTypeDef hi2s1 = { &hdma_spi1_tx, nullptr };
+I2S_HandleTypeDef hi2s2 = { &hdma_spi2_tx, &hdma_spi2_rx };    // TX on G431, RX on F722.
+I2S_HandleTypeDef hi2s3 = { nullptr, &hdma_spi3_rx };
+
+namespace {
+// Stand-in of the DMA callbacks of HAL. The audio framework is not driven by them on the host.
+void HalDmaCallback(DMA_HandleTypeDef *hdma) {
+    (void) hdma;
+}
+
+// Circular DMA of the I2S, waiting for the other direction to start.
+struct I2sDmaRequest {
+    DMA_HandleTypeDef *dma;
+    uint16_t *data;
+    uint16_t size;
+};
+I2sDmaRequest i2s_tx_request;
+I2sDmaRequest i2s_rx_request;
+
+// Start the emulation when both directions are requested.
+void StartI2sDma() {
+    if (nullptr == i2s_tx_request.dma || nullptr == i2s_rx_request.dma)
+        return;
+    MURASAKI_ASSERT(i2s_tx_request.size == i2s_rx_request.size)
+    // With the 32bit data, the size is the number of the 32bit words.
+    hostsim::Simulation::Instance().StartCircularDma(
+                                                     i2s_tx_request.dma,
+                                                     reinterpret_cast<const int32_t*>(i2s_tx_request.data),
+                                                     i2s_rx_request.dma,
+                                                     reinterpret_cast<int32_t*>(i2s_rx_request.data),
+                                                     i2s_tx_request.size);
+    i2s_tx_request.dma = nullptr;
+    i2s_rx_request.dma = nullptr;
+}
+}  // namespace
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+    return GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai) {
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2S_DMAStop(I2S_HandleTypeDef *hi2s) {
+    hostsim::Simulation::Instance().StopCircularDma();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2S_Transmit_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData, uint16_t Size) {
+    MURASAKI_ASSERT(nullptr != hi2s->hdmatx)
+    // As like HAL, the DMA callbacks are set at the start.
+    hi2s->hdmatx->XferHalfCpltCallback = &HalDmaCallback;
+    hi2s->hdmatx->XferCpltCallback = &HalDmaCallback;
+    i2s_tx_request = { hi2s->hdmatx, pData, Size };
+    StartI2sDma();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2S_Receive_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData, uint16_t Size) {
+    MURASAKI_ASSERT(nullptr != hi2s->hdmarx)
+    hi2s->hdmarx->XferHalfCpltCallback = &HalDmaCallback;
+    hi2s->hdmarx->XferCpltCallback = &HalDmaCallback;
+    i2s_rx_request = { hi2s->hdmarx, pData, Size };
+    StartI2sDma();
+    return HAL_OK;
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type IRQn) {
+    (void) IRQn;
+    return 5;
+}
+
+void __disable_irq(void) {
+    hostsim::Simulation::Instance().DisableInterrupt();
+}
+
+void __enable_irq(void) {
+    hostsim::Simulation::Instance().EnableInterrupt();
+}
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t pxTaskCode, const char *const pcName, const uint32_t ulStackDepth, void *const pvParameters,
+                               UBaseType_t uxPriority, StackType_t *const puxStackBuffer, StaticTask_t *const pxTaskBuffer) {
+    MURASAKI_ASSERT(nullptr != puxStackBuffer)
+    MURASAKI_ASSERT(nullptr != pxTaskBuffer)
+    std::thread(pxTaskCode, pvParameters).detach();
+    return pxTaskBuffer;
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete) {
+    // Only the deletion of the calling task is supported.
+    MURASAKI_ASSERT(nullptr == xTaskToDelete)
+    pthread_exit(nullptr);
+}
+
+namespace {
+// Notification value of a thread.
+struct TaskNotificationImpl {
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint32_t value = 0;
+    bool is_waiting = false;    // Blocked in ulTaskNotifyTake().
+};
+
+// The threads are never destroyed while the program runs. Then, the handle stays valid.
+thread_local TaskNotificationImpl task_notification;
+
+// Tasks woken by the emulated interrupts, and not yet waited by WaitForWokenTasks().
+std::mutex woken_mutex;
+std::vector<TaskNotificationImpl*> woken_tasks;
+}  // namespace
+
+namespace hostsim {
+
+void WaitForWokenTasks(const std::atomic<bool> &cancel) {
+    std::vector<TaskNotificationImpl*> tasks;
+    {
+        std::lock_guard<std::mutex> lock(woken_mutex);
+        tasks.swap(woken_tasks);
+    }
+    for (TaskNotificationImpl *impl : tasks) {
+        std::unique_lock<std::mutex> lock(impl->mutex);
+        // The task may stop the DMA instead of waiting. Then, the cancel is checked periodically.
+        while (!(impl->is_waiting && impl->value == 0) && !cancel)
+            impl->condition.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+}  // namespace hostsim
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return &task_notification;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait) {
+    // 0 polls. Other timeouts wait forever.
+    std::unique_lock<std::mutex> lock(task_notification.mutex);
+    if (0 != xTicksToWait) {
+        task_notification.is_waiting = true;
+        task_notification.condition.notify_all();
+        task_notification.condition.wait(lock, [] {
+            return task_notification.value != 0;
+        });
+        task_notification.is_waiting = false;
+    }
+    const uint32_t value = task_notification.value;
+    if (0 != value)
+        task_notification.value = xClearCountOnExit ? 0 : value - 1;
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify) {
+    TaskNotificationImpl *impl = static_cast<TaskNotificationImpl*>(xTaskToNotify);
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->value++;
+    impl->condition.notify_all();
+    return pdTRUE;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken) {
+    {
+        std::lock_guard<std::mutex> lock(woken_mutex);
+        woken_tasks.push_back(static_cast<TaskNotificationImpl*>(xTaskToNotify));
+    }
+    xTaskNotifyGive(xTaskToNotify);
+    *pxHigherPriorityTaskWoken = pdFALSE;
+}
+
+namespace murasaki {
+
+/* ---------------------------- Debugger ------------------------------- */
+
+DebuggerUart::DebuggerUart(UART_HandleTypeDef *uart) {
+    MURASAKI_ASSERT(nullptr != uart)
+}
+
+UartLogger::UartLogger(UartStrategy *uart) {
+    MURASAKI_ASSERT(nullptr != uart)
+}
+
+Debugger::Debugger(LoggerStrategy *logger) {
+    MURASAKI_ASSERT(nullptr != logger)
+}
+
+void Debugger::Printf(const char *fmt, ...) {
+    if (hostsim::Simulation::Instance().IsQuiet())
+        return;
+    va_list args;
+    va_start(args, fmt);
+    std::vprintf(fmt, args);
+    va_end(args);
+    std::fflush(stdout);
+}
+
+void Debugger::AutoRePrint() {
+}
+
+/* ---------------------------- GPIO / I2C ------------------------------- */
+
+BitOut::BitOut(GPIO_TypeDef *port, uint16_t pin)
+        : port_(port),
+          pin_(pin),
+          state_(0) {
+    MURASAKI_ASSERT(nullptr != port)
+}
+
+void BitOut::Set(unsigned int state) {
+    state_ = state ? 1 : 0;
+}
+
+void BitOut::Clear() {
+    state_ = 0;
+}
+
+unsigned int BitOut::Get() {
+    return state_;
+}
+
+void BitOut::Toggle() {
+    state_ ^= 1;
+}
+
+I2cMaster::I2cMaster(I2C_HandleTypeDef *i2c_handle) {
+    MURASAKI_ASSERT(nullptr != i2c_handle)
+}
+
+/* ---------------------------- CODEC ------------------------------- */
+
+Adau1361::Adau1361(unsigned int fs, unsigned int master_clock, murasaki::I2cMasterStrategy *controller, unsigned int i2c_device_addr)
+        : AudioCodecStrategy(fs) {
+    MURASAKI_ASSERT(nullptr != controller)
+    (void) master_clock;
+    (void) i2c_device_addr;
+}
+
+void Adau1361::Start(void) {
+    hostsim::Simulation::Instance().SetCodecSampleRate(fs_);
+}
+
+void Adau1361::SetGain(murasaki::CodecChannel channel, float left_gain, float right_gain) {
+    (void) channel;
+    (void) left_gain;
+    (void) right_gain;
+}
+
+void Adau1361::Mute(murasaki::CodecChannel channel, bool mute) {
+    (void) channel;
+    (void) mute;
+}
+
+/* ---------------------------- Audio ------------------------------- */
+
+void AudioPortAdapterStrategy::EmulateDmaStart() {
+    DMA_HandleTypeDef *const dmas[] = { tx_dma_, rx_dma_ };
+    for (DMA_HandleTypeDef *dma : dmas) {
+        dma->XferHalfCpltCallback = &HalDmaCallback;
+        dma->XferCpltCallback = &HalDmaCallback;
+    }
+    is_half_ = true;
+}
+
+void AudioPortAdapterStrategy::EmulateDmaTransfer(unsigned int blocks) {
+    for (unsigned int i = 0; i < blocks; i++) {
+        DMA_HandleTypeDef *const dmas[] = { tx_dma_, rx_dma_ };
+        for (DMA_HandleTypeDef *dma : dmas) {
+            if (is_half_)
+                dma->XferHalfCpltCallback(dma);
+            else
+                dma->XferCpltCallback(dma);
+        }
+        is_half_ = !is_half_;
+    }
+}
+
+SaiPortAdapter::SaiPortAdapter(SAI_HandleTypeDef *tx_peripheral, SAI_HandleTypeDef *rx_peripheral)
+        : AudioPortAdapterStrategy(tx_peripheral->hdmatx, rx_peripheral->hdmarx) {
+    MURASAKI_ASSERT(nullptr != tx_peripheral)
+    MURASAKI_ASSERT(nullptr != rx_peripheral)
+}
+
+unsigned int SaiPortAdapter::GetNumberOfChannelsPerFrame() {
+    return 2;
+}
+
+I2sPortAdapter::I2sPortAdapter(I2S_HandleTypeDef *tx_peripheral, I2S_HandleTypeDef *rx_peripheral)
+        : AudioPortAdapterStrategy(tx_peripheral->hdmatx, rx_peripheral->hdmarx) {
+    MURASAKI_ASSERT(nullptr != tx_peripheral)
+    MURASAKI_ASSERT(nullptr != rx_peripheral)
+}
+
+unsigned int I2sPortAdapter::GetNumberOfChannelsPerFrame() {
+    return 2;
+}
+
+DuplexAudio::DuplexAudio(murasaki::AudioPortAdapterStrategy *peripheral_adapter, unsigned int channel_length)
+        : peripheral_adapter_(peripheral_adapter),
+          channel_length_(channel_length),
+          is_started_(false) {
+    MURASAKI_ASSERT(nullptr != peripheral_adapter)
+    MURASAKI_ASSERT(0 != channel_length)
+}
+
+DuplexAudio::~DuplexAudio() {
+}
+
+void DuplexAudio::TransmitAndReceive(float *tx_left, float *tx_right, float *rx_left, float *rx_right) {
+    MURASAKI_ASSERT(nullptr != tx_left)
+    MURASAKI_ASSERT(nullptr != tx_right)
+    MURASAKI_ASSERT(nullptr != rx_left)
+    MURASAKI_ASSERT(nullptr != rx_right)
+
+    // As like the library, the DMA starts at the first call.
+    if (!is_started_) {
+        peripheral_adapter_->EmulateDmaStart();
+        is_started_ = true;
+    }
+
+    const unsigned int transfers = hostsim::Simulation::Instance().Exchange(tx_left, tx_right, rx_left, rx_right, channel_length_);
+    peripheral_adapter_->EmulateDmaTransfer(transfers);
+}
+
+/* ---------------------------- RTOS ------------------------------- */
+
+SimpleTask::SimpleTask(const char *task_name, unsigned short stack_depth, murasaki::TaskPriority task_priority, const void *task_parameter, void (*task_body_func)(const void*))
+        : name_(task_name),
+          parameter_(task_parameter),
+          body_(task_body_func) {
+    MURASAKI_ASSERT(nullptr != task_body_func)
+    (void) stack_depth;
+    (void) task_priority;
+}
+
+void SimpleTask::Start() {
+    std::thread(body_, parameter_).detach();
+}
+
+namespace {
+// Binary semaphore.
+struct SynchronizerImpl {
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool released = false;
+};
+}  // namespace
+
+Synchronizer::Synchronizer()
+        : impl_(new SynchronizerImpl) {
+}
+
+Synchronizer::~Synchronizer() {
+    delete static_cast<SynchronizerImpl*>(impl_);
+}
+
+bool Synchronizer::Wait(unsigned int timeout_ms) {
+    (void) timeout_ms;
+    SynchronizerImpl *impl = static_cast<SynchronizerImpl*>(impl_);
+    std::unique_lock<std::mutex> lock(impl->mutex);
+    impl->condition.wait(lock, [impl] {
+        return impl->released;
+    });
+    impl->released = false;
+    return true;
+}
+
+void Synchronizer::Release() {
+    SynchronizerImpl *impl = static_cast<SynchronizerImpl*>(impl_);
+    std::lock_guard<std::mutex> lock(impl->mutex);
+    impl->released = true;
+    impl->condition.notify_one();
+}
+
+void Sleep(unsigned int duration) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration));
+}
+
+void InitCycleCounter() {
+}
+
+unsigned int GetCycleCounter() {
+    return static_cast<unsigned int>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} /* namespace murasaki */
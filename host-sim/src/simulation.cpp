@@ -0,0 +1,318 @@
+/**
+ * @file simulation.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Audio stream and timing control of the host simulation.
+ */
+
+#include "simulation.hpp"
+
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+
+namespace hostsim {
+
+namespace {
+
+// Number of the halves of zero transmitted before the first processed half.
+const unsigned int kInitialTxHalves = 2;
+
+// Sample in the DMA buffer of the I2S. The upper half word first.
+int32_t SwapHalves(int32_t word) {
+    const uint32_t value = static_cast<uint32_t>(word);
+    return static_cast<int32_t>((value << 16) | (value >> 16));
+}
+
+int32_t ToDmaWord(float sample) {
+    const double scaled = std::round(static_cast<double>(sample) * 2147483648.0);
+    if (scaled >= 2147483647.0)
+        return SwapHalves(INT32_MAX);
+    if (scaled <= -2147483648.0)
+        return SwapHalves(INT32_MIN);
+    return SwapHalves(static_cast<int32_t>(scaled));
+}
+
+float FromDmaWord(int32_t word) {
+    return static_cast<float>(SwapHalves(word)) * (1.0f / 2147483648.0f);
+}
+
+}  // namespace
+
+Simulation& Simulation::Instance() {
+    static Simulation simulation;
+    return simulation;
+}
+
+uint64_t Simulation::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool Simulation::Configure(const Options &options) {
+    options_ = options;
+
+    if (options.input_file.empty()) {
+        // Synthesize the test signal. 997Hz -6dBFS at left, 3kHz -12dBFS at right.
+        const double pi = 3.14159265358979323846;
+        sample_rate_ = options.synth_rate;
+        format_ = kwfPcm32;
+        const size_t frames = static_cast<size_t>(options.synth_seconds) * sample_rate_;
+        input_left_.resize(frames);
+        input_right_.resize(frames);
+        for (size_t i = 0; i < frames; i++) {
+            input_left_[i] = static_cast<float>(0.5 * std::sin(2.0 * pi * 997.0 * i / sample_rate_));
+            input_right_[i] = static_cast<float>(0.25 * std::sin(2.0 * pi * 3000.0 * i / sample_rate_));
+        }
+    }
+    else {
+        if (!reader_.Open(options.input_file))
+            return false;
+        sample_rate_ = reader_.GetSampleRate();
+        format_ = reader_.GetFormat();
+        input_left_ = reader_.GetLeft();
+        input_right_ = reader_.GetRight();
+    }
+
+    if (!options.output_file.empty())
+        if (!writer_.Open(options.output_file, sample_rate_, format_))
+            return false;
+
+    return true;
+}
+
+void Simulation::SetCodecSampleRate(unsigned int fs) {
+    if (fs != sample_rate_)
+        std::fprintf(stderr, "host-sim : CODEC is configured as %u Hz while the input is %u Hz. Processing at the input rate.\n", fs, sample_rate_);
+}
+
+unsigned int Simulation::Exchange(const float *tx_left, const float *tx_right, float *rx_left, float *rx_right, unsigned int channel_length) {
+    const uint64_t entry = Now();
+
+    if (blocks_ == 0) {
+        // The first TX block is the initial zero data of the task. Discard it.
+        channel_length_ = channel_length;
+        start_ = entry;
+    }
+    else {
+        if (channel_length != channel_length_) {
+            std::fprintf(stderr, "host-sim : Block length changed from %u to %u\n", channel_length_, channel_length);
+            channel_length_ = channel_length;
+            // The DMA is restarted with the new length.
+            start_ = entry;
+            dma_blocks_ = 0;
+        }
+        sum_cycle_ns_ += entry - last_entry_;
+
+        const uint64_t elapsed = entry - last_exit_;
+        if (elapsed < min_ns_)
+            min_ns_ = elapsed;
+        if (elapsed > max_ns_)
+            max_ns_ = elapsed;
+        sum_ns_ += elapsed;
+        processed_++;
+
+        // Write the processed block, up to the length of the input.
+        const size_t remaining = input_left_.size() - write_position_;
+        const size_t count = remaining < channel_length ? remaining : channel_length;
+        writer_.Write(tx_left, tx_right, count);
+        write_position_ += count;
+    }
+
+    if (write_position_ >= input_left_.size() && blocks_ > 0)
+        Complete();
+
+    // Read the next block. Zero padding after the end of input.
+    for (unsigned int i = 0; i < channel_length; i++) {
+        if (read_position_ < input_left_.size()) {
+            rx_left[i] = input_left_[read_position_];
+            rx_right[i] = input_right_[read_position_];
+            read_position_++;
+        }
+        else {
+            rx_left[i] = 0.0f;
+            rx_right[i] = 0.0f;
+        }
+    }
+
+    blocks_++;
+    last_entry_ = entry;
+
+    unsigned int transfers = 1;
+    if (options_.realtime) {
+        // Wait for the time when the DMA would deliver the next block.
+        const uint64_t period_numerator = static_cast<uint64_t>(channel_length) * 1000000000ull;
+        const uint64_t deadline = start_ + (dma_blocks_ + 1) * period_numerator / sample_rate_;
+        uint64_t now = Now();
+        if (deadline > now) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - now));
+            now = Now();
+        }
+        // The DMA doesn't wait for the audio task.
+        const uint64_t dma_blocks = (now - start_) * sample_rate_ / period_numerator;
+        transfers = static_cast<unsigned int>(dma_blocks - dma_blocks_);
+        dma_blocks_ = dma_blocks;
+        late_blocks_ += transfers - 1;
+    }
+
+    last_exit_ = Now();
+    return transfers;
+}
+
+void Simulation::StartCircularDma(DMA_HandleTypeDef *tx_dma, const int32_t *tx, DMA_HandleTypeDef *rx_dma, int32_t *rx, unsigned int words) {
+    StopCircularDma();
+    tx_dma_ = tx_dma;
+    rx_dma_ = rx_dma;
+    tx_buffer_ = tx;
+    rx_buffer_ = rx;
+    dma_words_ = words;
+    is_dma_stop_requested_ = false;
+    dma_thread_ = std::thread(&Simulation::RunCircularDma, this);
+}
+
+void Simulation::StopCircularDma() {
+    if (!dma_thread_.joinable())
+        return;
+    is_dma_stop_requested_ = true;
+    dma_thread_.join();
+}
+
+void Simulation::DisableInterrupt() {
+    interrupt_mutex_.lock();
+}
+
+void Simulation::EnableInterrupt() {
+    interrupt_mutex_.unlock();
+}
+
+void Simulation::RunCircularDma() {
+    const unsigned int channel_length = dma_words_ / 4;
+    std::vector<float> tx_left(channel_length);
+    std::vector<float> tx_right(channel_length);
+
+    if (blocks_ != 0 && channel_length != channel_length_)
+        std::fprintf(stderr, "host-sim : Block length changed from %u to %u\n", channel_length_, channel_length);
+    channel_length_ = channel_length;
+
+    const uint64_t start = Now();
+    const uint64_t period_numerator = static_cast<uint64_t>(channel_length) * 1000000000ull;
+    uint64_t halves = 0;
+    while (!is_dma_stop_requested_) {
+        if (options_.realtime) {
+            // Wait for the end of the half. The DMA doesn't wait for the interrupt handler.
+            const uint64_t deadline = start + (halves + 1) * period_numerator / sample_rate_;
+            const uint64_t now = Now();
+            if (deadline > now)
+                std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - now));
+            else
+                late_blocks_ += (now - deadline) * sample_rate_ / period_numerator;
+        }
+
+        const unsigned int offset = static_cast<unsigned int>(halves % 2) * 2 * channel_length;
+
+        // Write the transmitted half, up to the length of the input.
+        if (discarded_halves_ < kInitialTxHalves) {
+            discarded_halves_++;
+        }
+        else {
+            for (unsigned int i = 0; i < channel_length; i++) {
+                tx_left[i] = FromDmaWord(tx_buffer_[offset + 2 * i]);
+                tx_right[i] = FromDmaWord(tx_buffer_[offset + 2 * i + 1]);
+            }
+            const size_t remaining = input_left_.size() - write_position_;
+            const size_t count = remaining < channel_length ? remaining : channel_length;
+            writer_.Write(tx_left.data(), tx_right.data(), count);
+            write_position_ += count;
+            if (write_position_ >= input_left_.size())
+                Complete();
+        }
+
+        // Fill the received half. Zero padding after the end of input.
+        for (unsigned int i = 0; i < channel_length; i++) {
+            float left = 0.0f;
+            float right = 0.0f;
+            if (read_position_ < input_left_.size()) {
+                left = input_left_[read_position_];
+                right = input_right_[read_position_];
+                read_position_++;
+            }
+            rx_buffer_[offset + 2 * i] = ToDmaWord(left);
+            rx_buffer_[offset + 2 * i + 1] = ToDmaWord(right);
+        }
+
+        // The interrupts of the TX and the RX, unless masked.
+        {
+            std::lock_guard<std::mutex> lock(interrupt_mutex_);
+            const uint64_t entry = Now();
+            if (halves % 2 == 0) {
+                tx_dma_->XferHalfCpltCallback(tx_dma_);
+                rx_dma_->XferHalfCpltCallback(rx_dma_);
+            }
+            else {
+                tx_dma_->XferCpltCallback(tx_dma_);
+                rx_dma_->XferCpltCallback(rx_dma_);
+            }
+            const uint64_t exit = Now();
+
+            const uint64_t elapsed = exit - entry;
+            if (elapsed < min_ns_)
+                min_ns_ = elapsed;
+            if (elapsed > max_ns_)
+                max_ns_ = elapsed;
+            sum_ns_ += elapsed;
+            if (blocks_ != 0)
+                sum_cycle_ns_ += entry - last_entry_;
+            last_entry_ = entry;
+            blocks_++;
+            processed_++;
+        }
+        // Out of the real time mode, the DMA waits for the tasks woken by the interrupts.
+        if (!options_.realtime)
+            WaitForWokenTasks(is_dma_stop_requested_);
+        halves++;
+    }
+}
+
+void Simulation::Complete() {
+    // All input has been processed.
+    writer_.Close();
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_ = true;
+    completion_.notify_all();
+    // As like the real hardware, the audio never stops.
+    completion_.wait(lock, [] {
+        return false;
+    });
+}
+
+void Simulation::WaitForCompletion() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    completion_.wait(lock, [this] {
+        return completed_;
+    });
+}
+
+void Simulation::Report() {
+    const uint64_t processed = processed_;
+    if (processed == 0) {
+        std::fprintf(stderr, "host-sim : No block processed\n");
+        return;
+    }
+    const double mean_ns = static_cast<double>(sum_ns_) / processed;
+    const double budget_ns = 1e9 * channel_length_ / sample_rate_;
+
+    std::fprintf(stderr, "host-sim : %llu blocks of %u samples at %u Hz\n", static_cast<unsigned long long>(processed), channel_length_, sample_rate_);
+    std::fprintf(stderr, "host-sim : processing time per block [nS] min %llu, mean %.1f, max %llu\n", static_cast<unsigned long long>(min_ns_), mean_ns,
+                 static_cast<unsigned long long>(max_ns_));
+    std::fprintf(stderr, "host-sim : processing time per sample [nS] mean %.2f, %.2f%% of the real time budget\n", mean_ns / channel_length_, 100.0 * mean_ns / budget_ns);
+
+    // Cycle time includes the block exchange. It shows the overhead per block.
+    const double cycle_ns = static_cast<double>(sum_cycle_ns_) / processed;
+    std::fprintf(stderr, "host-sim : cycle time per block [nS] mean %.1f, per sample %.2f\n", cycle_ns, cycle_ns / channel_length_);
+
+    if (options_.realtime)
+        std::fprintf(stderr, "host-sim : %llu blocks transferred by DMA while the processing was late\n", static_cast<unsigned long long>(late_blocks_));
+}
+
+} /* namespace hostsim */
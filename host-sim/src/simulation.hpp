@@ -0,0 +1,190 @@
+/**
+ * @file simulation.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Audio stream and timing control of the host simulation.
+ */
+
+#ifndef HOST_SIM_SIMULATION_HPP_
+#define HOST_SIM_SIMULATION_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "main.h"
+#include "wavfile.hpp"
+
+namespace hostsim {
+
+/**
+ * @brief Command line options of the simulation.
+ */
+struct Options {
+    std::string input_file;             ///< Input WAV file. Synthesized signal is used if empty.
+    std::string output_file;            ///< Output WAV file. No output if empty.
+    unsigned int synth_seconds = 10;    ///< Length of the synthesized input [S].
+    unsigned int synth_rate = 48000;    ///< Sampling frequency of the synthesized input [Hz].
+    bool realtime = false;              ///< Pace the blocks at the sampling frequency.
+    bool quiet = false;                 ///< Suppress the debugger console output.
+};
+
+/**
+ * @brief Wait until the tasks woken by the emulated interrupts sleep again.
+ * @param cancel Stop waiting when true.
+ * @details
+ * Each task woken by vTaskNotifyGiveFromISR() since the last call is waited, until it blocks in
+ * ulTaskNotifyTake() with no notification left. Out of the real time mode, the emulated DMA calls it
+ * after the interrupt. Then, a task fed by the interrupt processes every half, as like it is never late.
+ */
+void WaitForWokenTasks(const std::atomic<bool> &cancel);
+
+/**
+ * @brief Singleton to connect the stand-in DuplexAudio with the WAV files.
+ * @details
+ * The input signal is divided into the blocks requested by DuplexAudio. The last block is
+ * padded by zero. The output is aligned to the input sample by sample. That is, the
+ * initial zero block transmitted by TaskBodyFunction() is discarded, and the output has
+ * the same length as the input.
+ *
+ * The processing time of a block is measured from the return of TransmitAndReceive()
+ * to the next call of TransmitAndReceive(). The cycle time of a block is measured between the
+ * successive calls. It includes the overhead of the block exchange.
+ *
+ * When the block length is changed by the platform, the simulation continues with the new length.
+ * As like the hardware, the last block before the change is lost.
+ *
+ * Without the DuplexAudio, the platform may start the circular DMA by itself. Then, StartCircularDma()
+ * runs a thread as the DMA hardware. It calls the DMA callbacks at each half of the buffer, as like
+ * the interrupt. The processing time is measured inside the callbacks. Out of the real time mode, the
+ * next half waits for the tasks woken by the callbacks. Then, an audio task fed by the circular DMA
+ * is never late.
+ */
+class Simulation {
+ public:
+    /**
+     * @brief Get the singleton.
+     */
+    static Simulation& Instance();
+    /**
+     * @brief Prepare the input and output.
+     * @param options Command line options.
+     * @return true on success.
+     */
+    bool Configure(const Options &options);
+    /**
+     * @brief Record the sampling frequency configured to the CODEC.
+     * @param fs Sampling frequency [Hz].
+     */
+    void SetCodecSampleRate(unsigned int fs);
+    /**
+     * @brief Block exchange called by the stand-in DuplexAudio.
+     * @return Number of the blocks transferred by the emulated DMA since the last call.
+     * @details
+     * Never return after the input is exhausted.
+     *
+     * Out of the real time mode, the DMA transfers a block per call. In the real time mode, the DMA
+     * transfers a block at each block period regardless of the call. Then, a late call gets
+     * more than one transfer.
+     */
+    unsigned int Exchange(const float *tx_left, const float *tx_right, float *rx_left, float *rx_right, unsigned int channel_length);
+    /**
+     * @brief Start the emulated circular DMA of the transmission and the reception.
+     * @param tx_dma DMA of the transmission.
+     * @param tx Transmission buffer.
+     * @param rx_dma DMA of the reception.
+     * @param rx Reception buffer.
+     * @param words Number of the 32bit words of a buffer. Two halves of the interleaved stereo block.
+     * @details
+     * The samples are 32bit, the upper half word first, as like the I2S by the half word DMA.
+     * At each half, the transmitted half is written to the output, the received half is read from the
+     * input, and then the half or full transfer callbacks of the TX and RX DMA are called in this order.
+     *
+     * The two halves of zero transmitted at the first start are discarded to align the output.
+     */
+    void StartCircularDma(DMA_HandleTypeDef *tx_dma, const int32_t *tx, DMA_HandleTypeDef *rx_dma, int32_t *rx, unsigned int words);
+    /**
+     * @brief Stop the emulated circular DMA, if running.
+     * @details
+     * As like the hardware, the processed halves not yet transmitted are lost.
+     */
+    void StopCircularDma();
+    /**
+     * @brief Mask the emulated DMA interrupts.
+     * @details
+     * The callbacks of the circular DMA are not called until EnableInterrupt().
+     */
+    void DisableInterrupt();
+    /**
+     * @brief Unmask the emulated DMA interrupts.
+     */
+    void EnableInterrupt();
+    /**
+     * @brief Wait until the input is exhausted and the output is closed.
+     */
+    void WaitForCompletion();
+    /**
+     * @brief Print the timing statistics to the stderr.
+     */
+    void Report();
+    /**
+     * @return true if the debugger console output should be suppressed.
+     */
+    bool IsQuiet() const {
+        return options_.quiet;
+    }
+ private:
+    Simulation() = default;
+    static uint64_t Now();
+    void RunCircularDma();
+    void Complete();
+
+    Options options_;
+    WavReader reader_;
+    WavWriter writer_;
+    std::vector<float> input_left_;
+    std::vector<float> input_right_;
+    unsigned int sample_rate_ = 0;
+    WavFormat format_ = kwfPcm32;
+
+    size_t read_position_ = 0;
+    size_t write_position_ = 0;
+    unsigned int channel_length_ = 0;
+
+    // Emulated circular DMA.
+    std::thread dma_thread_;
+    std::atomic<bool> is_dma_stop_requested_ { false };
+    std::mutex interrupt_mutex_;
+    DMA_HandleTypeDef *tx_dma_ = nullptr;
+    DMA_HandleTypeDef *rx_dma_ = nullptr;
+    const int32_t *tx_buffer_ = nullptr;
+    int32_t *rx_buffer_ = nullptr;
+    unsigned int dma_words_ = 0;
+    unsigned int discarded_halves_ = 0;
+
+    // Timing statistics in nanoseconds.
+    uint64_t blocks_ = 0;
+    uint64_t processed_ = 0;
+    uint64_t last_entry_ = 0;
+    uint64_t last_exit_ = 0;
+    uint64_t start_ = 0;
+    uint64_t dma_blocks_ = 0;
+    uint64_t late_blocks_ = 0;
+    uint64_t min_ns_ = UINT64_MAX;
+    uint64_t max_ns_ = 0;
+    uint64_t sum_ns_ = 0;
+    uint64_t sum_cycle_ns_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable completion_;
+    bool completed_ = false;
+};
+
+} /* namespace hostsim */
+
+#endif /* HOST_SIM_SIMULATION_HPP_ */
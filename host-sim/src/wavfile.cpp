@@ -0,0 +1,247 @@
+/**
+ * @file wavfile.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Minimal RIFF WAVE file reader and writer for the host simulation.
+ */
+
+#include "wavfile.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace hostsim {
+
+namespace {
+
+const uint16_t kFormatPcm = 0x0001;
+const uint16_t kFormatFloat = 0x0003;
+const uint16_t kFormatExtensible = 0xFFFE;
+
+uint16_t GetLe16(const uint8_t *p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t GetLe32(const uint8_t *p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void PutLe16(uint8_t *p, uint16_t value) {
+    p[0] = static_cast<uint8_t>(value);
+    p[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void PutLe32(uint8_t *p, uint32_t value) {
+    p[0] = static_cast<uint8_t>(value);
+    p[1] = static_cast<uint8_t>(value >> 8);
+    p[2] = static_cast<uint8_t>(value >> 16);
+    p[3] = static_cast<uint8_t>(value >> 24);
+}
+
+unsigned int BytesPerSample(WavFormat format) {
+    switch (format) {
+        case kwfPcm16:
+            return 2;
+        case kwfPcm24:
+            return 3;
+        default:
+            return 4;
+    }
+}
+
+// Decode a sample to [-1.0, 1.0).
+float DecodeSample(const uint8_t *p, WavFormat format) {
+    switch (format) {
+        case kwfPcm16:
+            return static_cast<int16_t>(GetLe16(p)) / 32768.0f;
+        case kwfPcm24:
+            // Place 24bit data at MSB side, then scale as 32bit.
+            return static_cast<int32_t>((static_cast<uint32_t>(p[0]) << 8) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 24)) / 2147483648.0f;
+        case kwfPcm32:
+            return static_cast<int32_t>(GetLe32(p)) / 2147483648.0f;
+        default: {
+            uint32_t bits = GetLe32(p);
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    }
+}
+
+// Saturate and round to the integer of the given full scale.
+int32_t Quantize(float sample, double full_scale) {
+    double value = std::nearbyint(static_cast<double>(sample) * full_scale);
+    if (value > full_scale - 1.0)
+        value = full_scale - 1.0;
+    if (value < -full_scale)
+        value = -full_scale;
+    return static_cast<int32_t>(value);
+}
+
+void EncodeSample(uint8_t *p, float sample, WavFormat format) {
+    switch (format) {
+        case kwfPcm16:
+            PutLe16(p, static_cast<uint16_t>(Quantize(sample, 32768.0)));
+            break;
+        case kwfPcm24: {
+            uint32_t value = static_cast<uint32_t>(Quantize(sample, 8388608.0));
+            p[0] = static_cast<uint8_t>(value);
+            p[1] = static_cast<uint8_t>(value >> 8);
+            p[2] = static_cast<uint8_t>(value >> 16);
+            break;
+        }
+        case kwfPcm32:
+            PutLe32(p, static_cast<uint32_t>(Quantize(sample, 2147483648.0)));
+            break;
+        default: {
+            uint32_t bits;
+            std::memcpy(&bits, &sample, sizeof(bits));
+            PutLe32(p, bits);
+            break;
+        }
+    }
+}
+
+}  // namespace
+
+bool WavReader::Open(const std::string &filename) {
+    FILE *file = std::fopen(filename.c_str(), "rb");
+    if (file == nullptr) {
+        std::fprintf(stderr, "%s : Cannot open\n", filename.c_str());
+        return false;
+    }
+    std::vector<uint8_t> image;
+    uint8_t chunk[4096];
+    size_t length;
+    while ((length = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+        image.insert(image.end(), chunk, chunk + length);
+    std::fclose(file);
+
+    if (image.size() < 12 || std::memcmp(&image[0], "RIFF", 4) != 0 || std::memcmp(&image[8], "WAVE", 4) != 0) {
+        std::fprintf(stderr, "%s : Not a RIFF WAVE file\n", filename.c_str());
+        return false;
+    }
+
+    unsigned int channels = 0;
+    unsigned int bits = 0;
+    uint16_t tag = 0;
+    const uint8_t *data = nullptr;
+    size_t data_size = 0;
+
+    // Walk through the chunks.
+    size_t pos = 12;
+    while (pos + 8 <= image.size()) {
+        uint32_t size = GetLe32(&image[pos + 4]);
+        const uint8_t *body = &image[pos + 8];
+        size_t available = image.size() - (pos + 8);
+        if (std::memcmp(&image[pos], "fmt ", 4) == 0 && size >= 16 && available >= 16) {
+            tag = GetLe16(body);
+            channels = GetLe16(body + 2);
+            sample_rate_ = GetLe32(body + 4);
+            bits = GetLe16(body + 14);
+            if (tag == kFormatExtensible && size >= 26 && available >= 26)
+                tag = GetLe16(body + 24);  // first 2 bytes of the sub format GUID.
+        }
+        else if (std::memcmp(&image[pos], "data", 4) == 0) {
+            data = body;
+            data_size = size < available ? size : available;
+        }
+        pos += 8 + size + (size & 1);  // chunks are word aligned.
+    }
+
+    if (data == nullptr || channels == 0) {
+        std::fprintf(stderr, "%s : fmt or data chunk is missing\n", filename.c_str());
+        return false;
+    }
+    if (tag == kFormatPcm && bits == 16)
+        format_ = kwfPcm16;
+    else if (tag == kFormatPcm && bits == 24)
+        format_ = kwfPcm24;
+    else if (tag == kFormatPcm && bits == 32)
+        format_ = kwfPcm32;
+    else if (tag == kFormatFloat && bits == 32)
+        format_ = kwfFloat32;
+    else {
+        std::fprintf(stderr, "%s : Unsupported format (tag %u, %u bits)\n", filename.c_str(), tag, bits);
+        return false;
+    }
+
+    const unsigned int sample_size = BytesPerSample(format_);
+    const size_t frame_size = sample_size * channels;
+    const size_t frames = data_size / frame_size;
+
+    left_.resize(frames);
+    right_.resize(frames);
+    for (size_t i = 0; i < frames; i++) {
+        const uint8_t *frame = data + i * frame_size;
+        left_[i] = DecodeSample(frame, format_);
+        right_[i] = (channels > 1) ? DecodeSample(frame + sample_size, format_) : left_[i];
+    }
+    return true;
+}
+
+WavWriter::~WavWriter() {
+    Close();
+}
+
+bool WavWriter::Open(const std::string &filename, unsigned int sample_rate, WavFormat format) {
+    Close();
+    file_ = std::fopen(filename.c_str(), "wb");
+    if (file_ == nullptr) {
+        std::fprintf(stderr, "%s : Cannot create\n", filename.c_str());
+        return false;
+    }
+    format_ = format;
+    frames_ = 0;
+
+    const unsigned int sample_size = BytesPerSample(format);
+    uint8_t header[44] = { };
+    std::memcpy(header, "RIFF", 4);
+    std::memcpy(header + 8, "WAVEfmt ", 8);
+    PutLe32(header + 16, 16);
+    PutLe16(header + 20, format == kwfFloat32 ? kFormatFloat : kFormatPcm);
+    PutLe16(header + 22, 2);
+    PutLe32(header + 24, sample_rate);
+    PutLe32(header + 28, sample_rate * 2 * sample_size);
+    PutLe16(header + 32, static_cast<uint16_t>(2 * sample_size));
+    PutLe16(header + 34, static_cast<uint16_t>(8 * sample_size));
+    std::memcpy(header + 36, "data", 4);
+    // Size fields are fixed at Close().
+    std::fwrite(header, 1, sizeof(header), file_);
+    return true;
+}
+
+void WavWriter::Write(const float *left, const float *right, size_t count) {
+    if (file_ == nullptr)
+        return;
+    const unsigned int sample_size = BytesPerSample(format_);
+    uint8_t frame[8];
+    for (size_t i = 0; i < count; i++) {
+        EncodeSample(frame, left[i], format_);
+        EncodeSample(frame + sample_size, right[i], format_);
+        std::fwrite(frame, 1, 2 * sample_size, file_);
+    }
+    frames_ += count;
+}
+
+void WavWriter::Close() {
+    if (file_ == nullptr)
+        return;
+    const uint32_t data_size = static_cast<uint32_t>(frames_ * 2 * BytesPerSample(format_));
+    uint8_t size[4];
+
+    PutLe32(size, data_size + 36);
+    std::fseek(file_, 4, SEEK_SET);
+    std::fwrite(size, 1, 4, file_);
+
+    PutLe32(size, data_size);
+    std::fseek(file_, 40, SEEK_SET);
+    std::fwrite(size, 1, 4, file_);
+
+    std::fclose(file_);
+    file_ = nullptr;
+}
+
+} /* namespace hostsim */
@@ -0,0 +1,114 @@
+/**
+ * @file wavfile.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Minimal RIFF WAVE file reader and writer for the host simulation.
+ */
+
+#ifndef HOST_SIM_WAVFILE_HPP_
+#define HOST_SIM_WAVFILE_HPP_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace hostsim {
+
+/**
+ * @brief Sample format of the WAV file.
+ */
+enum WavFormat {
+    kwfPcm16,       ///< 16bit integer PCM.
+    kwfPcm24,       ///< 24bit integer PCM.
+    kwfPcm32,       ///< 32bit integer PCM.
+    kwfFloat32      ///< 32bit IEEE float.
+};
+
+/**
+ * @brief Stereo WAV file reader.
+ * @details
+ * Load the entire file at Open(). The samples are scaled to [-1.0, 1.0).
+ * The mono file is duplicated to both channels. The third and later channels are ignored.
+ */
+class WavReader {
+ public:
+    /**
+     * @brief Load a WAV file.
+     * @param filename Name of the file to read.
+     * @return true on success. false on the unsupported format or I/O error.
+     * @details
+     * The message is printed to the stderr on error.
+     */
+    bool Open(const std::string &filename);
+    /**
+     * @return Sampling frequency [Hz].
+     */
+    unsigned int GetSampleRate() const {
+        return sample_rate_;
+    }
+    /**
+     * @return Sample format of the file.
+     */
+    WavFormat GetFormat() const {
+        return format_;
+    }
+    /**
+     * @return Number of the stereo frames in the file.
+     */
+    size_t GetNumberOfFrames() const {
+        return left_.size();
+    }
+    const std::vector<float>& GetLeft() const {
+        return left_;
+    }
+    const std::vector<float>& GetRight() const {
+        return right_;
+    }
+ private:
+    unsigned int sample_rate_ = 0;
+    WavFormat format_ = kwfPcm32;
+    std::vector<float> left_;
+    std::vector<float> right_;
+};
+
+/**
+ * @brief Stereo WAV file writer.
+ * @details
+ * The samples are written incrementally. The size fields in the header are
+ * fixed at Close(). Integer formats are saturated and rounded to nearest.
+ */
+class WavWriter {
+ public:
+    WavWriter() = default;
+    WavWriter(const WavWriter&) = delete;
+    WavWriter& operator=(const WavWriter&) = delete;
+    ~WavWriter();
+    /**
+     * @brief Create a file and write a header.
+     * @param filename Name of the file to create.
+     * @param sample_rate Sampling frequency [Hz].
+     * @param format Sample format.
+     * @return true on success.
+     */
+    bool Open(const std::string &filename, unsigned int sample_rate, WavFormat format);
+    /**
+     * @brief Append the stereo frames.
+     * @param left Left samples.
+     * @param right Right samples.
+     * @param count Number of the frames to write.
+     */
+    void Write(const float *left, const float *right, size_t count);
+    /**
+     * @brief Fix the header and close the file.
+     */
+    void Close();
+ private:
+    FILE *file_ = nullptr;
+    WavFormat format_ = kwfPcm32;
+    size_t frames_ = 0;
+};
+
+} /* namespace hostsim */
+
+#endif /* HOST_SIM_WAVFILE_HPP_ */
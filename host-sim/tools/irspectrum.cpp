@@ -0,0 +1,165 @@
+/**
+ * @file irspectrum.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Generator of the impulse response spectra for audio::PartitionedConvolver.
+ * @details
+ * Read an impulse response from a WAV file, or synthesize a room like impulse response, and write
+ * a header file which defines the audio::IrSpectrum. The header is included by the murasaki_platform.cpp.
+ * Then, the spectra are placed in the flash, and the target doesn't spend the time to transform the
+ * impulse response.
+ *
+ * The spectra are computed by audio::Fft, the same FFT as the target.
+ */
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "fft.hpp"
+#include "partitionedconvolver.hpp"
+#include "wavfile.hpp"
+
+namespace {
+
+void Usage(const char *name) {
+    std::fprintf(stderr,
+                 "Usage : %s [-i ir.wav] [-n taps] [-t rt60] [-b partition] [-p name] -o header.hpp\n"
+                 "  -i : Impulse response. The left channel is used. Without -i, a room like response is synthesized.\n"
+                 "  -n : Number of the taps. Rounded up to the multiple of the partition. Default is the length of the file, or 2048.\n"
+                 "  -t : Reverberation time of the synthesized response in seconds. Default 0.3.\n"
+                 "  -b : Partition size. Must be the AUDIO_CHANNEL_LEN of the target. Default 128.\n"
+                 "  -p : Name of the audio::IrSpectrum variable. Default kImpulseResponse.\n"
+                 "  -o : Output header file.\n",
+                 name);
+}
+
+// Direct sound and the exponentially decaying noise. Deterministic.
+std::vector<float> SynthesizeRoom(unsigned int taps, float rt60, float fs) {
+    std::vector<float> ir(taps, 0.0f);
+    const unsigned int pre_delay = static_cast<unsigned int>(fs * 0.002f);
+    uint32_t seed = 1;
+
+    ir[0] = 1.0f;
+    for (unsigned int i = pre_delay; i < taps; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        const float noise = static_cast<float>(seed >> 8) / 16777216.0f - 0.5f;
+        // -60dB at rt60.
+        ir[i] = 0.2f * noise * std::exp(-6.9078f * (i - pre_delay) / (fs * rt60));
+    }
+    return ir;
+}
+
+// Name of the include guard from the file name.
+std::string Guard(const std::string &filename) {
+    std::string base = filename.substr(filename.find_last_of('/') + 1);
+    std::string guard;
+    for (char c : base)
+        guard += std::isalnum(static_cast<unsigned char>(c)) ? static_cast<char>(std::toupper(c)) : '_';
+    return guard + "_";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    std::string input_file;
+    std::string output_file;
+    std::string name = "kImpulseResponse";
+    unsigned int taps = 0;
+    unsigned int partition_size = 128;
+    float rt60 = 0.3f;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:n:t:b:p:o:h")) != -1) {
+        switch (opt) {
+            case 'i':
+                input_file = optarg;
+                break;
+            case 'n':
+                taps = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 0));
+                break;
+            case 't':
+                rt60 = std::strtof(optarg, nullptr);
+                break;
+            case 'b':
+                partition_size = static_cast<unsigned int>(std::strtoul(optarg, nullptr, 0));
+                break;
+            case 'p':
+                name = optarg;
+                break;
+            case 'o':
+                output_file = optarg;
+                break;
+            default:
+                Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (output_file.empty() || partition_size < 2 || (partition_size & (partition_size - 1)) != 0) {
+        Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<float> ir;
+    std::string source;
+    if (input_file.empty()) {
+        ir = SynthesizeRoom(taps ? taps : 2048, rt60, 48000.0f);
+        source = "Synthesized room, RT60 " + std::to_string(rt60) + " S at 48000 Hz";
+    } else {
+        hostsim::WavReader reader;
+        if (!reader.Open(input_file))
+            return EXIT_FAILURE;
+        ir = reader.GetLeft();
+        source = input_file;
+    }
+    if (taps == 0)
+        taps = ir.size();
+    const unsigned int partitions = (taps + partition_size - 1) / partition_size;
+    ir.resize(partitions * partition_size, 0.0f);
+
+    // Transform each partition padded by zero.
+    const unsigned int n = 2 * partition_size;
+    const audio::Fft fft(n);
+    std::vector<float> bins(partitions * 2 * (partition_size + 1));
+    std::vector<float> scratch(2 * n);
+    audio::ComputeIrSpectrum(fft, ir.data(), partitions, bins.data(), scratch.data());
+
+    FILE *out = std::fopen(output_file.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "Cannot open %s\n", output_file.c_str());
+        return EXIT_FAILURE;
+    }
+    const std::string guard = Guard(output_file);
+    const std::string base = output_file.substr(output_file.find_last_of('/') + 1);
+    std::fprintf(out,
+                 "/**\n"
+                 " * @file %s\n"
+                 " *\n"
+                 " * @brief Impulse response spectra for audio::PartitionedConvolver.\n"
+                 " * @details\n"
+                 " * Generated by host-sim/tools/irspectrum.cpp. Do not edit.\n"
+                 " * @li Source : %s\n"
+                 " * @li Taps : %u\n"
+                 " * @li Partition size : %u\n"
+                 " */\n\n"
+                 "#ifndef %s\n#define %s\n\n"
+                 "#include \"partitionedconvolver.hpp\"\n\n"
+                 "namespace audio {\n\n",
+                 base.c_str(), source.c_str(), partitions * partition_size, partition_size, guard.c_str(), guard.c_str());
+    std::fprintf(out, "const float %sBins[] = {\n", name.c_str());
+    for (size_t i = 0; i < bins.size(); i += 2)
+        std::fprintf(out, "%s%.9g, %.9g,%s", (i % 8 == 0) ? "        " : " ", bins[i], bins[i + 1],
+                     (i % 8 == 6 || i + 2 == bins.size()) ? "\n" : "");
+    std::fprintf(out, "};\n\n");
+    std::fprintf(out, "constexpr IrSpectrum %s = { %u, %u, %sBins };\n\n", name.c_str(), partition_size, partitions, name.c_str());
+    std::fprintf(out, "} /* namespace audio */\n\n#endif /* %s */\n", guard.c_str());
+    std::fclose(out);
+
+    std::fprintf(stderr, "%s : %u taps, %u partitions of %u samples\n", output_file.c_str(), partitions * partition_size, partitions, partition_size);
+    return EXIT_SUCCESS;
+}
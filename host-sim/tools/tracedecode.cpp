@@ -0,0 +1,231 @@
+/**
+ * @file tracedecode.cpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Decoder of the binary trace recorded by AUDIO_TRACE().
+ * @details
+ * Read the format strings from the section trace_formats of the ELF file, and the dump of the
+ * audio::TraceRecord ring. Then, print the records in the recorded order, as like printf.
+ *
+ * The dump is taken by the debugger from the address printed by the target at the start :
+ * @code
+ * (gdb) dump binary memory trace.bin 0x20001234 0x20002a34
+ * $ tracedecode -e talkthrough.elf -t trace.bin -c 216000000
+ * @endcode
+ * The host simulation writes the same dump by its -t option.
+ *
+ * The time is shown from the oldest record, with the difference from the previous record.
+ * By -c, it is in uS. Otherwise, in the cycles.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "trace.hpp"
+
+namespace {
+
+void Usage(const char *name) {
+    std::fprintf(stderr,
+                 "Usage : %s -e program.elf -t trace.bin [-c clock]\n"
+                 "  -e : ELF file of the program which recorded the trace.\n"
+                 "  -t : Dump of the audio::TraceRecord ring.\n"
+                 "  -c : Frequency of the cycle counter in Hz. The SystemCoreClock. Without -c, the time is in cycles.\n",
+                 name);
+}
+
+bool ReadFile(const char *file_name, std::vector<unsigned char> *contents) {
+    FILE *file = std::fopen(file_name, "rb");
+    if (nullptr == file) {
+        std::perror(file_name);
+        return false;
+    }
+    unsigned char buffer[4096];
+    size_t length;
+    contents->clear();
+    while ((length = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+        contents->insert(contents->end(), buffer, buffer + length);
+    std::fclose(file);
+    return true;
+}
+
+// Little endian field of the ELF file.
+uint64_t Field(const std::vector<unsigned char> &elf, uint64_t offset, unsigned int size) {
+    uint64_t value = 0;
+    if (offset + size > elf.size())
+        return 0;
+    for (unsigned int i = 0; i < size; i++)
+        value |= static_cast<uint64_t>(elf[offset + i]) << (8 * i);
+    return value;
+}
+
+/*
+ * Contents of the section trace_formats. ELF32 of the target and ELF64 of the host, little endian.
+ * The INFO section is not loaded to the target, but its contents are in the ELF file.
+ */
+bool ReadFormats(const char *file_name, std::string *formats) {
+    std::vector<unsigned char> elf;
+    if (!ReadFile(file_name, &elf))
+        return false;
+    if (elf.size() < 64 || std::memcmp(elf.data(), "\177ELF", 4) != 0 || elf[5] != 1) {
+        std::fprintf(stderr, "%s is not a little endian ELF file\n", file_name);
+        return false;
+    }
+
+    const bool is_64 = elf[4] == 2;
+    const uint64_t section_headers = is_64 ? Field(elf, 0x28, 8) : Field(elf, 0x20, 4);
+    const unsigned int header_size = static_cast<unsigned int>(Field(elf, is_64 ? 0x3a : 0x2e, 2));
+    const unsigned int sections = static_cast<unsigned int>(Field(elf, is_64 ? 0x3c : 0x30, 2));
+    const unsigned int names_index = static_cast<unsigned int>(Field(elf, is_64 ? 0x3e : 0x32, 2));
+
+    // Offset and size of a section, by its header.
+    auto offset_of = [&](unsigned int index) {
+        return Field(elf, section_headers + index * header_size + (is_64 ? 0x18 : 0x10), is_64 ? 8 : 4);
+    };
+    auto size_of = [&](unsigned int index) {
+        return Field(elf, section_headers + index * header_size + (is_64 ? 0x20 : 0x14), is_64 ? 8 : 4);
+    };
+    const uint32_t kNoBits = 8;
+
+    const uint64_t names = offset_of(names_index);
+    for (unsigned int i = 0; i < sections; i++) {
+        const uint64_t header = section_headers + i * header_size;
+        const uint64_t name = names + Field(elf, header, 4);
+        if (name >= elf.size() || std::strcmp(reinterpret_cast<const char*>(&elf[name]), "trace_formats") != 0)
+            continue;
+        const uint64_t offset = offset_of(i);
+        const uint64_t size = size_of(i);
+        if (Field(elf, header + 4, 4) == kNoBits || offset + size > elf.size())
+            break;
+        formats->assign(reinterpret_cast<const char*>(&elf[offset]), size);
+        return true;
+    }
+    std::fprintf(stderr, "%s has no trace_formats section. Is AUDIO_CONFIG_TRACE true?\n", file_name);
+    return false;
+}
+
+/*
+ * Format a record as like printf. The arguments are 32bit. The length modifiers are ignored.
+ * The conversions other than the integers are shown as they are.
+ */
+std::string FormatRecord(const char *format, const audio::TraceRecord &record) {
+    std::string text;
+    unsigned int arg = 0;
+    char buffer[64];
+
+    while (*format != '\0') {
+        if (*format != '%') {
+            text += *format++;
+            continue;
+        }
+        if (format[1] == '%') {
+            text += '%';
+            format += 2;
+            continue;
+        }
+
+        // Flags, width and precision are passed to snprintf. The length modifiers are removed.
+        const char *begin = format++;
+        std::string spec = "%";
+        while (*format != '\0' && std::strchr("-+ #0123456789.", *format) != nullptr)
+            spec += *format++;
+        while (*format != '\0' && std::strchr("hljztL", *format) != nullptr)
+            format++;
+        const char conversion = *format;
+        if (conversion == '\0' || std::strchr("diuxXoc", conversion) == nullptr || arg >= audio::kTraceArgs) {
+            text.append(begin, format - begin);
+            continue;
+        }
+        format++;
+        spec += conversion;
+
+        const uint32_t value = record.args[arg++];
+        if (conversion == 'd' || conversion == 'i' || conversion == 'c')
+            std::snprintf(buffer, sizeof(buffer), spec.c_str(), static_cast<int>(static_cast<int32_t>(value)));
+        else
+            std::snprintf(buffer, sizeof(buffer), spec.c_str(), static_cast<unsigned int>(value));
+        text += buffer;
+    }
+    return text;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    const char *elf_file = nullptr;
+    const char *trace_file = nullptr;
+    double clock = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "e:t:c:h")) != -1) {
+        switch (opt) {
+            case 'e':
+                elf_file = optarg;
+                break;
+            case 't':
+                trace_file = optarg;
+                break;
+            case 'c':
+                clock = std::strtod(optarg, nullptr);
+                break;
+            default:
+                Usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (nullptr == elf_file || nullptr == trace_file || clock < 0) {
+        Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string formats;
+    std::vector<unsigned char> dump;
+    if (!ReadFormats(elf_file, &formats) || !ReadFile(trace_file, &dump))
+        return EXIT_FAILURE;
+    if (dump.size() % sizeof(audio::TraceRecord) != 0) {
+        std::fprintf(stderr, "%s is not a dump of the trace records\n", trace_file);
+        return EXIT_FAILURE;
+    }
+
+    // The records being written and the ones never written have the sequence 0.
+    std::vector<audio::TraceRecord> records;
+    for (size_t offset = 0; offset < dump.size(); offset += sizeof(audio::TraceRecord)) {
+        audio::TraceRecord record;
+        std::memcpy(&record, &dump[offset], sizeof(record));
+        if (record.sequence != 0)
+            records.push_back(record);
+    }
+    std::sort(records.begin(), records.end(), [](const audio::TraceRecord &a, const audio::TraceRecord &b) {
+        return static_cast<int32_t>(a.sequence - b.sequence) < 0;
+    });
+
+    // Time from the oldest record. The cycle counter wraps around.
+    const double scale = clock > 0 ? 1e6 / clock : 1.0;
+    const char *unit = clock > 0 ? "uS" : "cycles";
+    const int precision = clock > 0 ? 3 : 0;
+    uint64_t elapsed = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+        const audio::TraceRecord &record = records[i];
+        const uint32_t delta = i == 0 ? 0 : record.timestamp - records[i - 1].timestamp;
+        elapsed += delta;
+
+        if (i != 0 && record.sequence != records[i - 1].sequence + 1)
+            std::printf("--- %lu records lost\n", static_cast<unsigned long>(record.sequence - records[i - 1].sequence - 1));
+
+        std::string text;
+        if (record.id < formats.size() && formats.find('\0', record.id) != std::string::npos)
+            text = FormatRecord(formats.c_str() + record.id, record);
+        else
+            text = "Unknown format " + std::to_string(record.id);
+        std::printf("%8lu %14.*f %s (%+.*f) %s\n", static_cast<unsigned long>(record.sequence), precision, elapsed * scale, unit, precision,
+                    delta * scale, text.c_str());
+    }
+    std::fprintf(stderr, "%s : %lu records\n", trace_file, static_cast<unsigned long>(records.size()));
+    return EXIT_SUCCESS;
+}
@@ -29,4 +29,43 @@
 // Define following macro as true to halt the cycle counter inside MURASAKI_SYSLOG macro.
 #define MURASAKI_CONFIG_NOSYCCNT false
 
+// Define following macro as true to place the objects created in InitPlatform(), the audio buffers and
+// the audio task stack in the static storage, instead of the heap.
+// The storage is in the .platform_objects and .audio_buffers sections of the linker script.
+#define AUDIO_CONFIG_STATIC_ALLOCATION true
+
+// Define following macro as true to place the audio task in the ITCM.
+// Set false to compare the CPU load shown on the console, when the code runs from the flash.
+#define AUDIO_CONFIG_USE_TCM true
+
+// Placement of the FreeRTOS heap, where the DMA buffers of the audio framework are allocated.
+// Both need no cache maintenance. The cached SRAM is not an option, because the port adapters of
+// the murasaki library don't maintain the cache by the half of the buffer. See dmacoherency.hpp.
+#define AUDIO_DMA_BUFFER_DTCM 1             // DTCM. Not cached.
+#define AUDIO_DMA_BUFFER_NONCACHEABLE 2     // SRAM configured as non-cacheable by the MPU.
+#define AUDIO_CONFIG_DMA_BUFFER AUDIO_DMA_BUFFER_DTCM
+
+// Define following macro as true to print the cost of the each placement above at the start.
+#define AUDIO_CONFIG_COHERENCY_BENCHMARK false
+
+// Define following macro as true to convolve the audio with the impulse response of a small room.
+#define AUDIO_CONFIG_CONVOLUTION true
+
+// Define following macro as true to process the audio at AUDIO_CONFIG_PROCESSING_RATE, by converting
+// the sample rate from and to the CODEC.
+#define AUDIO_CONFIG_RESAMPLING false
+#define AUDIO_CONFIG_PROCESSING_RATE 44100
+
+// Define following macro as true to analyze the spectrum of the output in the analysis task,
+// which runs in the idle time of the audio task.
+#define AUDIO_CONFIG_ANALYSIS true
+
+// Define following macro as true to run the convolution in the analysis task, instead of the audio task.
+// The output is delayed by a block. Needs AUDIO_CONFIG_CONVOLUTION and AUDIO_CONFIG_ANALYSIS, without AUDIO_CONFIG_RESAMPLING.
+#define AUDIO_CONFIG_BACKGROUND_CONVOLUTION false
+
+// Define following macro as true to record the block handling by AUDIO_TRACE(), into a binary trace in the RAM.
+// The trace is dumped by the debugger, and decoded by host-sim/tools/tracedecode with the ELF file.
+#define AUDIO_CONFIG_TRACE true
+
 #endif /* PLATFORM_CONFIG_HPP_ */
@@ -0,0 +1,105 @@
+/**
+ * @file board.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Peripherals of this board, for the platform implementation.
+ * @details
+ * Included by common/Src/audioplatform.cpp, which is compiled in this project. The members of the
+ * struct Board are listed in audioplatform.cpp.
+ */
+
+#ifndef BOARD_HPP_
+#define BOARD_HPP_
+
+// Searched in the include paths, not beside this file. Then, the host simulation can replace it.
+#include <main.h>
+
+// Include the murasaki class library.
+#include "murasaki.hpp"
+
+/* ------------------------ STM32 Peripherals ----------------------------- */
+
+/*
+ * Platform dependent peripheral declaration.
+ *
+ * The variables here are defined at the top of the main.c.
+ * Only the variable needed by the InitPlatform() are declared here
+ * as external symbols.
+ *
+ * The declaration here is user project dependent.
+ */
+// Following block is just sample.
+// Original declaration is in the top of main.c.
+extern I2C_HandleTypeDef hi2c1;
+extern UART_HandleTypeDef huart3;
+extern SAI_HandleTypeDef hsai_BlockA1;
+extern SAI_HandleTypeDef hsai_BlockB1;
+
+/* ------------------------ Board traits ----------------------------- */
+
+/**
+ * @brief Peripherals of the Nucleo-F722ZE and Akashi-02 board, for the platform implementation.
+ * @details
+ * hsai_BlockB1 and hsai_BlockA1 are block B and A of the SAI1.
+ * These ports are configured by the configurator of the CubeIDE.
+ *
+ * The interrupt audio mode is not supported. The DMA buffers have to be coherent with the data cache.
+ */
+struct Board {
+    typedef murasaki::SaiPortAdapter AudioPortAdapter;
+
+    static SAI_HandleTypeDef* TxPort() {
+        return &hsai_BlockB1;
+    }
+
+    static SAI_HandleTypeDef* RxPort() {
+        return &hsai_BlockA1;
+    }
+
+    static DMA_HandleTypeDef* TxDma() {
+        return hsai_BlockB1.hdmatx;
+    }
+
+    static DMA_HandleTypeDef* RxDma() {
+        return hsai_BlockA1.hdmarx;
+    }
+
+    static void StopAudioPort() {
+        HAL_SAI_DMAStop(&hsai_BlockB1);
+        HAL_SAI_DMAStop(&hsai_BlockA1);
+    }
+
+    // On Nucleo, the port connected to the USB port of ST-Link.
+    static UART_HandleTypeDef* ConsoleUart() {
+        return &huart3;
+    }
+
+    static I2C_HandleTypeDef* CodecI2c() {
+        return &hi2c1;
+    }
+
+    // The port and pin names are defined by CubeIDE.
+    static GPIO_TypeDef* StatusLed0Port() {
+        return ST0_GPIO_Port;
+    }
+
+    static uint16_t StatusLed0Pin() {
+        return ST0_Pin;
+    }
+
+    static GPIO_TypeDef* StatusLed1Port() {
+        return ST1_GPIO_Port;
+    }
+
+    static uint16_t StatusLed1Pin() {
+        return ST1_Pin;
+    }
+
+    // The user button on the Nucleo board. true if the button is pushed.
+    static bool IsUserButtonPressed() {
+        return GPIO_PIN_SET == HAL_GPIO_ReadPin(USER_Btn_GPIO_Port, USER_Btn_Pin);
+    }
+};
+
+#endif /* BOARD_HPP_ */
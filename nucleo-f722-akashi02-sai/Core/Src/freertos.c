@@ -25,6 +25,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */     
+#include "platform_config.hpp"
 
 /* USER CODE END Includes */
 
@@ -45,6 +46,15 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN Variables */
+/* FreeRTOS heap. The DMA buffers of the audio framework are allocated from here. */
+/* In the DTCM and in the non-cacheable region, the DMA doesn't need the cache maintenance. */
+#if AUDIO_CONFIG_DMA_BUFFER == AUDIO_DMA_BUFFER_DTCM
+uint8_t ucHeap[ configTOTAL_HEAP_SIZE ] __attribute__((section(".dtcm_bss")));
+#elif AUDIO_CONFIG_DMA_BUFFER == AUDIO_DMA_BUFFER_NONCACHEABLE
+uint8_t ucHeap[ configTOTAL_HEAP_SIZE ] __attribute__((section(".nocache_bss")));
+#else
+#error "AUDIO_CONFIG_DMA_BUFFER must be AUDIO_DMA_BUFFER_DTCM or AUDIO_DMA_BUFFER_NONCACHEABLE"
+#endif
 
 /* USER CODE END Variables */
 
@@ -0,0 +1,124 @@
+/**
+ * @file board.hpp
+ *
+ * @date 2026/10/16
+ * @author Seiichi "Suikan" Horie
+ * @brief Peripherals of this board, for the platform implementation.
+ * @details
+ * Included by common/Src/audioplatform.cpp, which is compiled in this project. The members of the
+ * struct Board are listed in audioplatform.cpp.
+ */
+
+#ifndef BOARD_HPP_
+#define BOARD_HPP_
+
+// Searched in the include paths, not beside this file. Then, the host simulation can replace it.
+#include <main.h>
+
+// Include the murasaki class library.
+#include "murasaki.hpp"
+
+// For the audio::DmaWordOrder of the board.
+#include "interruptaudio.hpp"
+
+/* ------------------------ STM32 Peripherals ----------------------------- */
+
+/*
+ * Platform dependent peripheral declaration.
+ *
+ * The variables here are defined at the top of the main.c.
+ * Only the variable needed by the InitPlatform() are declared here
+ * as external symbols.
+ *
+ * The declaration here is user project dependent.
+ */
+// Following block is just sample.
+// Original declaration is in the top of main.c.
+extern I2C_HandleTypeDef hi2c1;
+extern UART_HandleTypeDef hlpuart1;
+extern I2S_HandleTypeDef hi2s2;
+extern I2S_HandleTypeDef hi2s3;
+
+/* ------------------------ Board traits ----------------------------- */
+
+/**
+ * @brief Peripherals of the Nucleo-G431RB and Akashi-04 board, for the platform implementation.
+ * @details
+ * The G431 has no I2Sext for the full duplex I2S. Then, two I2S in the slave mode share the clocks
+ * of the CODEC. I2S2 transmits and I2S3 receives. Both DMA run in the same frame.
+ */
+struct Board {
+    typedef murasaki::I2sPortAdapter AudioPortAdapter;
+
+    static I2S_HandleTypeDef* TxPort() {
+        return &hi2s2;
+    }
+
+    static I2S_HandleTypeDef* RxPort() {
+        return &hi2s3;
+    }
+
+    static DMA_HandleTypeDef* TxDma() {
+        return hi2s2.hdmatx;
+    }
+
+    static DMA_HandleTypeDef* RxDma() {
+        return hi2s3.hdmarx;
+    }
+
+    // The DMA streams of CubeIDE. The priorities are set in main.c.
+    static IRQn_Type TxDmaIrq() {
+        return DMA1_Channel3_IRQn;
+    }
+
+    static IRQn_Type RxDmaIrq() {
+        return DMA1_Channel4_IRQn;
+    }
+
+    static void StopAudioPort() {
+        HAL_I2S_DMAStop(&hi2s2);
+        HAL_I2S_DMAStop(&hi2s3);
+    }
+
+    // The I2S transmits the 32bit data by the half word DMA, the upper half first.
+    static constexpr audio::DmaWordOrder kDmaWordOrder = audio::kdwoSwappedHalves;
+
+    // The size of the I2S DMA is the number of the 32bit data.
+    static void StartAudioDma(int32_t *tx, int32_t *rx, unsigned int words) {
+        HAL_I2S_Receive_DMA(&hi2s3, reinterpret_cast<uint16_t*>(rx), words);
+        HAL_I2S_Transmit_DMA(&hi2s2, reinterpret_cast<uint16_t*>(tx), words);
+    }
+
+    // On Nucleo, the port connected to the USB port of ST-Link.
+    static UART_HandleTypeDef* ConsoleUart() {
+        return &hlpuart1;
+    }
+
+    static I2C_HandleTypeDef* CodecI2c() {
+        return &hi2c1;
+    }
+
+    // The port and pin names are defined by CubeIDE.
+    static GPIO_TypeDef* StatusLed0Port() {
+        return LED1_GPIO_Port;
+    }
+
+    static uint16_t StatusLed0Pin() {
+        return LED1_Pin;
+    }
+
+    static GPIO_TypeDef* StatusLed1Port() {
+        return LED2_GPIO_Port;
+    }
+
+    static uint16_t StatusLed1Pin() {
+        return LED2_Pin;
+    }
+
+    // The user button on the Nucleo board. true if the button is pushed.
+    static bool IsUserButtonPressed() {
+        return GPIO_PIN_SET == HAL_GPIO_ReadPin(B1_GPIO_Port, B1_Pin);
+    }
+};
+
+#endif /* BOARD_HPP_ */
@@ -29,4 +29,22 @@
 // Define following macro as true to halt the cycle counter inside MURASAKI_SYSLOG macro.
 #define MURASAKI_CONFIG_NOSYCCNT false
 
+// Define following macro as true to place the objects created in InitPlatform(), the audio buffers and
+// the audio task stack in the static storage, instead of the heap.
+// The storage is in the .platform_objects and .audio_buffers sections of the linker script.
+#define AUDIO_CONFIG_STATIC_ALLOCATION true
+
+// Define following macro as true to process the audio at AUDIO_CONFIG_PROCESSING_RATE, by converting
+// the sample rate from and to the CODEC.
+#define AUDIO_CONFIG_RESAMPLING false
+#define AUDIO_CONFIG_PROCESSING_RATE 44100
+
+// Define following macro as true to process the audio in the DMA interrupt, without the audio task.
+// The processing runs on the main stack, and no context switch is needed for a block.
+#define AUDIO_CONFIG_INTERRUPT_AUDIO false
+
+// Define following macro as true to process the audio in Q31 from the DMA words, without the float conversion.
+// The equalizer and the output volume are applied in Q31, instead of the float chain.
+#define AUDIO_CONFIG_Q31_PROCESSING true
+
 #endif /* PLATFORM_CONFIG_HPP_ */
@@ -14,6 +14,33 @@
 #ifndef PLATFORM_DEFS_HPP_
 #define PLATFORM_DEFS_HPP_
 
+// Application classes referred from the platform.
+namespace audio {
+class BlockLength;
+class SampleRate;
+class LoadMeter;
+class LatencyMeter;
+class XrunMonitor;
+class DebugLog;
+class AudioTrace;
+class InterruptAudio;
+class Q31BlockExchanger;
+class BiquadCascade;
+class BiquadCascadeQ31;
+class FirFilter;
+class PartitionedConvolver;
+class DynamicsProcessor;
+class SmoothedGain;
+class Q31Gain;
+class ParameterQueue;
+class ResamplingStage;
+class BackgroundStage;
+class SpectrumAnalyzer;
+class StaticTask;
+class TaskNotification;
+template<typename T> class AudioProcessor;
+}
+
 namespace murasaki {
 /**
  * \brief Custom aggregation struct for user platform.
@@ -42,11 +69,45 @@ struct Platform
 
     AudioCodecStrategy * codec;				///< Audio codec controller
     AudioPortAdapterStrategy * audio_port;	///< Audio Interface serial port.
-    DuplexAudio * audio;					///< The framework to exchange audio data.
+    DuplexAudio * audio;					///< The framework to exchange audio data. nullptr in the interrupt audio mode.
+    audio::InterruptAudio * interrupt_audio;	///< Audio processing in the DMA interrupt. nullptr in the task mode.
+    audio::Q31BlockExchanger * q31_exchanger;	///< Q31 block exchange of the audio task. nullptr if not the Q31 processing in the task mode.
+    audio::BlockLength * audio_block;		///< Length of the audio block and its change request.
+    audio::SampleRate * sample_rate;		///< Sampling frequency and its change request.
+    audio::LoadMeter * load_meter;			///< CPU load of the audio task.
+    audio::LatencyMeter * latency;			///< Latency from the DMA interrupt to the processing.
+    audio::XrunMonitor * xrun;				///< Counter of the blocks missed by the audio task.
+    audio::DebugLog * log;					///< Messages of the audio task and the interrupts, printed by ExecPlatform().
+    audio::AudioTrace * trace;				///< Binary trace of the block handling. nullptr if disabled by AUDIO_CONFIG_TRACE.
+    audio::BiquadCascade * equalizer;		///< Parametric equalizer of the audio task.
+    audio::FirFilter * fir;					///< FIR filter after the equalizer.
+    audio::PartitionedConvolver * convolver;	///< Convolution with the long impulse response. nullptr if disabled.
+    audio::DynamicsProcessor * dynamics;	///< Compressor and limiter at the end of the processing.
+    audio::SmoothedGain * volume;		///< Output volume after the limiter.
+    audio::AudioProcessor<float> * chain;	///< Processing chain of the stages above.
+    audio::BiquadCascadeQ31 * q31_equalizer;	///< Equalizer of the Q31 processing. nullptr if disabled by AUDIO_CONFIG_Q31_PROCESSING.
+    audio::Q31Gain * q31_volume;		///< Output volume of the Q31 processing. nullptr if disabled by AUDIO_CONFIG_Q31_PROCESSING.
+    audio::AudioProcessor<int32_t> * q31_chain;	///< Processing chain of the Q31 stages. nullptr if disabled by AUDIO_CONFIG_Q31_PROCESSING.
+    audio::ParameterQueue * parameters;		///< Parameter changes from the control task to the audio task.
+    audio::ResamplingStage * resampler;		///< Sample rate conversion around the processing. nullptr if disabled.
+    audio::BackgroundStage * background_convolver;	///< The convolver run by the analysis task. nullptr if disabled.
+    audio::SpectrumAnalyzer * spectrum;		///< Spectrum analysis of the output. nullptr if disabled.
+    audio::BackgroundStage * analysis;		///< Output of the audio task handed to the analysis task. nullptr if disabled.
+    audio::LoadMeter * analysis_meter;		///< CPU load of the analysis task. nullptr if disabled.
+    audio::TaskNotification * analysis_request;	///< Wake up of the analysis task by the audio task or the DMA interrupt. nullptr if disabled.
 
-    TaskStrategy * audio_task;           	///< Task under test
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+    audio::StaticTask * audio_task;         ///< Task under test. Created with the static stack. nullptr in the interrupt audio mode.
+#else
+    TaskStrategy * audio_task;           	///< Task under test. nullptr in the interrupt audio mode.
+#endif
+#if AUDIO_CONFIG_STATIC_ALLOCATION
+    audio::StaticTask * analysis_task;      ///< Background task of the analysis. nullptr if disabled.
+#else
+    TaskStrategy * analysis_task;           ///< Background task of the analysis. nullptr if disabled.
+#endif
 
-    Synchronizer * codec_ready;				///< Synchronization between audio task and exec.
+    Synchronizer * codec_ready;				///< Synchronization between audio task and exec. nullptr in the interrupt audio mode.
 
 };
 